@@ -0,0 +1,29 @@
+//--------------------------------------------------------------------------
+/*! \file benchmarks/HHVClamp.cc
+
+\brief Benchmark driver for the HHVclampGA userproject model
+*/
+//--------------------------------------------------------------------------
+#include "HHVClampParameters.h"
+
+#include "HHVClamp_CODE/definitions.h"
+
+#include "benchmark.h"
+
+int main(int argc, char *argv[])
+{
+    return runBenchmark(argc, argv,
+        []()
+        {
+            allocateMem();
+            initialize();
+            initializeSparse();
+            IsynGHH = 0.0;
+        },
+        [](unsigned long long i)
+        {
+            // Clamp population with 50ms voltage steps between -60mV and -20mV
+            // **NOTE** unlike the genetic algorithm, no reference model is simulated so IsynG is left at zero
+            stepVGHH = (((unsigned long long)(i * DT) / 50) % 2) ? -20.0 : -60.0;
+        });
+}
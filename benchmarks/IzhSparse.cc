@@ -0,0 +1,37 @@
+//--------------------------------------------------------------------------
+/*! \file benchmarks/IzhSparse.cc
+
+\brief Benchmark driver for the Izh_sparse userproject model
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+
+// Standard C includes
+#include <cmath>
+
+#include "sizes.h"
+
+#include "IzhSparse_CODE/definitions.h"
+
+#include "benchmark.h"
+
+int main(int argc, char *argv[])
+{
+    return runBenchmark(argc, argv,
+        []()
+        {
+            const unsigned int nExc = (unsigned int)ceil(4.0 * _NNeurons / 5.0);
+            const unsigned int nInh = _NNeurons - nExc;
+
+            allocateMem();
+            initialize();
+
+            // Manually initialise U of inhibitory population
+            pullbPInhFromDevice();
+            std::transform(&bPInh[0], &bPInh[nInh], &UPInh[0],
+                           [](scalar b){ return b * -65.0f; });
+            initializeSparse();
+        },
+        [](unsigned long long){});
+}
@@ -0,0 +1,63 @@
+//--------------------------------------------------------------------------
+/*! \file benchmarks/MBody1.cc
+
+\brief Benchmark driver for the MBody1 userproject model
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Standard C includes
+#include <cmath>
+
+#include "sizes.h"
+
+#include "MBody1_CODE/definitions.h"
+
+#include "benchmark.h"
+
+int main(int argc, char *argv[])
+{
+    // Present a new odour pattern every 100ms for 10ms on top of a 0.2Hz baseline
+    const unsigned long long patSetTimeSteps = (unsigned long long)std::round(100.0 / DT);
+    const unsigned long long patFireTimeSteps = (unsigned long long)std::round(10.0 / DT);
+    const unsigned int numPatterns = 10;
+
+    return runBenchmark(argc, argv,
+        []()
+        {
+            allocateMem();
+            initialize();
+
+            // Calculate gRawKCDN from initialised KCDN conductances
+            pullgKCDNFromDevice();
+            std::transform(&gKCDN[0], &gKCDN[_NKC * _NDN], &gRawKCDN[0],
+                           [](scalar g)
+                           {
+                               const double tmp = (double)g / 0.015 * 2.0;
+                               return (scalar)(0.5 * log(tmp / (2.0 - tmp)) / 33.33 + 0.0075);
+                           });
+            initializeSparse();
+
+            // Build baseline followed by patterns in which 10% of PNs fire at 1000Hz
+            // **NOTE** uses a fixed seed so every run sees the same input
+            std::mt19937 rng(1234);
+            std::bernoulli_distribution active(0.1);
+            allocatefiringProbPN(_NAL * (1 + numPatterns));
+            std::fill_n(&firingProbPN[0], _NAL, (scalar)((0.2 / 1000.0) * DT));
+            std::generate_n(&firingProbPN[_NAL], _NAL * numPatterns,
+                            [&rng, &active](){ return (scalar)(((active(rng) ? 1000.0 : 0.2) / 1000.0) * DT); });
+            pushfiringProbPNToDevice(_NAL * (1 + numPatterns));
+        },
+        [patSetTimeSteps, patFireTimeSteps, numPatterns](unsigned long long i)
+        {
+            if((i % patSetTimeSteps) == 0) {
+                offsetPN = (((i / patSetTimeSteps) % numPatterns) + 1) * _NAL;
+            }
+            if((i % patSetTimeSteps) == patFireTimeSteps) {
+                offsetPN = 0;
+            }
+        });
+}
@@ -0,0 +1,23 @@
+//--------------------------------------------------------------------------
+/*! \file benchmarks/OneComp.cc
+
+\brief Benchmark driver for the OneComp userproject model
+*/
+//--------------------------------------------------------------------------
+#include "sizes.h"
+
+#include "OneComp_CODE/definitions.h"
+
+#include "benchmark.h"
+
+int main(int argc, char *argv[])
+{
+    return runBenchmark(argc, argv,
+        []()
+        {
+            allocateMem();
+            initialize();
+            initializeSparse();
+        },
+        [](unsigned long long){});
+}
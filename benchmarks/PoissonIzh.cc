@@ -0,0 +1,23 @@
+//--------------------------------------------------------------------------
+/*! \file benchmarks/PoissonIzh.cc
+
+\brief Benchmark driver for the PoissonIzh userproject model
+*/
+//--------------------------------------------------------------------------
+#include "sizes.h"
+
+#include "PoissonIzh_CODE/definitions.h"
+
+#include "benchmark.h"
+
+int main(int argc, char *argv[])
+{
+    return runBenchmark(argc, argv,
+        []()
+        {
+            allocateMem();
+            initialize();
+            initializeSparse();
+        },
+        [](unsigned long long){});
+}
@@ -0,0 +1,21 @@
+//--------------------------------------------------------------------------
+/*! \file benchmarks/SynDelay.cc
+
+\brief Benchmark driver for the SynDelay userproject model
+*/
+//--------------------------------------------------------------------------
+#include "SynDelay_CODE/definitions.h"
+
+#include "benchmark.h"
+
+int main(int argc, char *argv[])
+{
+    return runBenchmark(argc, argv,
+        []()
+        {
+            allocateMem();
+            initialize();
+            initializeSparse();
+        },
+        [](unsigned long long){});
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+// Standard C++ includes
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Standard C includes
+#include <cstdint>
+#include <cstdlib>
+
+// **NOTE** this header must be included after the auto-generated definitions.h as, if the model
+// was built with profiling enabled, it uses the merged group profiles which are then generated
+
+//----------------------------------------------------------------------------
+// Benchmark
+//----------------------------------------------------------------------------
+//! Runs a benchmark of a model, either counting events or timing it depending on whether profiling is enabled
+/*! Command line arguments are <model name> <scale> <number of timesteps> <counts file> <results file>.
+    init should allocate and initialise the model and beforeStep is called with the index of each timestep
+    before it is simulated to provide input. If the model was built with profiling enabled, the spikes
+    and synaptic events that occur during the simulation are written to the counts file. Otherwise,
+    initialisation and simulation are timed and a JSON record of the results, including the counts from
+    the profiled run, is appended to the results file. This keeps the profiling counters out of the timed code */
+template<typename I, typename S>
+int runBenchmark(int argc, char *argv[], I init, S beforeStep)
+{
+    if(argc != 6) {
+        std::cerr << "usage: " << argv[0] << " <model name> <scale> <number of timesteps> <counts file> <results file>" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string modelName = argv[1];
+    const std::string scale = argv[2];
+    const unsigned long long numTimesteps = std::strtoull(argv[3], nullptr, 10);
+
+    // Allocate and initialise model
+    const auto initStart = std::chrono::high_resolution_clock::now();
+    init();
+    const double initTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - initStart).count();
+
+#ifdef NUM_MERGED_GROUP_PROFILES
+    // Only count events which occur within benchmark
+    resetProfile();
+#endif
+
+    // Simulate model
+    const auto simStart = std::chrono::high_resolution_clock::now();
+    for(unsigned long long i = 0; i < numTimesteps; i++) {
+        beforeStep(i);
+        stepTime();
+    }
+    const double simTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - simStart).count();
+
+#ifdef NUM_MERGED_GROUP_PROFILES
+    // Sum spikes and synaptic events across all merged groups
+    const MergedGroupProfile *profile = getProfile();
+    uint64_t numSpikes = 0;
+    uint64_t numSynapticEvents = 0;
+    for(unsigned int i = 0; i < NUM_MERGED_GROUP_PROFILES; i++) {
+        numSpikes += profile[i].numSpikes;
+        numSynapticEvents += profile[i].numSynapticEvents;
+    }
+    freeMem();
+
+    // Write counts to file for timed run
+    std::ofstream counts(argv[4]);
+    if(!counts.good()) {
+        std::cerr << "Unable to open '" << argv[4] << "'" << std::endl;
+        return EXIT_FAILURE;
+    }
+    counts << numSpikes << " " << numSynapticEvents << std::endl;
+    return EXIT_SUCCESS;
+#else
+    freeMem();
+
+    // Read counts written by profiled run
+    std::ifstream counts(argv[4]);
+    uint64_t numSpikes = 0;
+    uint64_t numSynapticEvents = 0;
+    if(!(counts >> numSpikes >> numSynapticEvents)) {
+        std::cerr << "Unable to read counts from '" << argv[4] << "'" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const double stepsPerSecond = (double)numTimesteps / simTime;
+    const double synapticEventsPerSecond = (double)numSynapticEvents / simTime;
+    std::cout << modelName << " (scale " << scale << "): init " << initTime << "s, ";
+    std::cout << stepsPerSecond << " steps/s, " << synapticEventsPerSecond << " synaptic events/s" << std::endl;
+
+    // Append record to results file
+    std::ofstream results(argv[5], std::ios::app);
+    if(!results.good()) {
+        std::cerr << "Unable to open '" << argv[5] << "'" << std::endl;
+        return EXIT_FAILURE;
+    }
+    results << "{\"model\": \"" << modelName << "\", \"scale\": " << scale << ", \"timesteps\": " << numTimesteps;
+    results << ", \"initTime\": " << initTime << ", \"simTime\": " << simTime << ", \"stepsPerSecond\": " << stepsPerSecond;
+    results << ", \"spikes\": " << numSpikes << ", \"synapticEvents\": " << numSynapticEvents;
+    results << ", \"synapticEventsPerSecond\": " << synapticEventsPerSecond << "}" << std::endl;
+    return EXIT_SUCCESS;
+#endif
+}
@@ -0,0 +1,46 @@
+"""Compare benchmark results written by run_benchmarks.sh against a baseline
+
+Exits with a non-zero status if any model's simulation or initialisation
+performance has regressed by more than the tolerance
+"""
+import json
+import sys
+from argparse import ArgumentParser
+
+
+def load_results(filename):
+    with open(filename, "r") as f:
+        return {(r["model"], r["scale"]): r for r in json.load(f)}
+
+
+parser = ArgumentParser(description="Compare benchmark results against a baseline")
+parser.add_argument("baseline", help="Baseline results file")
+parser.add_argument("current", help="Current results file")
+parser.add_argument("--tolerance", type=float, default=0.1,
+                    help="Fractional slowdown allowed before reporting a regression")
+args = parser.parse_args()
+
+baseline = load_results(args.baseline)
+current = load_results(args.current)
+
+regressions = []
+for key, result in sorted(current.items()):
+    if key not in baseline:
+        print("%s (scale %s): no baseline" % key)
+        continue
+
+    # Compare throughput (higher is better) and initialisation time (lower is better)
+    # **NOTE** initialisation times below 10ms are too noisy to compare
+    base = baseline[key]
+    step_ratio = result["stepsPerSecond"] / base["stepsPerSecond"]
+    init_ratio = base["initTime"] / result["initTime"] if base["initTime"] >= 0.01 else 1.0
+    print("%s (scale %s): %.2fx steps per second, %.2fx initialisation speed" % (key + (step_ratio, init_ratio)))
+
+    if step_ratio < (1.0 - args.tolerance):
+        regressions.append("%s (scale %s) steps per second" % key)
+    if init_ratio < (1.0 - args.tolerance):
+        regressions.append("%s (scale %s) initialisation time" % key)
+
+if regressions:
+    print("Regressions: " + ", ".join(regressions))
+    sys.exit(1)
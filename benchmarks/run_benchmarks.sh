@@ -0,0 +1,150 @@
+#!/bin/bash
+# By default benchmark each model at three scales for 2000 timesteps
+SCALES="1 2 4"
+NUM_TIMESTEPS=2000
+RESULTS="$PWD/benchmark_results.json"
+BASELINE=""
+TOLERANCE=0.1
+
+# Parse command line arguments
+OPTIND=1
+while getopts "s:n:o:b:r:h" opt; do
+    case "$opt" in
+    s)  SCALES="$OPTARG";;
+    n)  NUM_TIMESTEPS="$OPTARG";;
+    o)  RESULTS="$OPTARG";;
+    b)  BASELINE="$OPTARG";;
+    r)  TOLERANCE="$OPTARG";;
+    h)  echo "usage: run_benchmarks.sh [-s \"<scales>\"] [-n <timesteps>] [-o <results file>] [-b <baseline results file>] [-r <tolerance>]"
+        exit 0;;
+    *)  exit 1;;
+    esac
+done
+
+# Find this script i.e. benchmarks directory and hence GeNN itself
+BENCHMARKS_DIR=$(cd "$(dirname "$0")" && pwd)
+GENN_PATH=$BENCHMARKS_DIR/..
+USERPROJECT_PATH=$GENN_PATH/userproject
+WORK_DIR=$BENCHMARKS_DIR/work
+RECORDS=$WORK_DIR/records.jsonl
+
+# Use genn-buildmodel.sh from this copy of GeNN
+export PATH=$GENN_PATH/bin:$PATH
+
+# Write sizes header with default precision and timing followed by model-specific defines from standard input
+write_sizes() {
+    echo "#pragma once"
+    echo "#define _FTYPE GENN_FLOAT"
+    echo "#define _TIMING 0"
+    cat
+}
+
+# Generate and build model definition $1 on single-threaded CPU backend in current directory, then build benchmark driver
+# **NOTE** model sizes header is found in $DIR
+build_benchmark() {
+    genn-buildmodel.sh -c $1 &> build.log \
+        && make -C ${MODEL}_CODE &>> build.log \
+        && ${CXX:-g++} -O3 -std=c++11 -I. -I$DIR -I$BENCHMARKS_DIR $BENCHMARKS_DIR/$MODEL.cc -o benchmark -L${MODEL}_CODE -lrunner -Wl,-rpath ${MODEL}_CODE &>> build.log
+}
+
+# Generate, build and run benchmark of model $1 at scale $2 with model definition in directory $3
+# **NOTE** model sizes header is read from standard input and written to file $4
+run_benchmark() {
+    MODEL=$1
+    local SCALE=$2
+    DIR=$WORK_DIR/${MODEL}_$SCALE
+
+    # Copy model into clean working directory and write sizes
+    rm -rf $DIR
+    mkdir -p $DIR/profiled
+    cp $3/*.cc $DIR
+    cp $3/*.h $DIR 2>/dev/null
+    if [ -n "$4" ]; then
+        write_sizes > $DIR/$4
+    fi
+
+    # Wrap model definition to enable profiling so synaptic events can be counted
+    # **NOTE** profiling adds counters to the generated code so this is built and run separately from the timed model
+    cat > $DIR/profiled/ProfiledModel.cc << EOF
+#define modelDefinition benchmarkedModelDefinition
+#include "../$MODEL.cc"
+#undef modelDefinition
+
+void modelDefinition(ModelSpec &model)
+{
+    benchmarkedModelDefinition(model);
+    model.setProfiling(true);
+}
+EOF
+
+    # Count events with profiled model and then time unmodified model
+    pushd $DIR/profiled > /dev/null
+    if ! build_benchmark ProfiledModel.cc; then
+        echo "Building profiled $MODEL at scale $SCALE failed - see $DIR/profiled/build.log"
+        FAILED+=("${MODEL}_$SCALE")
+    elif ! ./benchmark $MODEL $SCALE $NUM_TIMESTEPS $DIR/counts.txt $RECORDS; then
+        FAILED+=("${MODEL}_$SCALE")
+    elif ! (cd $DIR && build_benchmark $MODEL.cc); then
+        echo "Building $MODEL at scale $SCALE failed - see $DIR/build.log"
+        FAILED+=("${MODEL}_$SCALE")
+    else
+        (cd $DIR && ./benchmark $MODEL $SCALE $NUM_TIMESTEPS $DIR/counts.txt $RECORDS) || FAILED+=("${MODEL}_$SCALE")
+    fi
+    popd > /dev/null
+}
+
+FAILED=()
+mkdir -p $WORK_DIR
+rm -f $RECORDS
+
+for SCALE in $SCALES; do
+    run_benchmark MBody1 $SCALE $USERPROJECT_PATH/MBody1_project/model sizes.h << EOF
+#define _NAL $((100 * SCALE))
+#define _NKC $((1000 * SCALE))
+#define _NLHI $((20 * SCALE))
+#define _NDN $((100 * SCALE))
+#define _GScale 0.0025
+EOF
+
+    run_benchmark IzhSparse $SCALE $USERPROJECT_PATH/Izh_sparse_project/model sizes.h << EOF
+#define _NNeurons $((10000 * SCALE))
+#define _NConn 1000
+#define _GScale 1.0
+#define _InputFac 1.0
+EOF
+
+    run_benchmark PoissonIzh $SCALE $USERPROJECT_PATH/PoissonIzh_project/model sizes.h << EOF
+#define _NPoisson $((1000 * SCALE))
+#define _NIzh $((100 * SCALE))
+#define _PConn 0.5
+#define _GScale 2.0
+EOF
+
+    run_benchmark OneComp $SCALE $USERPROJECT_PATH/OneComp_project/model sizes.h << EOF
+#define _NN $((10000 * SCALE))
+EOF
+
+    run_benchmark HHVClamp $SCALE $USERPROJECT_PATH/HHVclampGA_project/model HHVClampParameters.h << EOF
+#define NPOP $((1000 * SCALE))
+#define TOTALT 0.0
+EOF
+done
+
+# **NOTE** SynDelay has fixed population sizes so is only benchmarked at scale 1
+run_benchmark SynDelay 1 $USERPROJECT_PATH/SynDelay_project < /dev/null
+
+# Combine records into a single JSON array
+if [ -f $RECORDS ]; then
+    (echo "["; sed '$!s/$/,/' $RECORDS; echo "]") > $RESULTS
+    echo "Results written to $RESULTS"
+fi
+
+# Compare against baseline if one was provided
+if [ -n "$BASELINE" ]; then
+    python3 $BENCHMARKS_DIR/compare_benchmarks.py "$BASELINE" "$RESULTS" --tolerance $TOLERANCE || FAILED+=("baseline comparison")
+fi
+
+if [ ${#FAILED[@]} -ne 0 ]; then
+    echo "Failed: ${FAILED[@]}"
+    exit 1
+fi
@@ -410,6 +410,11 @@ def generateBackend(swigPath, folder, namespace):
         mg.addSwigIgnore("BackendBase")
         mg.addSwigInclude('"code_generator/backendBase.h"')
 
+        # If this is a CPU backend, also parse shared CPU backend, ignoring BackendCPU itself to get PreferencesCPU definition
+        if folder.endswith("_cpu"):
+            mg.addSwigIgnore("BackendCPU")
+            mg.addSwigInclude('"code_generator/backendCPU.h"')
+
         # Parse backend, ignore Backend itself to get PreferencesBase definition
         mg.addSwigIgnore("Backend")
         mg.addSwigInclude('"backend.h"')
@@ -487,6 +492,7 @@ def generateConfigs(gennPath, backends):
         pygennSmg.addSwigModuleHeadline()
         with SwigAsIsScope( pygennSmg ):
             pygennSmg.addCppInclude( '<fstream>' )
+            pygennSmg.addCppInclude( '<sstream>' )
             pygennSmg.addCppInclude( '<plog/Appenders/ConsoleAppender.h>' )
             pygennSmg.addCppInclude( '"logging.h"' )
             pygennSmg.addCppInclude( '"variableMode.h"' )
@@ -534,8 +540,10 @@ def generateConfigs(gennPath, backends):
                 CodeGenerator::generateMSBuild(makefile, backend, "", moduleNames);
             #else
                 // Create makefile to compile and link all generated modules
-                std::ofstream makefile((outputPath / "Makefile").str());
-                CodeGenerator::generateMakefile(makefile, backend, moduleNames);
+                std::ostringstream makefile;
+                CodeGenerator::generateMakefile(makefile, backend, moduleNames,
+                                                CodeGenerator::getBuildCacheKey(backend, outputPath, moduleNames));
+                CodeGenerator::writeFileIfChanged(outputPath / "Makefile", makefile.str());
             #endif
             }
             ''' )
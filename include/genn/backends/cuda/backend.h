@@ -232,6 +232,10 @@ public:
     //! How many bytes of memory does 'device' have
     virtual size_t getDeviceMemoryBytes() const override{ return m_ChosenDevice.totalGlobalMem; }
 
+    virtual bool isCheckpointSupported() const override{ return false; }
+    virtual bool isLatestDelayedStateSupported() const override{ return false; }
+    virtual std::vector<std::pair<std::string, std::string>> getCheckpointGlobals(const ModelSpecMerged &) const override{ return {}; }
+
     //--------------------------------------------------------------------------
     // Public API
     //--------------------------------------------------------------------------
@@ -0,0 +1,82 @@
+#pragma once
+
+// Standard C++ includes
+#include <string>
+
+// GeNN includes
+#include "backendExport.h"
+
+// GeNN code generator includes
+#include "code_generator/backendCPU.h"
+
+// Forward declarations
+namespace filesystem
+{
+    class path;
+}
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Preferences
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace MultiThreadedCPU
+{
+//! Preferences for multi-threaded CPU backend
+struct Preferences : public PreferencesCPU
+{
+    //! How many threads should the generated code's thread pool use (0 uses all hardware threads)
+    unsigned int numThreads = 0;
+
+    //! Initialise host arrays in parallel across the thread pool when they are allocated
+    /*! Arrays are split into the same contiguous chunks used by the generated parallel loops so,
+        on NUMA systems, each page is placed on the node of the thread which will mostly access it */
+    bool enableNUMAFirstTouch = false;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Backend
+//--------------------------------------------------------------------------
+//! Backend which splits neuron updates, spike processing and connectivity initialisation
+//! across a persistent pool of threads in the generated code
+class BACKEND_EXPORT Backend : public BackendCPU
+{
+public:
+    Backend(const std::string &scalarType, const Preferences &preferences)
+    :   BackendCPU(scalarType), m_Preferences(preferences)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // CodeGenerator::BackendBase virtuals
+    //--------------------------------------------------------------------------
+    virtual void genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+
+    virtual MemAlloc genVariableAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const override;
+
+protected:
+    //--------------------------------------------------------------------------
+    // CodeGenerator::BackendCPU virtuals
+    //--------------------------------------------------------------------------
+    virtual const PreferencesCPU &getPreferences() const override{ return m_Preferences; }
+
+    virtual void genParallelFor(CodeStream &os, const std::string &index, const std::string &count,
+                                ParallelLoop loop, bool simd, RangeHandler preambleHandler, HostHandler bodyHandler) const override;
+
+    virtual std::string getAtomicAdd(const std::string &lvalue, const std::string &value, const std::string &type) const override;
+    virtual std::string getAtomicIncrement(const std::string &lvalue) const override;
+    virtual std::string getAtomicOr(const std::string &lvalue, const std::string &value) const override;
+
+    virtual bool isMultiThreaded() const override{ return true; }
+
+private:
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    const Preferences m_Preferences;
+};
+}   // namespace MultiThreadedCPU
+}   // namespace CodeGenerator
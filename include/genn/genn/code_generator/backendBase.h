@@ -56,6 +56,10 @@ struct PreferencesBase
 
     //! Logging level to use for code generation
     plog::Severity logLevel = plog::info;
+
+    //! Shared directory in which to cache compiled runners, keyed on a hash of the generated code and build configuration
+    /*! Can also be set using the GENN_BUILD_CACHE environment variable when building the generated code */
+    std::string buildCacheDirectory = "";
 };
 
 //--------------------------------------------------------------------------
@@ -143,7 +147,9 @@ public:
     /*! \param os                       CodeStream to write function to
         \param model                    merged model to generate code for
         \param simHandler               callback to write platform-independent code to update an individual NeuronGroup
-        \param wuVarUpdateHandler       callback to write platform-independent code to update pre and postsynaptic weight update model variables when neuron spikes*/
+        \param wuVarUpdateHandler       callback to write platform-independent code to update pre and postsynaptic weight update model variables when neuron spikes
+        \param pushEGPHandler           callback to write code to push scalar extra global parameters.
+                                        This should be written to a pushNeuronUpdateEGPs function and the update itself to updateNeuronsInternal*/
     virtual void genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                                  NeuronGroupSimHandler simHandler, NeuronGroupMergedHandler wuVarUpdateHandler,
                                  HostHandler pushEGPHandler) const = 0;
@@ -165,7 +171,9 @@ public:
                                             "id_pre", "id_post" and "id_syn" variables will be provided to callback via Substitutions.
         \param synapseDynamicsHandler       callback to write platform-independent code to update time-driven synapse dynamics.
                                             "id_pre", "id_post" and "id_syn" variables; and either "addToInSynDelay" or "addToInSyn" function will be provided
-                                            to callback via Substitutions.*/
+                                            to callback via Substitutions.
+        \param pushEGPHandler               callback to write code to push scalar extra global parameters.
+                                            This should be written to a pushSynapseUpdateEGPs function and the update itself to updateSynapsesInternal*/
     virtual void genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                                   SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
                                   SynapseGroupMergedHandler wumEventHandler, SynapseGroupMergedHandler wumProceduralConnectHandler,
@@ -308,6 +316,16 @@ public:
     //! How many bytes of memory does 'device' have
     virtual size_t getDeviceMemoryBytes() const = 0;
 
+    //! Is all model state directly accessible in host memory so it can be checkpointed by saveState and restored by loadState?
+    virtual bool isCheckpointSupported() const = 0;
+
+    //! Can delayed spike times and spike-triggered weight update model variables only be written to the delay slots of neurons which spike?
+    /*! This requires generated code to compare the current timestep (iT) with the timestep of each neuron's latest spike */
+    virtual bool isLatestDelayedStateSupported() const = 0;
+
+    //! Get type and name of any backend-specific global variables (such as RNG seeds) which need checkpointing alongside model state
+    virtual std::vector<std::pair<std::string, std::string>> getCheckpointGlobals(const ModelSpecMerged &modelMerged) const = 0;
+
     //--------------------------------------------------------------------------
     // Public API
     //--------------------------------------------------------------------------
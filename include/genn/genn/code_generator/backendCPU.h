@@ -0,0 +1,214 @@
+#pragma once
+
+// Standard C++ includes
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// GeNN includes
+#include "gennExport.h"
+
+// GeNN code generator includes
+#include "code_generator/backendBase.h"
+
+//--------------------------------------------------------------------------
+// CodeGenerator::PreferencesCPU
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+//! Preferences shared by the backends which generate code for the CPU
+struct PreferencesCPU : public PreferencesBase
+{
+    //! Split neuron update into a state update pass, which the compiler can vectorise, followed by a pass which emits spikes
+    /*! This is only likely to be beneficial for large populations with simple, branch-free, neuron models. Populations whose
+        neuron variables are read by weight update model pre or postsynaptic spike code are still updated in a single pass */
+    bool enableSIMDNeuronUpdate = false;
+
+    //! Allocate host arrays with 64-byte alignment rather than with new[]
+    bool enableAlignedHostAllocation = false;
+
+    //! When aligned host allocation is enabled, advise the kernel to back large arrays with transparent huge pages
+    /*! Arrays spanning at least one huge page are aligned to huge page boundaries. This reduces TLB misses
+        when accessing large arrays such as sparse connectivity but only has an effect on Linux */
+    bool enableHugePages = false;
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::BackendCPU
+//--------------------------------------------------------------------------
+//! Base class for backends which generate code for the CPU
+/*! Derived backends decide how the loops marked as parallel are executed and how
+    updates shared between their iterations are made race-free */
+class GENN_EXPORT BackendCPU : public BackendBase
+{
+public:
+    BackendCPU(const std::string &scalarType)
+    :   BackendBase(scalarType)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // CodeGenerator::BackendBase virtuals
+    //--------------------------------------------------------------------------
+    virtual void genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
+                                 NeuronGroupSimHandler simHandler, NeuronGroupMergedHandler wuVarUpdateHandler,
+                                 HostHandler pushEGPHandler) const override;
+
+    virtual void genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
+                                  SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                                  SynapseGroupMergedHandler wumEventHandler, SynapseGroupMergedHandler wumProceduralConnectHandler,
+                                  SynapseGroupMergedHandler postLearnHandler, SynapseGroupMergedHandler synapseDynamicsHandler,
+                                  HostHandler pushEGPHandler) const override;
+
+    virtual void genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
+                         NeuronGroupMergedHandler localNGHandler, SynapseGroupMergedHandler sgDenseInitHandler,
+                         SynapseGroupMergedHandler sgSparseConnectHandler, SynapseGroupMergedHandler sgSparseInitHandler,
+                         HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const override;
+
+    virtual size_t getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const override;
+
+    virtual void genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genStepTimeFinalisePreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+
+    virtual void genVariableDefinition(CodeStream &definitions, CodeStream &definitionsInternal, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genVariableImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual MemAlloc genVariableAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const override;
+    virtual void genVariableFree(CodeStream &os, const std::string &name, VarLocation loc) const override;
+
+    virtual void genExtraGlobalParamDefinition(CodeStream &definitions, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genExtraGlobalParamImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genExtraGlobalParamAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genExtraGlobalParamPush(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genExtraGlobalParamPull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+
+    //! Generate code for declaring merged group data to the 'device'
+    virtual void genMergedGroupImplementation(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const override;
+
+    //! Generate code for pushing merged group data to the 'device'
+    virtual void genMergedGroupPush(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const override;
+
+    //! Generate code for pushing an updated EGP value into the merged group structure on 'device'
+    virtual void genMergedExtraGlobalParamPush(CodeStream &os, const std::string &suffix, size_t mergedGroupIdx, size_t groupIdx,
+                                               const std::string &fieldName, const std::string &egpName) const override;
+
+    virtual void genPopVariableInit(CodeStream &os,const Substitutions &kernelSubs, Handler handler) const override;
+    virtual void genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
+                                 const Substitutions &kernelSubs, Handler handler) const override;
+    virtual void genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMerged &sg,
+                                           const Substitutions &kernelSubs, Handler handler) const override;
+
+    virtual void genVariablePush(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, bool autoInitialized, size_t count) const override;
+    virtual void genVariablePull(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const override;
+    virtual void genCurrentVariablePush(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genCurrentVariablePull(CodeStream &os, const NeuronGroupInternal &ng, const std::string &type, const std::string &name, VarLocation loc) const override;
+
+    virtual void genCurrentTrueSpikePush(CodeStream &os, const NeuronGroupInternal &ng) const override;
+    virtual void genCurrentTrueSpikePull(CodeStream &os, const NeuronGroupInternal &ng) const override;
+    virtual void genCurrentSpikeLikeEventPush(CodeStream &os, const NeuronGroupInternal &ng) const override;
+    virtual void genCurrentSpikeLikeEventPull(CodeStream &os, const NeuronGroupInternal &ng) const override;
+
+    virtual MemAlloc genGlobalRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free) const override;
+    virtual MemAlloc genPopulationRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
+                                      const std::string &name, size_t count) const override;
+    virtual void genTimer(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
+                          CodeStream &stepTimeFinalise, const std::string &name, bool updateInStepTime) const override;
+
+    virtual void genMakefilePreamble(std::ostream &os) const override;
+    virtual void genMakefileLinkRule(std::ostream &os) const override;
+    virtual void genMakefileCompileRule(std::ostream &os) const override;
+
+    virtual void genMSBuildConfigProperties(std::ostream &os) const override;
+    virtual void genMSBuildImportProps(std::ostream &os) const override;
+    virtual void genMSBuildItemDefinitions(std::ostream &os) const override;
+    virtual void genMSBuildCompileModule(const std::string &moduleName, std::ostream &os) const override;
+    virtual void genMSBuildImportTarget(std::ostream &os) const override;
+
+    virtual std::string getArrayPrefix() const override{ return ""; }
+    virtual std::string getScalarPrefix() const override{ return ""; }
+
+    virtual bool isGlobalRNGRequired(const ModelSpecMerged &modelMerged) const override;
+    virtual bool isPopulationRNGRequired() const override { return false; }
+    virtual bool isSynRemapRequired() const override{ return false; }
+    virtual bool isPostsynapticRemapRequired() const override{ return true; }
+
+    //! Is automatic copy mode enabled in the preferences?
+    virtual bool isAutomaticCopyEnabled() const override { return getPreferences().automaticCopy; }
+
+    //! How many bytes of memory does 'device' have
+    virtual size_t getDeviceMemoryBytes() const override{ return 0; }
+
+    virtual bool isCheckpointSupported() const override{ return true; }
+    virtual bool isLatestDelayedStateSupported() const override{ return true; }
+    virtual std::vector<std::pair<std::string, std::string>> getCheckpointGlobals(const ModelSpecMerged &modelMerged) const override;
+
+    //--------------------------------------------------------------------------
+    // Public API
+    //--------------------------------------------------------------------------
+    //! Get the number of bytes gennAllocateHost actually allocates for an array of the given size
+    /*! Arrays are padded to a non-zero multiple of their alignment */
+    static size_t getHostAllocationSize(size_t bytes, bool hugePages);
+
+    //! Get the alignment gennAllocateHost uses for an array of the given size
+    static size_t getHostAllocationAlignment(size_t bytes, bool hugePages);
+
+protected:
+    //--------------------------------------------------------------------------
+    // ParallelLoop
+    //--------------------------------------------------------------------------
+    //! What each iteration of a loop generated with genParallelFor processes
+    /*! Derived backends use this to decide how many iterations it's worth handing to a thread */
+    enum class ParallelLoop
+    {
+        NEURON,     //!< Loop over neurons in a population
+        ROW,        //!< Loop over rows of a synaptic matrix
+        SPIKE,      //!< Loop over spikes, each of which processes a row or column of a synaptic matrix
+    };
+
+    //--------------------------------------------------------------------------
+    // Typedefines
+    //--------------------------------------------------------------------------
+    //! Handler used to generate code which processes the [begin, end) range of a parallel loop
+    typedef std::function<void(CodeStream &, const std::string &, const std::string &)> RangeHandler;
+
+    //--------------------------------------------------------------------------
+    // Declared virtuals
+    //--------------------------------------------------------------------------
+    //! Get CPU preferences
+    virtual const PreferencesCPU &getPreferences() const = 0;
+
+    //! Generate a loop of index over [0, count) whose iterations are independent and may be executed in parallel
+    /*! Optional preamble handler generates code for each contiguous range of iterations before it is looped over.
+        If simd is set, the loop is annotated so the compiler vectorises it */
+    virtual void genParallelFor(CodeStream &os, const std::string &index, const std::string &count,
+                                ParallelLoop loop, bool simd, RangeHandler preambleHandler, HostHandler bodyHandler) const = 0;
+
+    //! Get expression to add value of type to lvalue, which other iterations of parallel loops may also update
+    virtual std::string getAtomicAdd(const std::string &lvalue, const std::string &value, const std::string &type) const = 0;
+
+    //! Get expression to increment unsigned int lvalue, which other iterations of parallel loops may also
+    //! update, and evaluate to its previous value
+    virtual std::string getAtomicIncrement(const std::string &lvalue) const = 0;
+
+    //! Get expression to bitwise OR uint32_t value into lvalue, which other iterations of parallel loops may also update
+    virtual std::string getAtomicOr(const std::string &lvalue, const std::string &value) const = 0;
+
+    //! Are iterations of parallel loops executed by more than one thread?
+    virtual bool isMultiThreaded() const = 0;
+
+private:
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+    void genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                              bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                              SynapseGroupMergedHandler wumProceduralConnectHandler) const;
+
+    void genEmitSpike(CodeStream &os, const NeuronGroupMerged &ng, const Substitutions &subs, bool trueSpike, unsigned int batchSize) const;
+
+    void genProfileAdd(CodeStream &os, size_t profileIndex, const std::string &counter, const std::string &value) const;
+};
+}   // namespace CodeGenerator
@@ -83,12 +83,14 @@ typedef std::map<std::string, std::unordered_multimap<std::string, MergedEGP>> M
 void substitute(std::string &s, const std::string &trg, const std::string &rep);
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting variable  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting variable names in the neuron code strings or other templates
+/*! trg is matched literally and only where it isn't part of a longer identifier */
 //--------------------------------------------------------------------------
 bool regexVarSubstitute(std::string &s, const std::string &trg, const std::string &rep);
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting function names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting function names in the neuron code strings or other templates
+/*! trg is matched literally and only where it isn't part of a longer identifier and is followed by an open bracket */
 //--------------------------------------------------------------------------
 bool regexFuncSubstitute(std::string &s, const std::string &trg, const std::string &rep);
 
@@ -156,7 +158,25 @@ inline size_t padSize(size_t size, size_t blockSize)
     return ceilDivide(size, blockSize) * blockSize;
 }
 
-GENN_EXPORT void genMergedGroupSpikeCountReset(CodeStream &os, const NeuronGroupMerged &n);
+//! Get expression to index variable of a batched model within a loop over batches
+/*! Variables are stored with the batch as the innermost dimension so each element's batches are contiguous */
+inline std::string getBatchedVarIndex(unsigned int batchSize, const std::string &index)
+{
+    return (batchSize == 1) ? index : ("(((" + index + ") * " + std::to_string(batchSize) + ") + batch)");
+}
+
+//! Get expression to offset index into spike array of a batched model within a loop over batches
+/*! Spike counts, spikes and spike recording buffers are stored one batch after another, each batchStride elements long */
+inline std::string getBatchOffset(unsigned int batchSize, const std::string &batchStride)
+{
+    return (batchSize == 1) ? "" : ("(batch * " + batchStride + ") + ");
+}
+
+//! Generate a loop over the batches of a batched model around the code generated by handler
+/*! If the model isn't batched, the code is generated without a loop so it doesn't refer to batch */
+GENN_EXPORT void genBatchLoop(CodeStream &os, unsigned int batchSize, BackendBase::HostHandler handler);
+
+GENN_EXPORT void genMergedGroupSpikeCountReset(CodeStream &os, const NeuronGroupMerged &n, unsigned int batchSize = 1);
 
 template<typename T>
 void genMergedGroupPush(CodeStream &os, const std::vector<T> &groups, const MergedEGPMap &mergedEGPs,
@@ -228,6 +248,39 @@ std::string ensureFtype(const std::string &oldcode, const std::string &type);
 //--------------------------------------------------------------------------
 void checkUnreplacedVariables(const std::string &code, const std::string &codeName);
 
+//--------------------------------------------------------------------------
+//! \brief Get the type used to store a variable of the specified type in memory
+//--------------------------------------------------------------------------
+GENN_EXPORT std::string getVarStorageType(VarStorage storage, const std::string &type);
+
+//--------------------------------------------------------------------------
+//! \brief Get expression converting a value read from memory in storage format into the variable's type
+//--------------------------------------------------------------------------
+GENN_EXPORT std::string getVarStorageLoad(VarStorage storage, double scale, const std::string &type, const std::string &value);
+
+//--------------------------------------------------------------------------
+//! \brief Get expression converting a value of the variable's type into storage format, ready to be written to memory
+//--------------------------------------------------------------------------
+GENN_EXPORT std::string getVarStorageStore(VarStorage storage, double scale, const std::string &value);
+
+//--------------------------------------------------------------------------
+//! \brief Write inline functions used to convert to and from reduced-precision storage formats
+//--------------------------------------------------------------------------
+GENN_EXPORT void genVarStorageConversions(CodeStream &os);
+
+//--------------------------------------------------------------------------
+/*! \brief Get expression to read spike-triggered variable which is only written to the delay slots of neurons which spike
+    
+    If the neuron has spiked since the delay slot being read was written, the value is read from the delay slot. 
+    Otherwise, it will not have changed since the neuron's latest spike so the latest value is read instead.
+    Whether the neuron has spiked since is determined by comparing the current timestep (iT) with that of its latest spike.
+ */
+//--------------------------------------------------------------------------
+GENN_EXPORT std::string getLatestDelayedVar(const std::string &var, const std::string &latestVar, const std::string &latestSpikeTimestep,
+                                            const std::string &offset, const std::string &idx, unsigned int delaySteps,
+                                            const std::string &varPrefix = "", const std::string &varSuffix = "",
+                                            unsigned int batchSize = 1);
+
 void neuronSubstitutionsInSynapticCode(
     CodeGenerator::Substitutions &substitutions,
     const NeuronGroupInternal *ng,
@@ -237,7 +290,10 @@ void neuronSubstitutionsInSynapticCode(
     const std::string &sourceSuffix,
     const std::string &destSuffix,
     const std::string &varPrefix = "",  //!< prefix to be used for variable accesses - typically combined with suffix to wrap in function call such as __ldg(&XXX)
-    const std::string &varSuffix = ""); //!< suffix to be used for variable accesses - typically combined with prefix to wrap in function call such as __ldg(&XXX)
+    const std::string &varSuffix = "",  //!< suffix to be used for variable accesses - typically combined with prefix to wrap in function call such as __ldg(&XXX)
+    unsigned int delaySteps = 0,        //!< number of timesteps the delay slot being accessed is behind the latest one
+    bool latestDelayedStateSupported = false,   //!< can delayed spike-triggered state only be written to the delay slots of neurons which spike?
+    unsigned int batchSize = 1);        //!< number of batches variables are duplicated for
 
 //-------------------------------------------------------------------------
 /*!
@@ -253,5 +309,7 @@ void neuronSubstitutionsInSynapticCode(
     const std::string &preVarPrefix = "",    //!< prefix to be used for presynaptic variable accesses - typically combined with suffix to wrap in function call such as __ldg(&XXX)
     const std::string &preVarSuffix = "",    //!< suffix to be used for presynaptic variable accesses - typically combined with prefix to wrap in function call such as __ldg(&XXX)
     const std::string &postVarPrefix = "",   //!< prefix to be used for postsynaptic variable accesses - typically combined with suffix to wrap in function call such as __ldg(&XXX)
-    const std::string &postVarSuffix = "");  //!< suffix to be used for postsynaptic variable accesses - typically combined with prefix to wrap in function call such as __ldg(&XXX)
+    const std::string &postVarSuffix = "",   //!< suffix to be used for postsynaptic variable accesses - typically combined with prefix to wrap in function call such as __ldg(&XXX)
+    unsigned int batchSize = 1,              //!< number of batches variables are duplicated for
+    bool latestDelayedStateSupported = false);   //!< can delayed spike-triggered state only be written to the delay slots of neurons which spike?
 }   // namespace CodeGenerator
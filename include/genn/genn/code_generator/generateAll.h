@@ -25,5 +25,16 @@ namespace filesystem
 //--------------------------------------------------------------------------
 namespace CodeGenerator
 {
+    //! Generate all code for model into outputPath, only overwriting files whose contents have changed
     GENN_EXPORT std::vector<std::string> generateAll(const ModelSpecInternal &model, const BackendBase &backend, const filesystem::path &outputPath, bool standaloneModules=false);
+
+    //! Write contents to path unless an existing file has identical contents, returning true if file was written
+    /*! Leaving unchanged files untouched preserves their timestamps so make doesn't rebuild them */
+    GENN_EXPORT bool writeFileIfChanged(const filesystem::path &path, const std::string &contents);
+
+    //! Hash the code generated in outputPath along with the backend's build configuration
+    /*! The resulting key addresses the compiled runner in a shared build cache. The generated
+        Makefile further qualifies this with the compiler version and flags used to build the runner */
+    GENN_EXPORT std::string getBuildCacheKey(const BackendBase &backend, const filesystem::path &outputPath,
+                                             const std::vector<std::string> &moduleNames);
 }
@@ -20,6 +20,10 @@ class BackendBase;
 //--------------------------------------------------------------------------
 namespace CodeGenerator
 {
+//! Generate makefile to build moduleNames into librunner.so
+/*! If buildCacheKey is provided, the runner is also looked up in (and, after building, copied to) a
+    content-addressed cache directory, specified by buildCacheDirectory or the GENN_BUILD_CACHE environment variable */
 void GENN_EXPORT generateMakefile(std::ostream &os, const BackendBase &backend,
-                                  const std::vector<std::string> &moduleNames);
+                                  const std::vector<std::string> &moduleNames,
+                                  const std::string &buildCacheKey = "", const std::string &buildCacheDirectory = "");
 }
@@ -62,6 +62,21 @@ public:
     //! Get merged synapse groups which require their dendritic delay updating
     const std::vector<SynapseGroupMerged> &getMergedSynapseDendriticDelayUpdateGroups() const { return m_MergedSynapseDendriticDelayUpdateGroups; }
 
+    //! Get index of first merged neuron update group in array of merged group profiles
+    size_t getNeuronUpdateProfileOffset() const{ return 0; }
+
+    //! Get index of first merged synapse dynamics group in array of merged group profiles
+    size_t getSynapseDynamicsProfileOffset() const{ return getNeuronUpdateProfileOffset() + m_MergedNeuronUpdateGroups.size(); }
+
+    //! Get index of first merged presynaptic update group in array of merged group profiles
+    size_t getPresynapticUpdateProfileOffset() const{ return getSynapseDynamicsProfileOffset() + m_MergedSynapseDynamicsGroups.size(); }
+
+    //! Get index of first merged postsynaptic update group in array of merged group profiles
+    size_t getPostsynapticUpdateProfileOffset() const{ return getPresynapticUpdateProfileOffset() + m_MergedPresynapticUpdateGroups.size(); }
+
+    //! Get total number of merged group profiles
+    size_t getNumProfiles() const{ return getPostsynapticUpdateProfileOffset() + m_MergedPostsynapticUpdateGroups.size(); }
+
     void genNeuronUpdateGroupSupportCode(CodeStream &os) const{ m_NeuronUpdateSupportCode.gen(os, getModel().getPrecision()); }
 
     void genPostsynapticDynamicsSupportCode(CodeStream &os) const{ m_PostsynapticDynamicsSupportCode.gen(os, getModel().getPrecision()); }
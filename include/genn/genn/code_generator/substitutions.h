@@ -9,6 +9,7 @@
 #include <cassert>
 
 // GeNN includes
+#include "gennExport.h"
 #include "logging.h"
 
 // GeNN code generator includes
@@ -19,7 +20,7 @@
 //--------------------------------------------------------------------------
 namespace CodeGenerator
 {
-class Substitutions
+class GENN_EXPORT Substitutions
 {
 public:
     Substitutions(const Substitutions *parent = nullptr) : m_Parent(parent)
@@ -114,7 +115,15 @@ public:
 
     bool hasVarSubstitution(const std::string &source) const
     {
-        return (m_VarSubstitutions.find(source) != m_VarSubstitutions.end());
+        if(m_VarSubstitutions.find(source) != m_VarSubstitutions.end()) {
+            return true;
+        }
+        else if(m_Parent) {
+            return m_Parent->hasVarSubstitution(source);
+        }
+        else {
+            return false;
+        }
     }
 
     const std::string &getVarSubstitution(const std::string &source) const
@@ -131,13 +140,10 @@ public:
         }
     }
 
-    void apply(std::string &code) const
-    {
-        // Apply function and variable substitutions
-        // **NOTE** functions may contain variables so evaluate ALL functions first
-        applyFuncs(code);
-        applyVars(code);
-    }
+    //! Resolve all variable and function substitutions in code
+    /*! Code is scanned once for $(name) and $(name, args...) references, each of which is resolved against this
+        and then parent substitutions - functions taking priority over variables - and the result rescanned */
+    void apply(std::string &code) const;
 
     void applyCheckUnreplaced(std::string &code, const std::string &context) const
     {
@@ -157,32 +163,14 @@ private:
     //--------------------------------------------------------------------------
     // Private API
     //--------------------------------------------------------------------------
-    void applyFuncs(std::string &code) const
-    {
-        // Apply function substitutions
-        for(const auto &f : m_FuncSubstitutions) {
-            functionSubstitute(code, f.first, f.second.first, f.second.second);
-        }
-
-        // If we have a parent, apply their function substitutions too
-        if(m_Parent) {
-            m_Parent->applyFuncs(code);
-        }
-    }
+    //! Find function substitution with this name, which takes arguments if hasArguments is set
+    const std::pair<unsigned int, std::string> *findFuncSubstitution(const std::string &source, bool hasArguments) const;
 
-    void applyVars(std::string &code) const
-    {
-        // Apply variable substitutions
-        for(const auto &v : m_VarSubstitutions) {
-            LOGD_CODE_GEN << "Substituting '$(" << v.first << ")' for '" << v.second << "'";
-            substitute(code, "$(" + v.first + ")", v.second);
-        }
+    //! Find variable substitution with this name
+    const std::string *findVarSubstitution(const std::string &source) const;
 
-        // If we have a parent, apply their variable substitutions too
-        if(m_Parent) {
-            m_Parent->applyVars(code);
-        }
-    }
+    //! Append code to output with all substitutions resolved
+    void applyInto(const std::string &code, std::string &output, unsigned int depth) const;
 
     //--------------------------------------------------------------------------
     // Members
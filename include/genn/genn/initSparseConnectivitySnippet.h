@@ -1,6 +1,7 @@
 #pragma once
 
 // Standard C++ includes
+#include <algorithm>
 #include <functional>
 #include <vector>
 
@@ -21,6 +22,8 @@
 #define SET_CALC_MAX_ROW_LENGTH_FUNC(FUNC) virtual CalcMaxLengthFunc getCalcMaxRowLengthFunc() const override{ return FUNC; }
 #define SET_CALC_MAX_COL_LENGTH_FUNC(FUNC) virtual CalcMaxLengthFunc getCalcMaxColLengthFunc() const override{ return FUNC; }
 
+#define SET_CALC_MAX_NUM_SYNAPSES_FUNC(FUNC) virtual CalcMaxNumSynapsesFunc getCalcMaxNumSynapsesFunc() const override{ return FUNC; }
+
 #define SET_MAX_ROW_LENGTH(MAX_ROW_LENGTH) virtual CalcMaxLengthFunc getCalcMaxRowLengthFunc() const override{ return [](unsigned int, unsigned int, const std::vector<double> &){ return MAX_ROW_LENGTH; }; }
 #define SET_MAX_COL_LENGTH(MAX_COL_LENGTH) virtual CalcMaxLengthFunc getCalcMaxColLengthFunc() const override{ return [](unsigned int, unsigned int, const std::vector<double> &){ return MAX_COL_LENGTH; }; }
 
@@ -39,6 +42,7 @@ public:
     // Typedefines
     //----------------------------------------------------------------------------
     typedef std::function<unsigned int(unsigned int, unsigned int, const std::vector<double> &)> CalcMaxLengthFunc;
+    typedef std::function<size_t(unsigned int, unsigned int, const std::vector<double> &)> CalcMaxNumSynapsesFunc;
     
     //----------------------------------------------------------------------------
     // Declared virtuals
@@ -52,6 +56,10 @@ public:
     //! Get function to calculate the maximum column length of this connector based on the parameters and the size of the pre and postsynaptic population
     virtual CalcMaxLengthFunc getCalcMaxColLengthFunc() const{ return CalcMaxLengthFunc(); }
 
+    //! Get function to calculate the maximum total number of synapses this connector will create based on the parameters and the size of the pre and postsynaptic population
+    /*! This is used to size arrays for synapse groups with SynapseMatrixConnectivity::CSR connectivity */
+    virtual CalcMaxNumSynapsesFunc getCalcMaxNumSynapsesFunc() const{ return CalcMaxNumSynapsesFunc(); }
+
     //! Gets names and types (as strings) of additional
     //! per-population parameters for the connection initialisation snippet
     virtual EGPVec getExtraGlobalParams() const{ return {}; }
@@ -144,6 +152,22 @@ public:
 
             return binomialInverseCDF(quantile, numPre, pars[0]);
         });
+    SET_CALC_MAX_NUM_SYNAPSES_FUNC(
+        [](unsigned int numPre, unsigned int numPost, const std::vector<double> &pars)
+        {
+            // Total number of synapses is drawn from a binomial distribution over all possible synapses
+            // **NOTE** binomialInverseCDF fails to converge for large numbers of trials
+            const double numPossible = (double)numPre * (double)numPost;
+            if(numPossible <= 100000.0) {
+                return (size_t)binomialInverseCDF(0.9999, (unsigned int)numPossible, pars[0]);
+            }
+            // Otherwise, use normal approximation, using 4 rather than 3.72 standard
+            // deviations above the mean to allow for the skew of the binomial distribution
+            else {
+                const double mean = numPossible * pars[0];
+                return (size_t)std::min(numPossible, std::ceil(mean + (4.0 * std::sqrt(mean * (1.0 - pars[0])))));
+            }
+        });
 };
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,72 @@
+#pragma once
+
+// Standard C++ includes
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// GeNN includes
+#include "gennExport.h"
+#include "snippet.h"
+
+//----------------------------------------------------------------------------
+// Models::LinearDynamics
+//----------------------------------------------------------------------------
+//! Describes a system of linear ODEs dx/dt = Ax + b which models can integrate exactly
+/*! A is a square matrix calculated from the model parameters and b is a vector of input terms,
+    given as code strings, which are held constant across each timestep e.g. $(Isyn) / $(C).
+    The propagator matrices P = exp(A dt) and Q = integral of exp(A s) ds from 0 to dt are
+    calculated at code generation time and provided as derived parameters so the exact update
+    x(t + dt) = Px(t) + Qb remains accurate at large timesteps. For example:
+    \code
+    const Models::LinearDynamics dynamics({"V", "A"},
+                                          [](const std::vector<double> &pars){ return std::vector<double>{-1.0 / pars[0], -1.0 / pars[0], 0.0, -1.0 / pars[1]}; },
+                                          {"$(Isyn) / $(C)", ""});
+
+    SET_SIM_CODE(dynamics.getUpdateCode() + "...");
+    SET_DERIVED_PARAMS(dynamics.getDerivedParams());
+    \endcode */
+namespace Models
+{
+class GENN_EXPORT LinearDynamics
+{
+public:
+    //! Function to calculate the row-major system matrix A from the model parameters
+    typedef std::function<std::vector<double>(const std::vector<double> &)> SystemMatrixFunc;
+
+    //! Create linear dynamics for vars with system matrix calculated by systemMatrix and inputs
+    /*! Empty inputs are treated as zero. prefix is used to name the derived parameters
+        and temporaries so models can combine several independent systems */
+    LinearDynamics(const std::vector<std::string> &vars, SystemMatrixFunc systemMatrix,
+                   const std::vector<std::string> &inputs, const std::string &prefix = "lin");
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Gets derived parameters containing the elements of the propagator matrices
+    //! These are named <prefix>P<row>_<column> and <prefix>Q<row>_<column>
+    Snippet::Base::DerivedParamVec getDerivedParams() const;
+
+    //! Gets code to advance the variables by one timestep
+    std::string getUpdateCode() const;
+
+    const std::vector<std::string> &getVars() const{ return m_Vars; }
+    const std::vector<std::string> &getInputs() const{ return m_Inputs; }
+
+    //------------------------------------------------------------------------
+    // Static API
+    //------------------------------------------------------------------------
+    //! Calculate row-major propagator matrices P and Q for n x n system matrix a and timestep dt
+    static std::pair<std::vector<double>, std::vector<double>> calcPropagators(const std::vector<double> &a, size_t n, double dt);
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    std::vector<std::string> m_Vars;
+    SystemMatrixFunc m_SystemMatrix;
+    std::vector<std::string> m_Inputs;
+    std::string m_Prefix;
+};
+}   // namespace Models
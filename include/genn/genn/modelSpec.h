@@ -27,6 +27,7 @@ Part of the code generation and generated code sections.
 #include <map>
 #include <set>
 #include <string>
+#include <stdexcept>
 #include <vector>
 
 // GeNN includes
@@ -142,9 +143,18 @@ public:
     //! Set whether timers and timing commands are to be included
     void setTiming(bool timingEnabled){ m_TimingEnabled = timingEnabled; }
 
+    //! Set whether wall time and event counts should be recorded for each merged group
+    /*! These can be read using the generated getProfile function or written to a JSON file using writeProfileJSON */
+    void setProfiling(bool profilingEnabled){ m_ProfilingEnabled = profilingEnabled; }
+
     //! Set the random seed (disables automatic seeding if argument not 0).
     void setSeed(unsigned int rngSeed){ m_Seed = rngSeed; }
 
+    //! Set how many independent copies of the model should be simulated together
+    /*! Each copy (batch) gets its own copy of every state variable, spike buffer and postsynaptic input
+        but sparse connectivity and extra global parameters are shared between all batches */
+    void setBatchSize(unsigned int batchSize);
+
     //! What is the default location for model state variables?
     /*! Historically, everything was allocated on both the host AND device */
     void setDefaultVarLocation(VarLocation loc){ m_DefaultVarLocation = loc; }
@@ -179,9 +189,15 @@ public:
     //! Get the random seed
     unsigned int getSeed() const { return m_Seed; }
 
+    //! Gets how many independent copies of the model are simulated together
+    unsigned int getBatchSize() const { return m_BatchSize; }
+
     //! Are timers and timing commands enabled
     bool isTimingEnabled() const{ return m_TimingEnabled; }
 
+    //! Is per-merged group profiling enabled
+    bool isProfilingEnabled() const{ return m_ProfilingEnabled; }
+
     // PUBLIC NEURON FUNCTIONS
     //========================
     //! How many neurons make up the entire model
@@ -255,7 +271,7 @@ public:
         \param postsynapticParamValues      parameters for postsynaptic model wrapped in PostsynapticModel::ParamValues object.
         \param postsynapticVarInitialisers  postsynaptic model state variable initialiser snippets and parameters wrapped in NeuronModel::VarValues object.
         \param connectivityInitialiser      sparse connectivity initialisation snippet used to initialise connectivity for
-                                            SynapseMatrixConnectivity::SPARSE or SynapseMatrixConnectivity::BITMASK.
+                                            SynapseMatrixConnectivity::SPARSE, SynapseMatrixConnectivity::CSR or SynapseMatrixConnectivity::BITMASK.
                                             Typically wrapped with it's parameters using ``initConnectivity`` function
         \return pointer to newly created SynapseGroup */
     template<typename WeightUpdateModel, typename PostsynapticModel>
@@ -300,7 +316,7 @@ public:
         \param postsynapticParamValues      parameters for postsynaptic model wrapped in PostsynapticModel::ParamValues object.
         \param postsynapticVarInitialisers  postsynaptic model state variable initialiser snippets and parameters wrapped in NeuronModel::VarValues object.
         \param connectivityInitialiser      sparse connectivity initialisation snippet used to initialise connectivity for
-                                            SynapseMatrixConnectivity::SPARSE or SynapseMatrixConnectivity::BITMASK.
+                                            SynapseMatrixConnectivity::SPARSE, SynapseMatrixConnectivity::CSR or SynapseMatrixConnectivity::BITMASK.
                                             Typically wrapped with it's parameters using ``initConnectivity`` function
         \return pointer to newly created SynapseGroup */
     template<typename WeightUpdateModel, typename PostsynapticModel>
@@ -334,7 +350,7 @@ public:
         \param postsynapticParamValues      parameters for postsynaptic model wrapped in PostsynapticModel::ParamValues object.
         \param postsynapticVarInitialisers  postsynaptic model state variable initialiser snippets and parameters wrapped in NeuronModel::VarValues object.
         \param connectivityInitialiser      sparse connectivity initialisation snippet used to initialise connectivity for
-                                            SynapseMatrixConnectivity::SPARSE or SynapseMatrixConnectivity::BITMASK.
+                                            SynapseMatrixConnectivity::SPARSE, SynapseMatrixConnectivity::CSR or SynapseMatrixConnectivity::BITMASK.
                                             Typically wrapped with it's parameters using ``initConnectivity`` function
         \return pointer to newly created SynapseGroup */
     template<typename WeightUpdateModel, typename PostsynapticModel>
@@ -419,6 +435,9 @@ protected:
     //! Are any variables in any populations in this model using zero-copy memory?
     bool zeroCopyInUse() const;
 
+    //! Do any populations in this model record spikes?
+    bool isRecordingInUse() const;
+
     //! Get std::map containing local named NeuronGroup objects in model
     const std::map<std::string, NeuronGroupInternal> &getNeuronGroups() const{ return m_LocalNeuronGroups; }
 
@@ -463,9 +482,15 @@ private:
     //! Whether timing code should be inserted into model
     bool m_TimingEnabled;
 
+    //! Whether per-merged group profiling code should be inserted into model
+    bool m_ProfilingEnabled;
+
     //! RNG seed
     unsigned int m_Seed;
 
+    //! Number of independent copies of the model simulated together
+    unsigned int m_BatchSize;
+
     //! What is the default location for model state variables? Historically, everything was allocated on both host AND device
     VarLocation m_DefaultVarLocation;
 
@@ -105,6 +105,12 @@ public:
         and only applies to extra global parameters which are pointers. */
     void setExtraGlobalParamLocation(const std::string &paramName, VarLocation loc);
 
+    //! Enables and disable spike recording for this population
+    /*! When enabled, spikes are written into a bit-packed buffer (one bit per neuron per timestep) which
+        must be allocated with allocateRecordingBuffers() before the simulation is run and can
+        be copied back to the host with pullRecordingBuffersFromDevice() */
+    void setSpikeRecordingEnabled(bool enabled) { m_SpikeRecordingEnabled = enabled; }
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -120,6 +126,13 @@ public:
     const std::vector<Models::VarInit> &getVarInitialisers() const{ return m_VarInitialisers; }
 
     bool isSpikeTimeRequired() const;
+
+    //! Is the timestep of each neuron's latest spike stored separately from the delay slots?
+    /*! This is required if spike times or any spike-triggered weight update model variables are delayed, as these are only
+        written to the delay slots of neurons which spike on backends which support it. Delayed values are then read from
+        the delay slot if the neuron has spiked since it was written and otherwise from the latest value */
+    bool isLatestSpikeTimestepRequired() const;
+
     bool isTrueSpikeRequired() const;
     bool isSpikeEventRequired() const;
 
@@ -156,6 +169,9 @@ public:
     //! Does this neuron group require an RNG for it's init code?
     bool isInitRNGRequired() const;
 
+    //! Is spike recording enabled for this population?
+    bool isSpikeRecordingEnabled() const { return m_SpikeRecordingEnabled; }
+
 
 protected:
     NeuronGroup(const std::string &name, int numNeurons, const NeuronModels::Base *neuronModel,
@@ -164,7 +180,8 @@ protected:
         m_Name(name), m_NumNeurons(numNeurons), m_NeuronModel(neuronModel), m_Params(params), m_VarInitialisers(varInitialisers),
         m_NumDelaySlots(1), m_VarQueueRequired(varInitialisers.size(), false), m_SpikeLocation(defaultVarLocation), m_SpikeEventLocation(defaultVarLocation),
         m_SpikeTimeLocation(defaultVarLocation), m_VarLocation(varInitialisers.size(), defaultVarLocation),
-        m_ExtraGlobalParamLocation(neuronModel->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation)
+        m_ExtraGlobalParamLocation(neuronModel->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
+        m_SpikeRecordingEnabled(false)
     {
     }
 
@@ -269,4 +286,7 @@ private:
 
     //! Location of extra global parameters
     std::vector<VarLocation> m_ExtraGlobalParamLocation;
+
+    //! Is spike recording enabled for this population?
+    bool m_SpikeRecordingEnabled;
 };
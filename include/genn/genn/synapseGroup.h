@@ -42,6 +42,14 @@ public:
     /*! This is ignored for simulations on hardware with a single memory space */
     void setWUVarLocation(const std::string &varName, VarLocation loc);
 
+    //! Set format used to store weight update model per-synapse state variable in memory
+    /*! Values are converted to and from the variable's declared type whenever they are accessed so,
+        for example, storing single-precision weights as VarStorage::INT8 quarters the memory bandwidth
+        required to read them. Values stored as VarStorage::INT8 or VarStorage::INT16 are multiplied by scale
+        when they are read. Host code must write values in the storage format, for example using gennQuantiseInt8.
+        This can only be used on synapse groups with individual weights and floating point variables. */
+    void setWUVarStorage(const std::string &varName, VarStorage storage, double scale = 1.0);
+
     //! Set location of weight update model presynaptic state variable
     /*! This is ignored for simulations on hardware with a single memory space */
     void setWUPreVarLocation(const std::string &varName, VarLocation loc);
@@ -87,6 +95,10 @@ public:
     //! Sets the maximum number of source neurons any target neuron can connect to
     /*! Use with synaptic matrix types with SynapseMatrixConnectivity::SPARSE and postsynaptic learning to optimise CUDA implementation */
     void setMaxSourceConnections(unsigned int maxPostConnections);
+
+    //! Sets the maximum total number of synapses in this synapse group
+    /*! Use with synaptic matrix types with SynapseMatrixConnectivity::CSR to size connectivity and per-synapse variable arrays */
+    void setMaxNumSynapses(size_t maxNumSynapses);
     
     //! Sets the maximum dendritic delay for synapses in this synapse group
     void setMaxDendriticDelayTimesteps(unsigned int maxDendriticDelay);
@@ -105,6 +117,18 @@ public:
     //! Enables or disables using narrow i.e. less than 32-bit types for sparse matrix indices
     void setNarrowSparseIndEnabled(bool enabled);
 
+    //! Enables or disables compressing sparse matrix indices for the presynaptic update and synapse dynamics
+    /*! Each row of indices is delta-encoded and packed into blocks of 1, 2 or 4-byte deltas when connectivity is initialised
+        so memory-bound simulations read substantially less connectivity data. Rows need not be sorted but compress best
+        when they are. If indices are modified after initializeSparse, the generated compressSparseInd function
+        for this synapse group must be called. This is currently only supported by the CPU backends. */
+    void setCompressedSparseIndEnabled(bool enabled);
+
+    //! Memory-map sparse connectivity and per-synapse weight update model variables from an external file rather than allocating and initialising them
+    /*! The file should be written using SparseConnectivityFile from userproject/include/sparseConnectivityFile.h or the
+        convert_edge_list tool. This can only be used on synapse groups with SPARSE connectivity and no connectivity or variable initialisation. */
+    void setExternalConnectivityFile(const std::string &filename);
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -116,6 +140,12 @@ public:
     unsigned int getBackPropDelaySteps() const{ return m_BackPropDelaySteps; }
     unsigned int getMaxConnections() const{ return m_MaxConnections; }
     unsigned int getMaxSourceConnections() const{ return m_MaxSourceConnections; }
+
+    //! Get maximum total number of synapses in this synapse group
+    /*! If this has not been set explicitly or calculated by the connectivity initialisation snippet, it
+        falls back to the number of source neurons multiplied by the maximum number of connections */
+    size_t getMaxNumSynapses() const;
+
     unsigned int getMaxDendriticDelayTimesteps() const{ return m_MaxDendriticDelayTimesteps; }
     SynapseMatrixType getMatrixType() const{ return m_MatrixType; }
 
@@ -152,12 +182,27 @@ public:
 
     bool isZeroCopyEnabled() const;
 
+    //! Are sparse matrix indices compressed for the presynaptic update and synapse dynamics?
+    bool isCompressedSparseIndEnabled() const{ return m_CompressedSparseIndEnabled; }
+
+    //! Get file sparse connectivity and per-synapse variables are mapped from (empty if they are allocated and initialised as normal)
+    const std::string &getExternalConnectivityFile() const{ return m_ExternalConnectivityFile; }
+
+    //! Are sparse connectivity and per-synapse variables mapped from an external file?
+    bool isExternalConnectivity() const{ return !m_ExternalConnectivityFile.empty(); }
+
     //! Get location of weight update model per-synapse state variable by name
     VarLocation getWUVarLocation(const std::string &var) const;
 
     //! Get location of weight update model per-synapse state variable by index
     VarLocation getWUVarLocation(size_t index) const{ return m_WUVarLocation.at(index); }
 
+    //! Get format used to store weight update model per-synapse state variable by index
+    VarStorage getWUVarStorage(size_t index) const{ return m_WUVarStorage.at(index); }
+
+    //! Get scale applied to weight update model per-synapse state variable stored as quantised integers by index
+    double getWUVarStorageScale(size_t index) const{ return m_WUVarStorageScale.at(index); }
+
     //! Get location of weight update model presynaptic state variable by name
     VarLocation getWUPreVarLocation(const std::string &var) const;
 
@@ -203,6 +248,14 @@ public:
     //! Does this synapse group require dendritic delay?
     bool isDendriticDelayRequired() const;
 
+    //! Can presynaptic weight update model variables only be written to the delay slot of presynaptic spikes?
+    /*! If so, and the backend supports it, the latest value of each variable is also stored separately from its delay slots */
+    bool isWUPreVarLatestRequired() const;
+
+    //! Can postsynaptic weight update model variables only be written to the delay slot of postsynaptic spikes?
+    /*! If so, and the backend supports it, the latest value of each variable is also stored separately from its delay slots */
+    bool isWUPostVarLatestRequired() const;
+
     //! Does this synapse group require an RNG to generate procedural connectivity?
     bool isProceduralConnectivityRNGRequired() const;
 
@@ -327,6 +380,9 @@ private:
     //! Maximum number of source neurons any target neuron can connect to
     unsigned int m_MaxSourceConnections;
 
+    //! Maximum total number of synapses (0 if this should be calculated from maximum number of connections)
+    size_t m_MaxNumSynapses;
+
     //! Maximum dendritic delay timesteps supported for synapses in this population
     unsigned int m_MaxDendriticDelayTimesteps;
     
@@ -346,6 +402,9 @@ private:
     //! Should narrow i.e. less than 32-bit types be used for sparse matrix indices
     bool m_NarrowSparseIndEnabled;
 
+    //! Should delta-encoded, block-packed copies of sparse matrix indices be used by the presynaptic update and synapse dynamics
+    bool m_CompressedSparseIndEnabled;
+
     //! Variable mode used for variables used to combine input from this synapse group
     VarLocation m_InSynLocation;
 
@@ -385,6 +444,12 @@ private:
     //! Location of individual per-synapse state variables
     std::vector<VarLocation> m_WUVarLocation;
 
+    //! Formats used to store individual per-synapse state variables
+    std::vector<VarStorage> m_WUVarStorage;
+
+    //! Scales applied to individual per-synapse state variables stored as quantised integers
+    std::vector<double> m_WUVarStorageScale;
+
     //! Location of individual presynaptic state variables
     std::vector<VarLocation> m_WUPreVarLocation;
 
@@ -412,4 +477,7 @@ private:
     //! Name of the synapse group in which postsynaptic model is located
     /*! This may not be the name of this group if it has been merged*/
     std::string m_PSModelTargetName;
+
+    //! File sparse connectivity and per-synapse variables are mapped from
+    std::string m_ExternalConnectivityFile;
 };
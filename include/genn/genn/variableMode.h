@@ -17,6 +17,17 @@ enum class VarLocation : uint8_t
     HOST_DEVICE_ZERO_COPY = HOST | DEVICE | ZERO_COPY,
 };
 
+//!< Formats in which floating point variables can be stored in memory
+/*! Variables are converted to and from their declared type whenever they are read or written */
+enum class VarStorage : uint8_t
+{
+    NATIVE,     //!< Stored using the variable's declared type
+    INT8,       //!< Quantised to 8-bit signed integers which are multiplied by a scale when read
+    INT16,      //!< Quantised to 16-bit signed integers which are multiplied by a scale when read
+    HALF,       //!< IEEE 754 half precision
+    BFLOAT16,   //!< Brain floating point i.e. single precision truncated to a 7-bit mantissa
+};
+
 //----------------------------------------------------------------------------
 // Operators
 //----------------------------------------------------------------------------
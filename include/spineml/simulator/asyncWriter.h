@@ -0,0 +1,72 @@
+#pragma once
+
+// Standard C++ includes
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------
+// SpineMLSimulator::AsyncWriter
+//----------------------------------------------------------------------------
+//! Writes snapshots of data to file on a background thread
+/*! Snapshots are taken into a ring of preallocated buffers. If the writer thread
+    falls behind and all buffers are full, taking a snapshot blocks until one is free,
+    so memory use is bounded. */
+namespace SpineMLSimulator
+{
+class AsyncWriter
+{
+public:
+    //! Function called on writer thread to write snapshot of given size to file
+    typedef std::function<void(std::ofstream&, const char*, size_t)> WriteFunc;
+
+    AsyncWriter(const std::string &filename, std::ios::openmode mode, size_t bufferSize, unsigned int numBuffers,
+                WriteFunc writeFunc);
+    ~AsyncWriter();
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Get next free buffer to take snapshot into, blocking until one is available
+    char *acquireBuffer();
+
+    //! Pass buffer returned by acquireBuffer, containing size bytes, to writer thread
+    void commitBuffer(size_t size);
+
+    size_t getBufferSize() const{ return m_BufferSize; }
+
+private:
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    void writerThread();
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    std::ofstream m_File;
+    const size_t m_BufferSize;
+    WriteFunc m_WriteFunc;
+
+    // Ring of preallocated buffers and the size of the snapshot in each
+    std::vector<std::vector<char>> m_Buffers;
+    std::vector<size_t> m_SnapshotSizes;
+
+    // Index of next buffer to fill and number of filled buffers waiting to be written
+    unsigned int m_Head;
+    unsigned int m_NumFilled;
+
+    // Has writer thread been asked to stop and has writing failed
+    bool m_Stop;
+    bool m_Failed;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_BufferFilled;
+    std::condition_variable m_BufferWritten;
+    std::thread m_Thread;
+};
+}   // namespace SpineMLSimulator
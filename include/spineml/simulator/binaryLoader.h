@@ -0,0 +1,65 @@
+#pragma once
+
+// Standard C++ includes
+#include <functional>
+#include <string>
+
+// Standard C includes
+#include <cstddef>
+
+//----------------------------------------------------------------------------
+// SpineMLSimulator::BinaryLoader::MappedFile
+//----------------------------------------------------------------------------
+//! Read-only memory mapping of a binary connection or property file
+/*! Mapping the file lets the loading threads read directly from the page cache
+    rather than each synapse being copied through an std::ifstream */
+namespace SpineMLSimulator
+{
+namespace BinaryLoader
+{
+class MappedFile
+{
+public:
+    MappedFile(const std::string &filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile &operator = (const MappedFile&) = delete;
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    const char *getData() const{ return m_Data; }
+    size_t getSize() const{ return m_Size; }
+
+    //! Throw if the file is too small to contain requiredSize bytes
+    void checkSize(size_t requiredSize, const std::string &description) const;
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    const std::string m_Filename;
+    const char *m_Data;
+    size_t m_Size;
+
+#ifdef _WIN32
+    void *m_File;
+    void *m_Mapping;
+#endif
+};
+
+//----------------------------------------------------------------------------
+// Functions
+//----------------------------------------------------------------------------
+//! Get number of threads to use for loading numItems
+/*! Small files are loaded on the calling thread as spawning threads would cost more than it saves */
+unsigned int getNumThreads(size_t numItems);
+
+//! Split numItems into numThreads contiguous chunks and call func(thread, begin, end) on each in parallel
+/*! The first chunk is processed on the calling thread and, once all threads
+    have finished, any exception thrown by func is rethrown on the calling thread */
+void parallelFor(unsigned int numThreads, size_t numItems,
+                 std::function<void(unsigned int, size_t, size_t)> func);
+}   // namespace BinaryLoader
+}   // namespace SpineMLSimulator
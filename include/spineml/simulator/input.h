@@ -5,6 +5,7 @@
 #include <map>
 #include <memory>
 #include <random>
+#include <vector>
 
 // Forward declarations
 namespace pugi
@@ -127,10 +128,42 @@ protected:
     virtual double getTimeToSpike(double isiMs) = 0;
 
 private:
+    //----------------------------------------------------------------------------
+    // Typedefines
+    //----------------------------------------------------------------------------
+    //! Neuron ID and the sequence number it was scheduled with
+    typedef std::vector<std::pair<unsigned int, unsigned int>> Bucket;
+
+    //----------------------------------------------------------------------------
+    // Private API
+    //----------------------------------------------------------------------------
+    //! Schedule neuron's next spike for when it is due (in possibly fractional timesteps) but no earlier than earliestTimestep
+    void scheduleSpike(unsigned int neuronID, double dueTimestep, unsigned long long earliestTimestep);
+
     //----------------------------------------------------------------------------
     // Members
     //----------------------------------------------------------------------------
-    std::map<unsigned int, std::pair<double, double>> m_TimeToSpike;
+    //! Number of timesteps input has been applied for
+    unsigned long long m_CurrentTimestep;
+
+    //! Interspike interval of each neuron (ms) - zero if neuron is not spiking
+    std::vector<double> m_ISI;
+
+    //! When each neuron's next spike is due, including sub-timestep remainder
+    std::vector<double> m_DueTimestep;
+
+    //! Timestep each neuron's next spike is scheduled for
+    std::vector<unsigned long long> m_SpikeTimestep;
+
+    //! Sequence number of each neuron's current schedule - wheel entries with other sequence numbers are stale
+    std::vector<unsigned int> m_Sequence;
+
+    //! Timing wheel of buckets containing neurons scheduled to spike in timesteps with that index modulo wheel size
+    /*! Neurons scheduled further in the future than the size of the wheel are revisited every rotation */
+    std::vector<Bucket> m_TimingWheel;
+
+    //! Bucket of timing wheel currently being processed
+    Bucket m_CurrentBucket;
 };
 
 //----------------------------------------------------------------------------
@@ -1,12 +1,13 @@
 #pragma once
 
 // Standard C++ includes
-#include <fstream>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
 
 // SpineML simulator includes
+#include "asyncWriter.h"
 #include "modelProperty.h"
 #include "networkClient.h"
 
@@ -116,10 +117,16 @@ private:
     //----------------------------------------------------------------------------
     // Members
     //----------------------------------------------------------------------------
-    std::ofstream m_File;
+    // Window of model property, between minimum and maximum index, which is snapshotted each timestep
+    unsigned int m_WindowStart;
+    unsigned int m_WindowSize;
 
-    // Buffer used, if indices are in use, to store contiguous output data
+    // Buffer used by writer thread, if indices are in use, to store contiguous output data
     std::vector<scalar> m_OutputBuffer;
+
+    // Writer used to write snapshots to file in background
+    // **NOTE** declared last so writer thread is stopped before anything it uses is destroyed
+    std::unique_ptr<AsyncWriter> m_Writer;
 };
 
 //----------------------------------------------------------------------------
@@ -207,8 +214,6 @@ private:
     //----------------------------------------------------------------------------
     // Members
     //----------------------------------------------------------------------------
-    std::ofstream m_File;
-
     const unsigned int m_PopSize;
 
     unsigned int *m_SpikeQueuePtr;
@@ -218,6 +223,10 @@ private:
     void (*m_PullCurrentSpikesFunc)(void);
 
     std::set<unsigned int> m_Indices;
+
+    // Writer used to format and write snapshots of spikes to file in background
+    // **NOTE** declared last so writer thread is stopped before anything it uses is destroyed
+    std::unique_ptr<AsyncWriter> m_Writer;
 };
 }   // namespace LogOutput
 }   // namespace SpineMLSimulator
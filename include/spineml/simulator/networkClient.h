@@ -1,10 +1,15 @@
 #pragma once
 
 // Standard C++ includes
+#include <atomic>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <vector>
 
+// Standard C includes
+#include <cstdint>
+
 // POSIX includes
 #ifdef _WIN32
     #include <winsock2.h>
@@ -22,6 +27,14 @@
 //----------------------------------------------------------------------------
 // SpineMLSimulator::NetworkClient
 //----------------------------------------------------------------------------
+//! Client for the SpineML external network protocol
+/*! By default, every timestep of data is sent in its own message and must be
+    acknowledged before the simulation continues. If batchTimesteps > 1, the
+    client instead opens the connection by sending Extension::Batched and, after
+    the standard handshake, sends the batch size and the name of a shared memory
+    ring (or an empty string to keep using TCP). Each TCP message is then
+    [uint32 numTimesteps][numTimesteps * size doubles] and up to numBatchesInFlight
+    messages can be in flight before waiting for their acknowledgements. */
 namespace SpineMLSimulator
 {
 class NetworkClient
@@ -42,19 +55,80 @@ public:
         Events = 32,
         Impulses = 33,
     };
-    
+
+    //! Requests which extend the standard protocol
+    enum class Extension : char
+    {
+        Batched = 47,
+    };
+
+    //! State of a shared memory ring
+    enum class RingState : uint32_t
+    {
+        Running,
+        Finished,
+        Aborted,
+    };
+
+    //------------------------------------------------------------------------
+    // SharedRingHeader
+    //------------------------------------------------------------------------
+    //! Header at the start of a shared memory ring, created by the client
+    /*! It is followed by numBatchesInFlight slots, each of which holds a uint64
+        count of timesteps followed by batchTimesteps * size doubles. The producer
+        advances head once it has filled a slot and the consumer advances tail
+        once it has emptied one. */
+    struct SharedRingHeader
+    {
+        std::atomic<uint32_t> head;
+        std::atomic<uint32_t> tail;
+        std::atomic<RingState> state;
+        uint32_t slotBytes;
+    };
+    static_assert((sizeof(SharedRingHeader) % sizeof(double)) == 0, "Shared ring slots must be aligned to doubles");
+
+    // **NOTE** the ring is shared between processes so its atomics can't be implemented using a process-local lock
+    static_assert(ATOMIC_INT_LOCK_FREE == 2, "Shared ring requires lock-free atomic integers");
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Shared ring requires atomic integers with the same layout as integers");
+
+    //! Maximum number of batches which can be sent before they are acknowledged
+    static const unsigned int numBatchesInFlight = 4;
+
+    //! Number of times to spin waiting for shared ring between checks that remote host is still connected
+    static const unsigned int sharedRingLivenessInterval = 1024;
+
     NetworkClient();
-    NetworkClient(const std::string &hostname, unsigned int port, unsigned int size, DataType dataType, Mode mode, const std::string &connectionName);
+    NetworkClient(const std::string &hostname, unsigned int port, unsigned int size, DataType dataType, Mode mode, const std::string &connectionName,
+                  unsigned int batchTimesteps = 1, bool sharedMemory = false);
     ~NetworkClient();
-    
+
+    NetworkClient(const NetworkClient&) = delete;
+    NetworkClient &operator = (const NetworkClient&) = delete;
+
     //----------------------------------------------------------------------------
     // Public API
     //----------------------------------------------------------------------------
-    bool connect(const std::string &hostname, unsigned int port, unsigned int size, DataType dataType, Mode mode, const std::string &connectionName);
+    bool connect(const std::string &hostname, unsigned int port, unsigned int size, DataType dataType, Mode mode, const std::string &connectionName,
+                 unsigned int batchTimesteps = 1, bool sharedMemory = false);
 
     bool receive(std::vector<double> &buffer);
     bool send(const std::vector<double> &buffer);
 
+    //! Send any partially-filled batch and wait until all batches have been acknowledged
+    bool flush();
+
+    //! Get size of a shared memory ring slot holding batchTimesteps of size values
+    static size_t getSharedRingSlotBytes(unsigned int size, unsigned int batchTimesteps)
+    {
+        return sizeof(uint64_t) + (sizeof(double) * size * batchTimesteps);
+    }
+
+    //! Get pointer to slot in shared memory ring
+    static char *getSharedRingSlot(SharedRingHeader *ring, uint32_t index)
+    {
+        return reinterpret_cast<char*>(ring) + sizeof(SharedRingHeader) + ((size_t)(index % numBatchesInFlight) * ring->slotBytes);
+    }
+
 private:
     //------------------------------------------------------------------------
     // Enumerations
@@ -66,7 +140,7 @@ private:
         Abort = 43,
         Finished = 44,
     };
-    
+
     //----------------------------------------------------------------------------
     // Private API
     //----------------------------------------------------------------------------
@@ -120,10 +194,72 @@ private:
 
     bool sendRequestReadResponse(const std::string &data, Response &response);
 
+    bool sendAll(const char *data, size_t size);
+    bool receiveAll(char *data, size_t size);
+    bool receiveResponse();
+
+    bool createSharedRing(std::string &name);
+    void destroySharedRing();
+
+    //! Wait for remote host to update shared ring until ready returns true
+    /*! Fails if the remote host aborts, stops sending (if stopIfFinished is set) or disconnects */
+    template<typename Ready>
+    bool waitForSharedRing(Ready ready, bool stopIfFinished)
+    {
+        for(unsigned int i = 0; !ready(); i++) {
+            // Check remote host hasn't changed state of ring
+            const RingState state = m_SharedRing->state.load(std::memory_order_acquire);
+            if(state == RingState::Aborted) {
+                LOGE_SPINEML << "Remote host aborted";
+                return false;
+            }
+            else if(stopIfFinished && state == RingState::Finished) {
+                LOGE_SPINEML << "Remote host stopped sending";
+                return false;
+            }
+
+            // Periodically check remote host is still connected so a crashed one doesn't leave us spinning forever
+            if((i % sharedRingLivenessInterval) == (sharedRingLivenessInterval - 1) && !isRemoteHostConnected()) {
+                LOGE_SPINEML << "Remote host disconnected";
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    bool isRemoteHostConnected();
+
+    bool sendBatch();
+    bool receiveBatch();
+
     //----------------------------------------------------------------------------
     // Private members
     //----------------------------------------------------------------------------
     int m_Socket;
+
+    // Direction data is being transferred in
+    Mode m_Mode;
+
+    // Number of values sent or received each timestep
+    unsigned int m_Size;
+
+    // Number of timesteps batched into each message
+    unsigned int m_BatchTimesteps;
+
+    // Batch being filled (if sending) or emptied (if receiving)
+    // and the number of timesteps and position within it
+    // **NOTE** batch is empty if the standard, unbatched, protocol is in use
+    std::vector<double> m_Batch;
+    unsigned int m_BatchNumTimesteps;
+    unsigned int m_BatchPosition;
+
+    // Number of batches sent over TCP which haven't been acknowledged yet
+    unsigned int m_NumUnacknowledgedBatches;
+
+    // Shared memory ring, if one is being used
+    SharedRingHeader *m_SharedRing;
+    size_t m_SharedRingBytes;
 };
 
 }   // namespace SpineMLSimulator
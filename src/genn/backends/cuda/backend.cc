@@ -179,6 +179,9 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 {
     // Generate data structure for accessing merged groups
     const ModelSpecInternal &model = modelMerged.getModel();
+    if(model.isProfilingEnabled()) {
+        throw std::runtime_error("Model '" + model.getName() + "' has profiling enabled which is not supported by the CUDA backend");
+    }
     genMergedKernelDataStructures(
         os, m_KernelBlockSizes[KernelNeuronUpdate],
         modelMerged.getMergedNeuronUpdateGroups(), "NeuronUpdate",
@@ -219,7 +222,11 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
     os << std::endl;
 
     size_t idStart = 0;
-    os << "extern \"C\" __global__ void " << KernelNames[KernelNeuronUpdate] << "("  << model.getTimePrecision() << " t)" << std::endl;
+    os << "extern \"C\" __global__ void " << KernelNames[KernelNeuronUpdate] << "("  << model.getTimePrecision() << " t";
+    if(model.isRecordingInUse()) {
+        os << ", unsigned int recordingTimestep";
+    }
+    os << ")" << std::endl;
     {
         CodeStream::Scope b(os);
         os << "const unsigned int id = " << m_KernelBlockSizes[KernelNeuronUpdate] << " * blockIdx.x + threadIdx.x; " << std::endl;
@@ -257,13 +264,27 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
             }
             os << std::endl;
         }
+
+        // If any neuron groups record spikes, build this block's words of the recording buffer in shared memory
+        const unsigned int numBlockRecordingWords = (m_KernelBlockSizes[KernelNeuronUpdate] + 31) / 32;
+        if(std::any_of(modelMerged.getMergedNeuronUpdateGroups().cbegin(), modelMerged.getMergedNeuronUpdateGroups().cend(),
+            [](const NeuronGroupMerged &n){ return n.getArchetype().isSpikeRecordingEnabled(); }))
+        {
+            os << "__shared__ uint32_t shSpkRecord[" << numBlockRecordingWords << "];" << std::endl;
+            os << "if (threadIdx.x < " << numBlockRecordingWords << ")";
+            {
+                CodeStream::Scope b(os);
+                os << "shSpkRecord[threadIdx.x] = 0;" << std::endl;
+            }
+            os << std::endl;
+        }
             
         os << "__syncthreads();" << std::endl;
 
         // Parallelise over neuron groups
         genParallelGroup<NeuronGroupMerged>(os, kernelSubs, modelMerged.getMergedNeuronUpdateGroups(), "NeuronUpdate", idStart,
             [this](const NeuronGroupInternal &ng){ return padSize(ng.getNumNeurons(), getKernelBlockSize(KernelNeuronUpdate)); },
-            [&model, simHandler, wuVarUpdateHandler, this](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &popSubs)
+            [&model, numBlockRecordingWords, simHandler, wuVarUpdateHandler, this](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &popSubs)
             {
                 // If axonal delays are required
                 if (ng.getArchetype().isDelayRequired()) {
@@ -286,9 +307,14 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
                     CodeStream::Scope b(os);
                     simHandler(os, ng, popSubs,
                         // Emit true spikes
-                        [this](CodeStream &os, const NeuronGroupMerged &, Substitutions &subs)
+                        [this](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
                         {
                             genEmitSpike(os, subs, "");
+
+                            // If spike recording is enabled, set this thread's bit in shared memory recording word
+                            if(ng.getArchetype().isSpikeRecordingEnabled()) {
+                                os << "atomicOr(&shSpkRecord[threadIdx.x / 32], 1u << (threadIdx.x % 32));" << std::endl;
+                            }
                         },
                         // Emit spike-like events
                         [this](CodeStream &os, const NeuronGroupMerged &, Substitutions &subs)
@@ -299,6 +325,22 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 
                 os << "__syncthreads();" << std::endl;
 
+                // If spike recording is enabled, copy this block's words of the recording buffer to global memory
+                // **NOTE** neuron groups are padded to the block size so blocks never span groups
+                if(ng.getArchetype().isSpikeRecordingEnabled()) {
+                    os << "if (threadIdx.x < " << numBlockRecordingWords << ")";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "const unsigned int numRecordingWords = (group.numNeurons + 31) / 32;" << std::endl;
+                        os << "const unsigned int popWordIdx = ((" << popSubs["id"] << " - threadIdx.x) / 32) + threadIdx.x;" << std::endl;
+                        os << "if (popWordIdx < numRecordingWords)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "group.recordSpk[(recordingTimestep * numRecordingWords) + popWordIdx] = shSpkRecord[threadIdx.x];" << std::endl;
+                        }
+                    }
+                }
+
                 if (ng.getArchetype().isSpikeEventRequired()) {
                     os << "if (threadIdx.x == 1)";
                     {
@@ -370,12 +412,21 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
         );
     }
 
-    os << "void updateNeurons(" << model.getTimePrecision() << ")";
+    // Push any required EGPS
+    os << "void pushNeuronUpdateEGPs()";
     {
         CodeStream::Scope b(os);
-
-        // Push any required EGPS
         pushEGPHandler(os);
+    }
+    os << std::endl;
+
+    os << "void updateNeuronsInternal(" << model.getTimePrecision() << " t";
+    if(model.isRecordingInUse()) {
+        os << ", unsigned int recordingTimestep";
+    }
+    os << ")";
+    {
+        CodeStream::Scope b(os);
 
         if(idPreNeuronReset > 0) {
             CodeStream::Scope b(os);
@@ -389,7 +440,11 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
             Timer t(os, "neuronUpdate", model.isTimingEnabled());
 
             genKernelDimensions(os, KernelNeuronUpdate, idStart);
-            os << KernelNames[KernelNeuronUpdate] << "<<<grid, threads>>>(t);" << std::endl;
+            os << KernelNames[KernelNeuronUpdate] << "<<<grid, threads>>>(t";
+            if(model.isRecordingInUse()) {
+                os << ", recordingTimestep";
+            }
+            os << ");" << std::endl;
             os << "CHECK_CUDA_ERRORS(cudaPeekAtLastError());" << std::endl;
         }
     }
@@ -401,6 +456,21 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                                SynapseGroupMergedHandler postLearnHandler, SynapseGroupMergedHandler synapseDynamicsHandler,
                                HostHandler pushEGPHandler) const
 {
+    // Check no synapse groups' connectivity is mapped from host memory or compressed and no variables use reduced precision
+    for(const auto &s : modelMerged.getModel().getSynapseGroups()) {
+        if(s.second.isExternalConnectivity()) {
+            throw std::runtime_error("Synapse group '" + s.first + "' uses external connectivity which is not supported by the CUDA backend");
+        }
+        if(s.second.isCompressedSparseIndEnabled()) {
+            throw std::runtime_error("Synapse group '" + s.first + "' uses compressed sparse indices which are not supported by the CUDA backend");
+        }
+        for(size_t i = 0; i < s.second.getWUModel()->getVars().size(); i++) {
+            if(s.second.getWUVarStorage(i) != VarStorage::NATIVE) {
+                throw std::runtime_error("Synapse group '" + s.first + "' stores variables in reduced precision which is not supported by the CUDA backend");
+            }
+        }
+    }
+
     // Generate data structure for accessing merged groups
     if(!modelMerged.getMergedPresynapticUpdateGroups().empty()) {
         genMergedKernelDataStructures(
@@ -732,12 +802,17 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
         }
     }
 
-    os << "void updateSynapses(" << model.getTimePrecision() << " t)";
+    // Push any required EGPs
+    os << "void pushSynapseUpdateEGPs()";
     {
         CodeStream::Scope b(os);
-
-        // Push any required EGPs
         pushEGPHandler(os);
+    }
+    os << std::endl;
+
+    os << "void updateSynapsesInternal(" << model.getTimePrecision() << " t)";
+    {
+        CodeStream::Scope b(os);
 
         // Launch pre-synapse reset kernel if required
         if(idPreSynapseReset > 0) {
@@ -2169,6 +2244,11 @@ const PresynapticUpdateStrategy::Base *Backend::getPresynapticUpdateStrategy(con
                                                                              const cudaDeviceProp &deviceProps,
                                                                              const Preferences &preferences)
 {
+    // CSR connectivity is not currently implemented by any presynaptic update strategies
+    if(sg.getMatrixType() & SynapseMatrixConnectivity::CSR) {
+        throw std::runtime_error("Synapse group '" + sg.getName() + "' uses CSR connectivity which is not supported by the CUDA backend");
+    }
+
     // Loop through presynaptic update strategies until we find one that is compatible with this synapse group
     // **NOTE** this is done backwards so that user-registered strategies get first priority
     for(auto s = s_PresynapticUpdateStrategies.rbegin(); s != s_PresynapticUpdateStrategies.rend(); ++s) {
@@ -498,6 +498,11 @@ Backend createBackend(const ModelSpecInternal &model, const filesystem::path &ou
         plog::get<Logging::CHANNEL_BACKEND>()->setMaxSeverity(backendLevel);
     }
 
+    // Batched models are only supported by the CPU backends so reject them before any devices are queried
+    if(model.getBatchSize() > 1) {
+        throw std::runtime_error("Model '" + model.getName() + "' has a batch size of " + std::to_string(model.getBatchSize())
+                                 + " but batching is not supported by the CUDA backend - use a CPU backend instead");
+    }
 
     // If optimal device should be chosen
     if(preferences.deviceSelectMethod == DeviceSelect::OPTIMAL) {
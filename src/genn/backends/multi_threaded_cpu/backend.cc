@@ -0,0 +1,377 @@
+#include "backend.h"
+
+// Standard C++ includes
+#include <limits>
+
+// GeNN code generator includes
+#include "code_generator/codeStream.h"
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+// Minimum number of iterations of each type of loop worth handing to a thread
+const unsigned int neuronGrainSize = 256;
+const unsigned int rowGrainSize = 16;
+const unsigned int spikeGrainSize = 1;
+
+//--------------------------------------------------------------------------
+void genAtomics(CodeGenerator::CodeStream &os)
+{
+    using namespace CodeGenerator;
+
+    // Generate atomic operations used to make spike emission and input accumulation race-free
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// atomic operations" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+#ifdef _WIN32
+    os << "inline unsigned int gennAtomicInc(volatile unsigned int *address)";
+    {
+        CodeStream::Scope b(os);
+        os << "return (unsigned int)_InterlockedIncrement((volatile long*)address) - 1;" << std::endl;
+    }
+    os << std::endl;
+    os << "inline void gennAtomicAdd(float *address, float value)";
+    {
+        CodeStream::Scope b(os);
+        os << "volatile long *intAddress = (volatile long*)address;" << std::endl;
+        os << "long old = *intAddress;" << std::endl;
+        os << "long assumed;" << std::endl;
+        os << "do";
+        {
+            CodeStream::Scope b(os);
+            os << "assumed = old;" << std::endl;
+            os << "float assumedValue;" << std::endl;
+            os << "std::memcpy(&assumedValue, &assumed, sizeof(float));" << std::endl;
+            os << "const float newValue = assumedValue + value;" << std::endl;
+            os << "long newInt;" << std::endl;
+            os << "std::memcpy(&newInt, &newValue, sizeof(float));" << std::endl;
+            os << "old = _InterlockedCompareExchange(intAddress, newInt, assumed);" << std::endl;
+        }
+        os << "while(assumed != old);" << std::endl;
+    }
+    os << std::endl;
+    os << "inline void gennAtomicAdd(double *address, double value)";
+    {
+        CodeStream::Scope b(os);
+        os << "volatile __int64 *intAddress = (volatile __int64*)address;" << std::endl;
+        os << "__int64 old = *intAddress;" << std::endl;
+        os << "__int64 assumed;" << std::endl;
+        os << "do";
+        {
+            CodeStream::Scope b(os);
+            os << "assumed = old;" << std::endl;
+            os << "double assumedValue;" << std::endl;
+            os << "std::memcpy(&assumedValue, &assumed, sizeof(double));" << std::endl;
+            os << "const double newValue = assumedValue + value;" << std::endl;
+            os << "__int64 newInt;" << std::endl;
+            os << "std::memcpy(&newInt, &newValue, sizeof(double));" << std::endl;
+            os << "old = _InterlockedCompareExchange64(intAddress, newInt, assumed);" << std::endl;
+        }
+        os << "while(assumed != old);" << std::endl;
+    }
+    os << std::endl;
+    os << "inline void gennAtomicAdd(uint64_t *address, uint64_t value)";
+    {
+        CodeStream::Scope b(os);
+        os << "_InterlockedExchangeAdd64((volatile __int64*)address, (__int64)value);" << std::endl;
+    }
+    os << std::endl;
+    os << "inline void gennAtomicOr(volatile uint32_t *address, uint32_t value)";
+    {
+        CodeStream::Scope b(os);
+        os << "_InterlockedOr((volatile long*)address, (long)value);" << std::endl;
+    }
+#else
+    os << "inline unsigned int gennAtomicInc(volatile unsigned int *address)";
+    {
+        CodeStream::Scope b(os);
+        os << "return __atomic_fetch_add(address, 1u, __ATOMIC_RELAXED);" << std::endl;
+    }
+    os << std::endl;
+    os << "template<typename T>" << std::endl;
+    os << "inline void gennAtomicAdd(T *address, T value)";
+    {
+        CodeStream::Scope b(os);
+        os << "T old;" << std::endl;
+        os << "__atomic_load(address, &old, __ATOMIC_RELAXED);" << std::endl;
+        os << "T newValue;" << std::endl;
+        os << "do";
+        {
+            CodeStream::Scope b(os);
+            os << "newValue = old + value;" << std::endl;
+        }
+        os << "while(!__atomic_compare_exchange(address, &old, &newValue, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));" << std::endl;
+    }
+    os << std::endl;
+    os << "inline void gennAtomicOr(volatile uint32_t *address, uint32_t value)";
+    {
+        CodeStream::Scope b(os);
+        os << "__atomic_fetch_or(address, value, __ATOMIC_RELAXED);" << std::endl;
+    }
+#endif
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void genThreadPool(CodeGenerator::CodeStream &os)
+{
+    using namespace CodeGenerator;
+
+    // Generate persistent thread pool
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// thread pool" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "class ThreadPool";
+    {
+        CodeStream::Scope b(os);
+        os << "public:" << std::endl;
+        os << "ThreadPool() : m_Task(nullptr), m_Count(0), m_ChunkSize(0), m_NumChunks(0), m_NumPending(0), m_Generation(0), m_Stop(false)";
+        {
+            CodeStream::Scope b(os);
+        }
+        os << std::endl;
+        os << "~ThreadPool()";
+        {
+            CodeStream::Scope b(os);
+            os << "stop();" << std::endl;
+        }
+        os << std::endl;
+        os << "// Start numThreads - 1 worker threads (the calling thread does the remaining share of work)" << std::endl;
+        os << "void start(unsigned int numThreads)";
+        {
+            CodeStream::Scope b(os);
+            os << "if(!m_Threads.empty())";
+            {
+                CodeStream::Scope b(os);
+                os << "return;" << std::endl;
+            }
+            os << "m_Stop = false;" << std::endl;
+            os << "for(unsigned int t = 1; t < numThreads; t++)";
+            {
+                CodeStream::Scope b(os);
+                os << "m_Threads.emplace_back(&ThreadPool::worker, this, t);" << std::endl;
+            }
+        }
+        os << std::endl;
+        os << "void stop()";
+        {
+            CodeStream::Scope b(os);
+            {
+                CodeStream::Scope b(os);
+                os << "std::lock_guard<std::mutex> lock(m_Mutex);" << std::endl;
+                os << "m_Stop = true;" << std::endl;
+            }
+            os << "m_WorkCondition.notify_all();" << std::endl;
+            os << "for(auto &t : m_Threads)";
+            {
+                CodeStream::Scope b(os);
+                os << "t.join();" << std::endl;
+            }
+            os << "m_Threads.clear();" << std::endl;
+        }
+        os << std::endl;
+        os << "unsigned int getNumThreads() const{ return (unsigned int)m_Threads.size() + 1; }" << std::endl;
+        os << std::endl;
+        os << "// Split [0, count) into at most one chunk per thread, each of at least grainSize iterations, and call func(begin, end) on each" << std::endl;
+        os << "void parallelFor(unsigned int count, unsigned int grainSize, const std::function<void(unsigned int, unsigned int)> &func)";
+        {
+            CodeStream::Scope b(os);
+            os << "const unsigned int numChunks = std::min(getNumThreads(), (count + grainSize - 1) / grainSize);" << std::endl;
+            os << "if(numChunks <= 1)";
+            {
+                CodeStream::Scope b(os);
+                os << "func(0, count);" << std::endl;
+                os << "return;" << std::endl;
+            }
+            os << "const unsigned int chunkSize = (count + numChunks - 1) / numChunks;" << std::endl;
+            {
+                CodeStream::Scope b(os);
+                os << "std::lock_guard<std::mutex> lock(m_Mutex);" << std::endl;
+                os << "m_Task = &func;" << std::endl;
+                os << "m_Count = count;" << std::endl;
+                os << "m_ChunkSize = chunkSize;" << std::endl;
+                os << "m_NumChunks = numChunks;" << std::endl;
+                os << "m_NumPending = (unsigned int)m_Threads.size();" << std::endl;
+                os << "m_Generation++;" << std::endl;
+            }
+            os << "m_WorkCondition.notify_all();" << std::endl;
+            os << std::endl;
+            os << "// Process first chunk on calling thread" << std::endl;
+            os << "func(0, std::min(chunkSize, count));" << std::endl;
+            os << std::endl;
+            os << "// Wait for workers to complete" << std::endl;
+            os << "std::unique_lock<std::mutex> lock(m_Mutex);" << std::endl;
+            os << "m_DoneCondition.wait(lock, [this](){ return (m_NumPending == 0); });" << std::endl;
+        }
+        os << std::endl;
+        os << "private:" << std::endl;
+        os << "void worker(unsigned int index)";
+        {
+            CodeStream::Scope b(os);
+            os << "unsigned int generation = 0;" << std::endl;
+            os << "while(true)";
+            {
+                CodeStream::Scope b(os);
+                os << "const std::function<void(unsigned int, unsigned int)> *task;" << std::endl;
+                os << "unsigned int begin;" << std::endl;
+                os << "unsigned int end;" << std::endl;
+                {
+                    CodeStream::Scope b(os);
+                    os << "std::unique_lock<std::mutex> lock(m_Mutex);" << std::endl;
+                    os << "m_WorkCondition.wait(lock, [this, generation](){ return (m_Stop || m_Generation != generation); });" << std::endl;
+                    os << "if(m_Stop)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "return;" << std::endl;
+                    }
+                    os << "generation = m_Generation;" << std::endl;
+                    os << "task = m_Task;" << std::endl;
+                    os << "begin = (index < m_NumChunks) ? std::min(index * m_ChunkSize, m_Count) : m_Count;" << std::endl;
+                    os << "end = std::min(begin + m_ChunkSize, m_Count);" << std::endl;
+                }
+                os << std::endl;
+                os << "if(begin < end)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "(*task)(begin, end);" << std::endl;
+                }
+                os << std::endl;
+                os << "bool done;" << std::endl;
+                {
+                    CodeStream::Scope b(os);
+                    os << "std::lock_guard<std::mutex> lock(m_Mutex);" << std::endl;
+                    os << "done = (--m_NumPending == 0);" << std::endl;
+                }
+                os << "if(done)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "m_DoneCondition.notify_one();" << std::endl;
+                }
+            }
+        }
+        os << std::endl;
+        os << "std::vector<std::thread> m_Threads;" << std::endl;
+        os << "std::mutex m_Mutex;" << std::endl;
+        os << "std::condition_variable m_WorkCondition;" << std::endl;
+        os << "std::condition_variable m_DoneCondition;" << std::endl;
+        os << "const std::function<void(unsigned int, unsigned int)> *m_Task;" << std::endl;
+        os << "unsigned int m_Count;" << std::endl;
+        os << "unsigned int m_ChunkSize;" << std::endl;
+        os << "unsigned int m_NumChunks;" << std::endl;
+        os << "unsigned int m_NumPending;" << std::endl;
+        os << "unsigned int m_Generation;" << std::endl;
+        os << "bool m_Stop;" << std::endl;
+    }
+    os << ";" << std::endl;
+    os << "EXPORT_VAR ThreadPool threadPool;" << std::endl;
+    os << std::endl;
+}
+}
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Backend
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace MultiThreadedCPU
+{
+void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    BackendCPU::genDefinitionsPreamble(os, modelMerged);
+
+    os << std::endl;
+    os << "// Standard C++ includes used by thread pool" << std::endl;
+    os << "#include <condition_variable>" << std::endl;
+    os << "#include <functional>" << std::endl;
+    os << "#include <mutex>" << std::endl;
+    os << "#include <thread>" << std::endl;
+    os << "#include <vector>" << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    BackendCPU::genDefinitionsInternalPreamble(os, modelMerged);
+
+    genAtomics(os);
+    genThreadPool(os);
+}
+//--------------------------------------------------------------------------
+void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    os << "ThreadPool threadPool;" << std::endl;
+    os << std::endl;
+
+    BackendCPU::genRunnerPreamble(os, modelMerged);
+}
+//--------------------------------------------------------------------------
+void Backend::genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &) const
+{
+    // Start thread pool, using all hardware threads if number isn't specified in preferences
+    if(m_Preferences.numThreads == 0) {
+        os << "threadPool.start(std::max(1u, std::thread::hardware_concurrency()));" << std::endl;
+    }
+    else {
+        os << "threadPool.start(" << m_Preferences.numThreads << ");" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+MemAlloc Backend::genVariableAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const
+{
+    const MemAlloc memAlloc = BackendCPU::genVariableAllocation(os, type, name, loc, count);
+
+    // If NUMA first-touch is enabled, zero array in parallel so its pages are
+    // placed near the threads which process the corresponding chunk of it
+    if(m_Preferences.enableNUMAFirstTouch && count <= std::numeric_limits<unsigned int>::max()) {
+        os << "threadPool.parallelFor(" << count << ", 1, [](unsigned int begin, unsigned int end)";
+        {
+            CodeStream::Scope b(os);
+            os << "std::memset(&" << name << "[begin], 0, (end - begin) * sizeof(" << type << "));" << std::endl;
+        }
+        os << ");" << std::endl;
+    }
+    return memAlloc;
+}
+//--------------------------------------------------------------------------
+void Backend::genParallelFor(CodeStream &os, const std::string &index, const std::string &count,
+                             ParallelLoop loop, bool simd, RangeHandler preambleHandler, HostHandler bodyHandler) const
+{
+    // Get minimum number of iterations worth handing to a thread
+    const unsigned int grainSize = (loop == ParallelLoop::NEURON) ? neuronGrainSize : ((loop == ParallelLoop::ROW) ? rowGrainSize : spikeGrainSize);
+
+    // Split [0, count) into a contiguous range per thread and loop over each range in parallel
+    os << "threadPool.parallelFor(" << count << ", " << grainSize << ", [&](unsigned int begin, unsigned int end)";
+    {
+        CodeStream::Scope b(os);
+        if(preambleHandler) {
+            preambleHandler(os, "begin", "end");
+        }
+
+        if(simd) {
+            os << "GENN_SIMD_LOOP" << std::endl;
+        }
+        os << "for(unsigned int " << index << " = begin; " << index << " < end; " << index << "++)";
+        {
+            CodeStream::Scope b(os);
+            bodyHandler(os);
+        }
+    }
+    os << ");" << std::endl;
+}
+//--------------------------------------------------------------------------
+std::string Backend::getAtomicAdd(const std::string &lvalue, const std::string &value, const std::string &type) const
+{
+    return "gennAtomicAdd(&" + lvalue + ", (" + type + ")(" + value + "))";
+}
+//--------------------------------------------------------------------------
+std::string Backend::getAtomicIncrement(const std::string &lvalue) const
+{
+    return "gennAtomicInc(&" + lvalue + ")";
+}
+//--------------------------------------------------------------------------
+std::string Backend::getAtomicOr(const std::string &lvalue, const std::string &value) const
+{
+    return "gennAtomicOr(&" + lvalue + ", " + value + ")";
+}
+}   // namespace MultiThreadedCPU
+}   // namespace CodeGenerator
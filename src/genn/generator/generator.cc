@@ -1,5 +1,6 @@
 // Standard C++ includes
 #include <fstream>
+#include <sstream>
 
 #ifdef _WIN32
 #include <Objbase.h>
@@ -109,8 +110,12 @@ int main(int argc,     //!< number of arguments; expected to be 2
         CodeGenerator::generateMSBuild(makefile, backend, projectGUIDString, moduleNames);
 #else
         // Create makefile to compile and link all generated modules
-        std::ofstream makefile((outputPath / "Makefile").str());
-        CodeGenerator::generateMakefile(makefile, backend, moduleNames);
+        // **NOTE** makefile is only rewritten if it's changed as the build cache uses it as a stamp
+        std::ostringstream makefile;
+        CodeGenerator::generateMakefile(makefile, backend, moduleNames,
+                                        CodeGenerator::getBuildCacheKey(backend, outputPath, moduleNames),
+                                        GENN_PREFERENCES.buildCacheDirectory);
+        CodeGenerator::writeFileIfChanged(outputPath / "Makefile", makefile.str());
 #endif
 
     }
@@ -0,0 +1,2316 @@
+#include "code_generator/backendCPU.h"
+
+// Standard C++ include
+#include <algorithm>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+// Standard C includes
+#include <cmath>
+
+// GeNN includes
+#include "gennUtils.h"
+
+// GeNN code generator includes
+#include "code_generator/codeGenUtils.h"
+#include "code_generator/codeStream.h"
+#include "code_generator/modelSpecMerged.h"
+#include "code_generator/substitutions.h"
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+//! Stateless distributions sampling from a counter-based RNG so that sequences can be exactly regenerated
+const std::vector<CodeGenerator::FunctionTemplate> cpuFunctions = {
+    {"gennrand_uniform", 0, "gennUniform($(rng))", "gennUniform($(rng))"},
+    {"gennrand_normal", 0, "gennNormal($(rng))", "gennNormal($(rng))"},
+    {"gennrand_exponential", 0, "gennExponential($(rng))", "gennExponential($(rng))"},
+    {"gennrand_log_normal", 2, "gennLogNormal($(rng), $(0), $(1))", "gennLogNormal($(rng), $(0), $(1))"},
+    {"gennrand_gamma", 1, "gennGamma($(rng), $(0))", "gennGamma($(rng), $(0))"}
+};
+
+//! Alignment of host allocations, matching cache line size
+const size_t hostAlignment = 64;
+
+//! Size of the transparent huge pages used on x86-64 Linux
+const size_t hugePageSize = 2 * 1024 * 1024;
+
+//--------------------------------------------------------------------------
+// RNGStream
+//--------------------------------------------------------------------------
+//! Domains used to give each use of the counter-based RNG an independent stream
+enum class RNGStream : uint64_t
+{
+    PROCEDURAL_CONNECTIVITY = 1,
+    NEURON_SIM,
+    NEURON_INIT,
+    SYNAPSE_DENSE_INIT,
+    SYNAPSE_CONNECTIVITY_INIT,
+    SYNAPSE_SPARSE_INIT,
+};
+
+//--------------------------------------------------------------------------
+// Timer
+//--------------------------------------------------------------------------
+class Timer
+{
+public:
+    Timer(CodeGenerator::CodeStream &codeStream, const std::string &name, bool timingEnabled)
+    :   m_CodeStream(codeStream), m_Name(name), m_TimingEnabled(timingEnabled)
+    {
+        // Record start event
+        if(m_TimingEnabled) {
+            m_CodeStream << "const auto " << m_Name << "Start = std::chrono::high_resolution_clock::now();" << std::endl;
+        }
+    }
+
+    ~Timer()
+    {
+        // Record stop event
+        if(m_TimingEnabled) {
+            m_CodeStream << m_Name << "Time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - " << m_Name << "Start).count();" << std::endl;
+        }
+    }
+
+private:
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    CodeGenerator::CodeStream &m_CodeStream;
+    const std::string m_Name;
+    const bool m_TimingEnabled;
+};
+
+//--------------------------------------------------------------------------
+// ProfileTimer
+//--------------------------------------------------------------------------
+//! RAII helper to add the wall time spent in the code generated during its lifetime to a merged group's profile
+class ProfileTimer
+{
+public:
+    ProfileTimer(CodeGenerator::CodeStream &codeStream, size_t profileIndex, bool profilingEnabled)
+    :   m_CodeStream(codeStream), m_ProfileIndex(profileIndex), m_ProfilingEnabled(profilingEnabled)
+    {
+        // Record start time
+        if(m_ProfilingEnabled) {
+            m_CodeStream << "const auto profileStart = std::chrono::high_resolution_clock::now();" << std::endl;
+        }
+    }
+
+    ~ProfileTimer()
+    {
+        // Add elapsed time to profile
+        if(m_ProfilingEnabled) {
+            m_CodeStream << "mergedGroupProfile[" << m_ProfileIndex << "].time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - profileStart).count();" << std::endl;
+        }
+    }
+
+private:
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    CodeGenerator::CodeStream &m_CodeStream;
+    const size_t m_ProfileIndex;
+    const bool m_ProfilingEnabled;
+};
+
+
+//--------------------------------------------------------------------------
+bool isProceduralRNGRequired(const CodeGenerator::ModelSpecMerged &modelMerged)
+{
+    // Return true if any synapse groups with procedural connectivity require an RNG to generate connectivity or weights
+    const ModelSpecInternal &model = modelMerged.getModel();
+    return std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+                       [](const ModelSpec::SynapseGroupValueType &s)
+                       {
+                           return (s.second.isProceduralConnectivityRNGRequired()
+                                   || ((s.second.getMatrixType() & SynapseMatrixWeight::PROCEDURAL)
+                                       && Utils::isRNGRequired(s.second.getWUVarInitialisers())));
+                       });
+}
+//--------------------------------------------------------------------------
+bool isNeuronVarReferencedBySpikeCode(const CodeGenerator::NeuronGroupMerged &ng)
+{
+    // Presynaptic and postsynaptic weight update model spike code reads neuron variables from memory. In the single-pass neuron update, 
+    // this happens before they are written back so it reads their values from the start of the timestep. However, in SIMD neuron update 
+    // mode, they would already have been written back by the state update pass so, to give the same results, these groups use a single pass
+    const auto vars = ng.getArchetype().getNeuronModel()->getVars();
+    const auto outSynWithPreCode = ng.getArchetype().getOutSynWithPreCode();
+    const auto inSynWithPostCode = ng.getArchetype().getInSynWithPostCode();
+    return std::any_of(vars.cbegin(), vars.cend(),
+                       [&outSynWithPreCode, &inSynWithPostCode](const Models::Base::Var &v)
+                       {
+                           return (std::any_of(outSynWithPreCode.cbegin(), outSynWithPreCode.cend(),
+                                               [&v](const SynapseGroupInternal *sg)
+                                               {
+                                                   return (sg->getWUModel()->getPreSpikeCode().find(v.name + "_pre") != std::string::npos);
+                                               })
+                                   || std::any_of(inSynWithPostCode.cbegin(), inSynWithPostCode.cend(),
+                                                  [&v](const SynapseGroupInternal *sg)
+                                                  {
+                                                      return (sg->getWUModel()->getPostSpikeCode().find(v.name + "_post") != std::string::npos);
+                                                  }));
+                       });
+}
+//--------------------------------------------------------------------------
+bool isSpikeFlagRequired(const CodeGenerator::NeuronGroupMerged &ng)
+{
+    // In SIMD neuron update mode, neurons which emit true spikes or spike-like events are flagged in the state update pass
+    return (!ng.getArchetype().getNeuronModel()->getThresholdConditionCode().empty()
+            || ng.getArchetype().isSpikeEventRequired());
+}
+//--------------------------------------------------------------------------
+void genSIMDLoopMacro(CodeGenerator::CodeStream &os)
+{
+    // Define macro used to tell compiler iterations of the following loop are independent so it can be vectorised
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// SIMD loop hint" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+#ifdef _WIN32
+    os << "#define GENN_SIMD_LOOP __pragma(loop(ivdep))" << std::endl;
+#else
+    os << "#if defined(__clang__)" << std::endl;
+    os << "#define GENN_SIMD_LOOP _Pragma(\"clang loop vectorize(assume_safety)\")" << std::endl;
+    os << "#else" << std::endl;
+    os << "#define GENN_SIMD_LOOP _Pragma(\"GCC ivdep\")" << std::endl;
+    os << "#endif" << std::endl;
+#endif
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void genHostAllocator(CodeGenerator::CodeStream &os, bool hugePages)
+{
+    using namespace CodeGenerator;
+
+    // Generate functions to allocate and free aligned host memory, mirroring BackendCPU::getHostAllocationSize
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// Aligned host allocation" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+#ifdef _WIN32
+    os << "#include <malloc.h>" << std::endl;
+#else
+    os << "#include <sys/mman.h>" << std::endl;
+#endif
+    os << "#include <cstdlib>" << std::endl;
+    os << "#include <new>" << std::endl;
+    os << std::endl;
+    os << "template<typename T>" << std::endl;
+    os << "T *gennAllocateHost(size_t count)";
+    {
+        CodeStream::Scope b(os);
+        os << "const size_t bytes = count * sizeof(T);" << std::endl;
+        if(hugePages) {
+            os << "const size_t alignment = (bytes >= " << hugePageSize << ") ? " << hugePageSize << " : " << hostAlignment << ";" << std::endl;
+        }
+        else {
+            os << "const size_t alignment = " << hostAlignment << ";" << std::endl;
+        }
+        os << "const size_t paddedBytes = std::max(alignment, ((bytes + alignment - 1) / alignment) * alignment);" << std::endl;
+#ifdef _WIN32
+        os << "void *ptr = _aligned_malloc(paddedBytes, alignment);" << std::endl;
+#else
+        os << "void *ptr = nullptr;" << std::endl;
+        os << "if(posix_memalign(&ptr, alignment, paddedBytes) != 0)";
+        {
+            CodeStream::Scope b(os);
+            os << "ptr = nullptr;" << std::endl;
+        }
+#endif
+        os << "if(ptr == nullptr)";
+        {
+            CodeStream::Scope b(os);
+            os << "throw std::bad_alloc();" << std::endl;
+        }
+#ifndef _WIN32
+        if(hugePages) {
+            os << "#ifdef MADV_HUGEPAGE" << std::endl;
+            os << "if(alignment == " << hugePageSize << ")";
+            {
+                CodeStream::Scope b(os);
+                os << "madvise(ptr, paddedBytes, MADV_HUGEPAGE);" << std::endl;
+            }
+            os << "#endif" << std::endl;
+        }
+#endif
+        os << "return static_cast<T*>(ptr);" << std::endl;
+    }
+    os << std::endl;
+    os << "inline void gennFreeHost(void *ptr)";
+    {
+        CodeStream::Scope b(os);
+#ifdef _WIN32
+        os << "_aligned_free(ptr);" << std::endl;
+#else
+        os << "free(ptr);" << std::endl;
+#endif
+    }
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void genFastDivisor(CodeGenerator::CodeStream &os)
+{
+    using namespace CodeGenerator;
+
+    // Generate class to divide by a divisor only known at runtime using a precomputed
+    // 'magic number' multiply and shifts rather than a hardware divide (Granlund & Montgomery 1994)
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// Fast division" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "class FastDivisor";
+    {
+        CodeStream::Scope b(os);
+        os << "public:" << std::endl;
+        os << "FastDivisor(uint32_t divisor)";
+        {
+            CodeStream::Scope b(os);
+            os << "// Find ceil(log2(divisor))" << std::endl;
+            os << "const uint64_t d = std::max(divisor, 1u);" << std::endl;
+            os << "uint32_t l = 0;" << std::endl;
+            os << "while((1ull << l) < d)";
+            {
+                CodeStream::Scope b(os);
+                os << "l++;" << std::endl;
+            }
+            os << "m_Magic = (uint32_t)(((1ull << 32) * ((1ull << l) - d)) / d) + 1;" << std::endl;
+            os << "m_Shift1 = std::min(l, 1u);" << std::endl;
+            os << "m_Shift2 = std::max(l, 1u) - 1;" << std::endl;
+        }
+        os << std::endl;
+        os << "uint32_t divide(uint32_t n) const";
+        {
+            CodeStream::Scope b(os);
+            os << "const uint32_t t = (uint32_t)(((uint64_t)m_Magic * n) >> 32);" << std::endl;
+            os << "return (t + ((n - t) >> m_Shift1)) >> m_Shift2;" << std::endl;
+        }
+        os << std::endl;
+        os << "private:" << std::endl;
+        os << "uint32_t m_Magic;" << std::endl;
+        os << "uint32_t m_Shift1;" << std::endl;
+        os << "uint32_t m_Shift2;" << std::endl;
+    }
+    os << ";" << std::endl;
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+bool isFastDivisorRequired(const CodeGenerator::ModelSpecMerged &modelMerged)
+{
+    // Fast division is used to calculate presynaptic index in sparse postsynaptic learning
+    const auto &postUpdateGroups = modelMerged.getMergedPostsynapticUpdateGroups();
+    return std::any_of(postUpdateGroups.cbegin(), postUpdateGroups.cend(),
+                       [](const CodeGenerator::SynapseGroupMerged &s)
+                       {
+                           return (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE);
+                       });
+}
+//--------------------------------------------------------------------------
+bool isRaggedConnectivity(SynapseMatrixType matrixType)
+{
+    // Both sparse and CSR connectivity are stored as rows of postsynaptic indices
+    return ((matrixType & SynapseMatrixConnectivity::SPARSE) || (matrixType & SynapseMatrixConnectivity::CSR));
+}
+//--------------------------------------------------------------------------
+std::string getRowLength(SynapseMatrixType matrixType, const std::string &row)
+{
+    // CSR rows are delimited by consecutive row pointers
+    if(matrixType & SynapseMatrixConnectivity::CSR) {
+        return "(group.rowPtr[" + row + " + 1] - group.rowPtr[" + row + "])";
+    }
+    else {
+        return "group.rowLength[" + row + "]";
+    }
+}
+//--------------------------------------------------------------------------
+std::string getRowStart(SynapseMatrixType matrixType, const std::string &row)
+{
+    // CSR rows are packed so start at row pointer whereas sparse rows are padded to row stride
+    if(matrixType & SynapseMatrixConnectivity::CSR) {
+        return "group.rowPtr[" + row + "]";
+    }
+    else {
+        return "(" + row + " * group.rowStride)";
+    }
+}
+//--------------------------------------------------------------------------
+void genCompressedIndRowStart(CodeGenerator::CodeStream &os, const std::string &row)
+{
+    // Point at start of compressed row and reset decoder state
+    os << "const uint8_t *packedInd = group.indPacked + group.indPackedRowPtr[" << row << "];" << std::endl;
+    os << "unsigned int packedIndWidth = 0;" << std::endl;
+    os << "unsigned int packedIndBlockRemaining = 0;" << std::endl;
+    os << "uint32_t packedIndPost = 0;" << std::endl;
+}
+//--------------------------------------------------------------------------
+void genCompressedIndDecode(CodeGenerator::CodeStream &os, const std::string &indexName)
+{
+    // If block is complete, read width and length of next block from header
+    os << "if(packedIndBlockRemaining == 0)";
+    {
+        CodeGenerator::CodeStream::Scope b(os);
+        os << "packedIndWidth = packedInd[0] & 7;" << std::endl;
+        os << "packedIndBlockRemaining = (packedInd[0] >> 3) + 1;" << std::endl;
+        os << "packedInd++;" << std::endl;
+    }
+    os << "packedIndBlockRemaining--;" << std::endl;
+
+    // Read little-endian difference from previous index and add to it
+    // **NOTE** the width is constant within each block so these branches are very predictable
+    os << "if(packedIndWidth == 1)";
+    {
+        CodeGenerator::CodeStream::Scope b(os);
+        os << "packedIndPost += packedInd[0];" << std::endl;
+    }
+    os << "else if(packedIndWidth == 2)";
+    {
+        CodeGenerator::CodeStream::Scope b(os);
+        os << "packedIndPost += (uint32_t)packedInd[0] | ((uint32_t)packedInd[1] << 8);" << std::endl;
+    }
+    os << "else";
+    {
+        CodeGenerator::CodeStream::Scope b(os);
+        os << "packedIndPost += (uint32_t)packedInd[0] | ((uint32_t)packedInd[1] << 8) | ((uint32_t)packedInd[2] << 16) | ((uint32_t)packedInd[3] << 24);" << std::endl;
+    }
+    os << "packedInd += packedIndWidth;" << std::endl;
+    os << "const unsigned int " << indexName << " = packedIndPost;" << std::endl;
+}
+//--------------------------------------------------------------------------
+std::string getRNGStreamKey(RNGStream stream, size_t mergedGroupIndex, const std::string &groupIndex)
+{
+    // Combine stream domain, merged group and group within merged group into a 64-bit stream id which is hashed with seed
+    return "gennRNGKey(rngSeed, (" + std::to_string(static_cast<uint64_t>(stream) << 48) + "ull | (" + std::to_string(mergedGroupIndex) + "ull << 32) | " + groupIndex + "))";
+}
+//--------------------------------------------------------------------------
+void genInitRNGKey(CodeGenerator::CodeStream &os, RNGStream stream, size_t mergedGroupIndex)
+{
+    // Calculate key for group's stream and zero the sequence used to give each initialised variable an independent sub-stream
+    os << "const uint64_t initRNGKey = " << getRNGStreamKey(stream, mergedGroupIndex, "g") << ";" << std::endl;
+    os << "unsigned int initRNGSequence = 0;" << std::endl;
+}
+//--------------------------------------------------------------------------
+template<typename T>
+void genTable(CodeGenerator::CodeStream &os, const std::string &type, const std::string &name, const std::vector<T> &values)
+{
+    os << "static const " << type << " " << name << "[" << values.size() << "] = {";
+    for(size_t i = 0; i < values.size(); i++) {
+        os << ((i % 4) == 0 ? "\n    " : " ") << std::setprecision(17) << values[i] << ((i == (values.size() - 1)) ? "" : ",");
+    }
+    os << "};" << std::endl;
+}
+//--------------------------------------------------------------------------
+void genZigguratTables(CodeGenerator::CodeStream &os)
+{
+    // Build tables for 128 layer normal and 256 layer exponential Ziggurats as described by Marsaglia and Tsang (2000)
+    // **NOTE** samples are formed from signed or unsigned 32-bit integers which are compared against the K tables
+    // and whose low bits, which select the layer, are masked out so the layer and position within it are independent
+    std::vector<uint32_t> kn(128), ke(256);
+    std::vector<double> wn(128), fn(128), we(256), fe(256);
+    {
+        const double m1 = 2147483648.0;
+        const double vn = 9.91256303526217e-3;
+        double dn = 3.442619855899;
+        double tn = dn;
+        const double q = vn / std::exp(-0.5 * dn * dn);
+        kn[0] = (uint32_t)((dn / q) * m1);
+        kn[1] = 0;
+        wn[0] = q / m1;
+        wn[127] = dn / m1;
+        fn[0] = 1.0;
+        fn[127] = std::exp(-0.5 * dn * dn);
+        for(int i = 126; i >= 1; i--) {
+            dn = std::sqrt(-2.0 * std::log((vn / dn) + std::exp(-0.5 * dn * dn)));
+            kn[i + 1] = (uint32_t)((dn / tn) * m1);
+            tn = dn;
+            fn[i] = std::exp(-0.5 * dn * dn);
+            wn[i] = dn / m1;
+        }
+    }
+    {
+        const double m2 = 4294967296.0;
+        const double ve = 3.949659822581572e-3;
+        double de = 7.697117470131487;
+        double te = de;
+        const double q = ve / std::exp(-de);
+        ke[0] = (uint32_t)((de / q) * m2);
+        ke[1] = 0;
+        we[0] = q / m2;
+        we[255] = de / m2;
+        fe[0] = 1.0;
+        fe[255] = std::exp(-de);
+        for(int i = 254; i >= 1; i--) {
+            de = -std::log((ve / de) + std::exp(-de));
+            ke[i + 1] = (uint32_t)((de / te) * m2);
+            te = de;
+            fe[i] = std::exp(-de);
+            we[i] = de / m2;
+        }
+    }
+
+    os << "// Ziggurat tables for normal and exponential distributions (Marsaglia and Tsang 2000)" << std::endl;
+    genTable(os, "uint32_t", "gennZigguratNormalK", kn);
+    genTable(os, "double", "gennZigguratNormalW", wn);
+    genTable(os, "double", "gennZigguratNormalF", fn);
+    genTable(os, "uint32_t", "gennZigguratExpK", ke);
+    genTable(os, "double", "gennZigguratExpW", we);
+    genTable(os, "double", "gennZigguratExpF", fe);
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void genPhiloxRNG(CodeGenerator::CodeStream &os, const std::string &precision)
+{
+    using namespace CodeGenerator;
+
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// counter-based RNG" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// Philox4x32-10 counter-based random number generator (Salmon et al. 2011) keyed on a hashed seed and stream," << std::endl;
+    os << "// with counter formed from draw index, id and timestep. Meets the requirements of UniformRandomBitGenerator" << std::endl;
+    os << "class Philox4x32";
+    {
+        CodeStream::Scope b(os);
+        os << "public:" << std::endl;
+        os << "typedef uint32_t result_type;" << std::endl;
+        os << std::endl;
+        os << "Philox4x32(uint64_t key, uint32_t id, uint64_t step = 0) : m_Index(4)";
+        {
+            CodeStream::Scope b(os);
+            os << "m_Key[0] = (uint32_t)key;" << std::endl;
+            os << "m_Key[1] = (uint32_t)(key >> 32);" << std::endl;
+            os << "m_Counter[0] = 0;" << std::endl;
+            os << "m_Counter[1] = id;" << std::endl;
+            os << "m_Counter[2] = (uint32_t)step;" << std::endl;
+            os << "m_Counter[3] = (uint32_t)(step >> 32);" << std::endl;
+        }
+        os << std::endl;
+        os << "// Construct RNG whose first block of output has already been generated by gennPhiloxFirstBlocks" << std::endl;
+        os << "Philox4x32(uint64_t key, uint32_t id, uint64_t step, const uint32_t *firstBlock, unsigned int stride) : Philox4x32(key, id, step)";
+        {
+            CodeStream::Scope b(os);
+            os << "m_Output[0] = firstBlock[0];" << std::endl;
+            os << "m_Output[1] = firstBlock[stride];" << std::endl;
+            os << "m_Output[2] = firstBlock[2 * stride];" << std::endl;
+            os << "m_Output[3] = firstBlock[3 * stride];" << std::endl;
+            os << "m_Counter[0] = 1;" << std::endl;
+            os << "m_Index = 0;" << std::endl;
+        }
+        os << std::endl;
+        os << "static constexpr result_type min(){ return 0; }" << std::endl;
+        os << "static constexpr result_type max(){ return 0xFFFFFFFFu; }" << std::endl;
+        os << std::endl;
+        os << "result_type operator()()";
+        {
+            CodeStream::Scope b(os);
+            os << "if(m_Index == 4)";
+            {
+                CodeStream::Scope b(os);
+                os << "generate();" << std::endl;
+                os << "m_Index = 0;" << std::endl;
+            }
+            os << "return m_Output[m_Index++];" << std::endl;
+        }
+        os << std::endl;
+        os << "private:" << std::endl;
+        os << "void generate()";
+        {
+            CodeStream::Scope b(os);
+            os << "uint32_t ctr[4] = {m_Counter[0], m_Counter[1], m_Counter[2], m_Counter[3]};" << std::endl;
+            os << "uint32_t key0 = m_Key[0];" << std::endl;
+            os << "uint32_t key1 = m_Key[1];" << std::endl;
+            os << "for(int r = 0; r < 10; r++)";
+            {
+                CodeStream::Scope b(os);
+                os << "const uint64_t prod0 = (uint64_t)0xD2511F53u * ctr[0];" << std::endl;
+                os << "const uint64_t prod1 = (uint64_t)0xCD9E8D57u * ctr[2];" << std::endl;
+                os << "ctr[0] = (uint32_t)(prod1 >> 32) ^ ctr[1] ^ key0;" << std::endl;
+                os << "ctr[1] = (uint32_t)prod1;" << std::endl;
+                os << "ctr[2] = (uint32_t)(prod0 >> 32) ^ ctr[3] ^ key1;" << std::endl;
+                os << "ctr[3] = (uint32_t)prod0;" << std::endl;
+                os << "key0 += 0x9E3779B9u;" << std::endl;
+                os << "key1 += 0xBB67AE85u;" << std::endl;
+            }
+            os << "std::copy_n(ctr, 4, m_Output);" << std::endl;
+            os << "m_Counter[0]++;" << std::endl;
+        }
+        os << std::endl;
+        os << "uint32_t m_Counter[4];" << std::endl;
+        os << "uint32_t m_Key[2];" << std::endl;
+        os << "uint32_t m_Output[4];" << std::endl;
+        os << "unsigned int m_Index;" << std::endl;
+    }
+    os << ";" << std::endl;
+    os << std::endl;
+
+    // Hash seed and stream into key using SplitMix64 finaliser
+    os << "inline uint64_t gennRNGKey(uint64_t seed, uint64_t stream)";
+    {
+        CodeStream::Scope b(os);
+        os << "uint64_t z = seed + ((stream + 1) * 0x9E3779B97F4A7C15ull);" << std::endl;
+        os << "z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;" << std::endl;
+        os << "z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;" << std::endl;
+        os << "return z ^ (z >> 31);" << std::endl;
+    }
+    os << std::endl;
+
+    // Generate first block of output for a range of ids in one vectorisable loop, writing each of the 4 words of a
+    // block to a separate array of the given stride so the stores are contiguous
+    os << "inline void gennPhiloxFirstBlocks(uint64_t key, uint64_t step, unsigned int begin, unsigned int end, uint32_t *blocks, unsigned int stride)";
+    {
+        CodeStream::Scope b(os);
+        os << "uint32_t *blocks0 = blocks;" << std::endl;
+        os << "uint32_t *blocks1 = blocks + stride;" << std::endl;
+        os << "uint32_t *blocks2 = blocks + (2 * stride);" << std::endl;
+        os << "uint32_t *blocks3 = blocks + (3 * stride);" << std::endl;
+        os << "for(unsigned int i = begin; i < end; i++)";
+        {
+            CodeStream::Scope b(os);
+            os << "uint32_t ctr0 = 0;" << std::endl;
+            os << "uint32_t ctr1 = i;" << std::endl;
+            os << "uint32_t ctr2 = (uint32_t)step;" << std::endl;
+            os << "uint32_t ctr3 = (uint32_t)(step >> 32);" << std::endl;
+            os << "uint32_t key0 = (uint32_t)key;" << std::endl;
+            os << "uint32_t key1 = (uint32_t)(key >> 32);" << std::endl;
+            os << "for(int r = 0; r < 10; r++)";
+            {
+                CodeStream::Scope b(os);
+                os << "const uint64_t prod0 = (uint64_t)0xD2511F53u * ctr0;" << std::endl;
+                os << "const uint64_t prod1 = (uint64_t)0xCD9E8D57u * ctr2;" << std::endl;
+                os << "ctr0 = (uint32_t)(prod1 >> 32) ^ ctr1 ^ key0;" << std::endl;
+                os << "ctr1 = (uint32_t)prod1;" << std::endl;
+                os << "ctr2 = (uint32_t)(prod0 >> 32) ^ ctr3 ^ key1;" << std::endl;
+                os << "ctr3 = (uint32_t)prod0;" << std::endl;
+                os << "key0 += 0x9E3779B9u;" << std::endl;
+                os << "key1 += 0xBB67AE85u;" << std::endl;
+            }
+            os << "blocks0[i] = ctr0;" << std::endl;
+            os << "blocks1[i] = ctr1;" << std::endl;
+            os << "blocks2[i] = ctr2;" << std::endl;
+            os << "blocks3[i] = ctr3;" << std::endl;
+        }
+    }
+    os << std::endl;
+
+    genZigguratTables(os);
+
+    // Generate stateless distributions in model precision
+    // **NOTE** uniform samples are in (0, 1) so they can be safely logged
+    const std::string &p = precision;
+    os << "inline " << p << " gennUniform(Philox4x32 &rng)";
+    {
+        CodeStream::Scope b(os);
+        if(p == "double") {
+            os << "const uint64_t hi = rng() >> 5;" << std::endl;
+            os << "const uint64_t lo = rng() >> 6;" << std::endl;
+            os << "return ((double)((hi << 26) | lo) + 0.5) * (1.0 / 9007199254740992.0);" << std::endl;
+        }
+        else {
+            os << "return ((float)(rng() >> 8) + 0.5f) * (1.0f / 16777216.0f);" << std::endl;
+        }
+    }
+    os << std::endl;
+    os << "// Ziggurat method - almost all samples only require a single 32-bit word and a table lookup" << std::endl;
+    os << "// **NOTE** the low bits of the word select the layer and the remaining bits the position within it" << std::endl;
+    os << "inline " << p << " gennNormal(Philox4x32 &rng)";
+    {
+        CodeStream::Scope b(os);
+        os << "while(true)";
+        {
+            CodeStream::Scope b(os);
+            os << "const uint32_t u = rng();" << std::endl;
+            os << "const int32_t hz = (int32_t)(u & 0xFFFFFF80u);" << std::endl;
+            os << "const unsigned int iz = u & 127;" << std::endl;
+            os << "const double x = hz * gennZigguratNormalW[iz];" << std::endl;
+            os << "if(((hz < 0) ? (0u - (uint32_t)hz) : (uint32_t)hz) < gennZigguratNormalK[iz])";
+            {
+                CodeStream::Scope b(os);
+                os << "return (" << p << ")x;" << std::endl;
+            }
+            os << "else if(iz == 0)";
+            {
+                CodeStream::Scope b(os);
+                os << "double tx;" << std::endl;
+                os << "double ty;" << std::endl;
+                os << "do";
+                {
+                    CodeStream::Scope b(os);
+                    os << "tx = -std::log((double)gennUniform(rng)) / 3.442619855899;" << std::endl;
+                    os << "ty = -std::log((double)gennUniform(rng));" << std::endl;
+                }
+                os << "while((ty + ty) < (tx * tx));" << std::endl;
+                os << "return (" << p << ")((hz > 0) ? (3.442619855899 + tx) : (-3.442619855899 - tx));" << std::endl;
+            }
+            os << "else if((gennZigguratNormalF[iz] + (gennUniform(rng) * (gennZigguratNormalF[iz - 1] - gennZigguratNormalF[iz]))) < std::exp(-0.5 * x * x))";
+            {
+                CodeStream::Scope b(os);
+                os << "return (" << p << ")x;" << std::endl;
+            }
+        }
+    }
+    os << std::endl;
+    os << "inline " << p << " gennExponential(Philox4x32 &rng)";
+    {
+        CodeStream::Scope b(os);
+        os << "while(true)";
+        {
+            CodeStream::Scope b(os);
+            os << "const uint32_t u = rng();" << std::endl;
+            os << "const uint32_t jz = u & 0xFFFFFF00u;" << std::endl;
+            os << "const unsigned int iz = u & 255;" << std::endl;
+            os << "const double x = jz * gennZigguratExpW[iz];" << std::endl;
+            os << "if(jz < gennZigguratExpK[iz])";
+            {
+                CodeStream::Scope b(os);
+                os << "return (" << p << ")x;" << std::endl;
+            }
+            os << "else if(iz == 0)";
+            {
+                CodeStream::Scope b(os);
+                os << "return (" << p << ")(7.697117470131487 - std::log((double)gennUniform(rng)));" << std::endl;
+            }
+            os << "else if((gennZigguratExpF[iz] + (gennUniform(rng) * (gennZigguratExpF[iz - 1] - gennZigguratExpF[iz]))) < std::exp(-x))";
+            {
+                CodeStream::Scope b(os);
+                os << "return (" << p << ")x;" << std::endl;
+            }
+        }
+    }
+    os << std::endl;
+    os << "inline " << p << " gennLogNormal(Philox4x32 &rng, " << p << " mean, " << p << " stddev)";
+    {
+        CodeStream::Scope b(os);
+        os << "return std::exp(mean + (stddev * gennNormal(rng)));" << std::endl;
+    }
+    os << std::endl;
+    os << "// Marsaglia and Tsang's method" << std::endl;
+    os << "inline " << p << " gennGamma(Philox4x32 &rng, " << p << " a)";
+    {
+        CodeStream::Scope b(os);
+        os << "if(a < 1)";
+        {
+            CodeStream::Scope b(os);
+            os << "return gennGamma(rng, a + 1) * std::pow(gennUniform(rng), 1 / a);" << std::endl;
+        }
+        os << "const " << p << " d = a - (" << p << ")(1.0 / 3.0);" << std::endl;
+        os << "const " << p << " c = 1 / std::sqrt(9 * d);" << std::endl;
+        os << "while(true)";
+        {
+            CodeStream::Scope b(os);
+            os << p << " x;" << std::endl;
+            os << p << " v;" << std::endl;
+            os << "do";
+            {
+                CodeStream::Scope b(os);
+                os << "x = gennNormal(rng);" << std::endl;
+                os << "v = 1 + (c * x);" << std::endl;
+            }
+            os << "while(v <= 0);" << std::endl;
+            os << "v = v * v * v;" << std::endl;
+            os << "const " << p << " u = gennUniform(rng);" << std::endl;
+            os << "if(u < 1 - (" << p << ")0.0331 * x * x * x * x || std::log(u) < (" << p << ")0.5 * x * x + d * (1 - v + std::log(v)))";
+            {
+                CodeStream::Scope b(os);
+                os << "return d * v;" << std::endl;
+            }
+        }
+    }
+    os << std::endl;
+}
+}
+
+//--------------------------------------------------------------------------
+// CodeGenerator::BackendCPU
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+void BackendCPU::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
+                                 NeuronGroupSimHandler simHandler, NeuronGroupMergedHandler wuVarUpdateHandler,
+                                 HostHandler pushEGPHandler) const
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+    const unsigned int batchSize = model.getBatchSize();
+
+    // If SIMD neuron update is enabled, declare aligned buffer large enough to hold spike flags for the largest group which needs them
+    if(getPreferences().enableSIMDNeuronUpdate) {
+        size_t maxFlagNeurons = 0;
+        for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
+            if(isSpikeFlagRequired(n) && !isNeuronVarReferencedBySpikeCode(n)) {
+                for(const auto &g : n.getGroups()) {
+                    maxFlagNeurons = std::max(maxFlagNeurons, (size_t)g.get().getNumNeurons());
+                }
+            }
+        }
+        if(maxFlagNeurons > 0) {
+            os << "alignas(64) static uint8_t neuronSpikeFlags[" << padSize(maxFlagNeurons * batchSize, 64) << "];" << std::endl;
+            os << std::endl;
+        }
+    }
+
+    // Declare aligned buffer large enough to hold the first block of simulation RNG output for each neuron in the largest group which needs them
+    // **NOTE** these are generated for the whole group in one vectorised pass, covering the random numbers most neuron models draw each timestep
+    size_t maxRNGNeurons = 0;
+    for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
+        if(n.getArchetype().isSimRNGRequired()) {
+            for(const auto &g : n.getGroups()) {
+                maxRNGNeurons = std::max(maxRNGNeurons, (size_t)g.get().getNumNeurons());
+            }
+        }
+    }
+    // **NOTE** in batched models, each batch of each neuron has its own stream so blocks are generated for all of them
+    const size_t simRNGBlockStride = padSize(maxRNGNeurons * batchSize, 16);
+    if(maxRNGNeurons > 0) {
+        os << "alignas(64) static uint32_t simRNGBlocks[" << (4 * simRNGBlockStride) << "];" << std::endl;
+        os << std::endl;
+    }
+
+    // Push any required EGPs
+    os << "void pushNeuronUpdateEGPs()";
+    {
+        CodeStream::Scope b(os);
+        pushEGPHandler(os);
+    }
+    os << std::endl;
+
+    os << "void updateNeuronsInternal(" << model.getTimePrecision() << " t";
+    if(model.isRecordingInUse()) {
+        os << ", unsigned int recordingTimestep";
+    }
+    os << ")";
+    {
+        CodeStream::Scope b(os);
+
+        Substitutions funcSubs(cpuFunctions, model.getPrecision());
+        funcSubs.addVarSubstitution("t", "t");
+
+        Timer t(os, "neuronUpdate", model.isTimingEnabled());
+
+        // Loop through merged neuron spike queue update groups
+        for(const auto &n : modelMerged.getMergedNeuronSpikeQueueUpdateGroups()) {
+            CodeStream::Scope b(os);
+            os << "// merged neuron spike queue update group " << n.getIndex() << std::endl;
+            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Get reference to group
+                os << "const auto &group = mergedNeuronSpikeQueueUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+
+                // Generate spike count reset
+                genMergedGroupSpikeCountReset(os, n, batchSize);
+            }
+            
+        }
+        // Loop through merged neuron update groups
+        for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
+            CodeStream::Scope b(os);
+            os << "// merged neuron update group " << n.getIndex() << std::endl;
+            ProfileTimer profileTimer(os, modelMerged.getNeuronUpdateProfileOffset() + n.getIndex(), model.isProfilingEnabled());
+            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Get reference to group
+                os << "const auto &group = mergedNeuronUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+
+                // If axonal delays are required
+                if(n.getArchetype().isDelayRequired()) {
+                    // We should READ from delay slot before spkQuePtr
+                    os << "const unsigned int readDelayOffset = " << n.getPrevQueueOffset() << ";" << std::endl;
+
+                    // And we should WRITE to delay slot pointed to be spkQuePtr
+                    os << "const unsigned int writeDelayOffset = " << n.getCurrentQueueOffset() << ";" << std::endl;
+                }
+
+                // If this neuron group requires a simulation RNG, calculate key for this group's stream
+                // and, before processing each range of neurons, generate the first block for each neuron in it
+                RangeHandler simRNGBlocksHandler;
+                if(n.getArchetype().isSimRNGRequired()) {
+                    os << "const uint64_t simRNGKey = " << getRNGStreamKey(RNGStream::NEURON_SIM, n.getIndex(), "g") << ";" << std::endl;
+                    simRNGBlocksHandler =
+                        [simRNGBlockStride, batchSize](CodeStream &os, const std::string &begin, const std::string &end)
+                        {
+                            const std::string batchedBegin = (batchSize == 1) ? begin : ("(" + begin + ") * " + std::to_string(batchSize));
+                            const std::string batchedEnd = (batchSize == 1) ? end : ("(" + end + ") * " + std::to_string(batchSize));
+                            os << "gennPhiloxFirstBlocks(simRNGKey, iT, " << batchedBegin << ", " << batchedEnd << ", simRNGBlocks, " << simRNGBlockStride << ");" << std::endl;
+                        };
+                }
+
+                // If spike recording is enabled, get pointer to this timestep's words in recording buffer and clear them
+                // **NOTE** in batched models, each batch has its own recording buffer, numRecordingTimesteps long
+                if(n.getArchetype().isSpikeRecordingEnabled()) {
+                    os << "const unsigned int numRecordingWords = (group.numNeurons + 31) / 32;" << std::endl;
+                    os << "uint32_t *recordSpk = group.recordSpk + (recordingTimestep * numRecordingWords);" << std::endl;
+                    genBatchLoop(os, batchSize,
+                        [batchSize](CodeStream &os)
+                        {
+                            os << "std::fill_n(recordSpk" << ((batchSize == 1) ? "" : " + (batch * numRecordingTimesteps * numRecordingWords)") << ", numRecordingWords, 0);" << std::endl;
+                        });
+                }
+                os << std::endl;
+
+                // If SIMD neuron update is enabled, split update into a vectorisable state update pass, which only flags
+                // which neurons spiked, and a second pass which emits spikes and performs the associated WU var updates
+                // **NOTE** each neuron has its own counter-based RNG stream so results don't depend on how neurons are split between threads
+                // **NOTE** in batched models, each neuron's batches are updated in an inner loop which, as variables are stored
+                // with the batch innermost, is the loop that accesses memory contiguously and is therefore vectorised
+                const std::string batchedID = getBatchedVarIndex(batchSize, "i");
+                if(getPreferences().enableSIMDNeuronUpdate && !isNeuronVarReferencedBySpikeCode(n)) {
+                    const bool spikeFlagRequired = isSpikeFlagRequired(n);
+                    genParallelFor(os, "i", "group.numNeurons", ParallelLoop::NEURON, (batchSize == 1), simRNGBlocksHandler,
+                        [&](CodeStream &os)
+                        {
+                            if(batchSize > 1) {
+                                os << "GENN_SIMD_LOOP" << std::endl;
+                            }
+                            genBatchLoop(os, batchSize,
+                                [&](CodeStream &os)
+                                {
+                                    Substitutions popSubs(&funcSubs);
+                                    popSubs.addVarSubstitution("id", "i");
+
+                                    // If this neuron group requires a simulation RNG, create counter-based RNG for this neuron and timestep
+                                    if(n.getArchetype().isSimRNGRequired()) {
+                                        os << "Philox4x32 simRNG(simRNGKey, " << batchedID << ", iT, &simRNGBlocks[" << batchedID << "], " << simRNGBlockStride << ");" << std::endl;
+                                        popSubs.addVarSubstitution("rng", "simRNG");
+                                    }
+
+                                    // **NOTE** flags are accumulated in a local so the only store to the flag buffer is unconditional
+                                    if(spikeFlagRequired) {
+                                        os << "uint8_t spikeFlags = 0;" << std::endl;
+                                    }
+                                    simHandler(os, n, popSubs,
+                                               // Flag true spikes
+                                               [](CodeStream &os, const NeuronGroupMerged&, Substitutions&)
+                                               {
+                                                   os << "spikeFlags |= 1;" << std::endl;
+                                               },
+                                               // Flag spike-like events
+                                               [](CodeStream &os, const NeuronGroupMerged&, Substitutions&)
+                                               {
+                                                   os << "spikeFlags |= 2;" << std::endl;
+                                               });
+                                    if(spikeFlagRequired) {
+                                        os << "neuronSpikeFlags[" << batchedID << "] = spikeFlags;" << std::endl;
+                                    }
+                                });
+                        });
+
+                    // If any neurons may have been flagged, loop through flags and emit spikes
+                    if(spikeFlagRequired) {
+                        genParallelFor(os, "i", "group.numNeurons", ParallelLoop::NEURON, false, RangeHandler(),
+                            [&](CodeStream &os)
+                            {
+                                genBatchLoop(os, batchSize,
+                                    [&](CodeStream &os)
+                                    {
+                                        Substitutions popSubs(&funcSubs);
+                                        popSubs.addVarSubstitution("id", "i");
+
+                                        os << "const uint8_t spikeFlags = neuronSpikeFlags[" << batchedID << "];" << std::endl;
+                                        if(n.getArchetype().isSpikeEventRequired()) {
+                                            os << "if(spikeFlags & 2)";
+                                            {
+                                                CodeStream::Scope b(os);
+                                                genEmitSpike(os, n, popSubs, false, batchSize);
+                                            }
+                                        }
+                                        if(!n.getArchetype().getNeuronModel()->getThresholdConditionCode().empty()) {
+                                            os << "if(spikeFlags & 1)";
+                                            {
+                                                CodeStream::Scope b(os);
+                                                genEmitSpike(os, n, popSubs, true, batchSize);
+                                                wuVarUpdateHandler(os, n, popSubs);
+                                            }
+                                        }
+                                    });
+                            });
+                    }
+                }
+                else {
+                    genParallelFor(os, "i", "group.numNeurons", ParallelLoop::NEURON, false, simRNGBlocksHandler,
+                        [&](CodeStream &os)
+                        {
+                            genBatchLoop(os, batchSize,
+                                [&](CodeStream &os)
+                                {
+                                    Substitutions popSubs(&funcSubs);
+                                    popSubs.addVarSubstitution("id", "i");
+
+                                    // If this neuron group requires a simulation RNG, create counter-based RNG for this neuron and timestep
+                                    if(n.getArchetype().isSimRNGRequired()) {
+                                        os << "Philox4x32 simRNG(simRNGKey, " << batchedID << ", iT, &simRNGBlocks[" << batchedID << "], " << simRNGBlockStride << ");" << std::endl;
+                                        popSubs.addVarSubstitution("rng", "simRNG");
+                                    }
+
+                                    simHandler(os, n, popSubs,
+                                               // Emit true spikes
+                                               [this, wuVarUpdateHandler, batchSize](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                               {
+                                                   // Insert code to emit true spikes
+                                                   genEmitSpike(os, ng, subs, true, batchSize);
+
+                                                   // Insert code to update WU vars
+                                                   wuVarUpdateHandler(os, ng, subs);
+                                               },
+                                               // Emit spike-like events
+                                               [this, batchSize](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &subs)
+                                               {
+                                                   // Insert code to emit spike-like events
+                                                   genEmitSpike(os, ng, subs, false, batchSize);
+                                               });
+                                });
+                        });
+                }
+
+                // If profiling is enabled, add number of spikes emitted by this group in each batch to profile
+                if(model.isProfilingEnabled() && !n.getArchetype().getNeuronModel()->getThresholdConditionCode().empty()) {
+                    const bool spikeDelayRequired = n.getArchetype().isDelayRequired() && n.getArchetype().isTrueSpikeRequired();
+                    genBatchLoop(os, batchSize,
+                        [&](CodeStream &os)
+                        {
+                            const std::string numDelaySlots = std::to_string(n.getArchetype().getNumDelaySlots());
+                            genProfileAdd(os, modelMerged.getNeuronUpdateProfileOffset() + n.getIndex(), "numSpikes",
+                                          spikeDelayRequired ? ("group.spkCnt[" + getBatchOffset(batchSize, numDelaySlots) + "*group.spkQuePtr]")
+                                                             : ((batchSize == 1) ? "group.spkCnt[0]" : "group.spkCnt[batch]"));
+                        });
+                }
+            }
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
+                                  SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                                  SynapseGroupMergedHandler wumEventHandler, SynapseGroupMergedHandler wumProceduralConnectHandler,
+                                  SynapseGroupMergedHandler postLearnHandler, SynapseGroupMergedHandler synapseDynamicsHandler,
+                                  HostHandler pushEGPHandler) const
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+    const unsigned int batchSize = model.getBatchSize();
+
+    // Push any required EGPs
+    os << "void pushSynapseUpdateEGPs()";
+    {
+        CodeStream::Scope b(os);
+        pushEGPHandler(os);
+    }
+    os << std::endl;
+
+    os << "void updateSynapsesInternal(" << model.getTimePrecision() << " t)";
+    {
+        CodeStream::Scope b(os);
+        Substitutions funcSubs(cpuFunctions, model.getPrecision());
+        funcSubs.addVarSubstitution("t", "t");
+
+        // Synapse dynamics
+        {
+            // Loop through merged synapse dynamics groups
+            Timer t(os, "synapseDynamics", model.isTimingEnabled());
+            for(const auto &s : modelMerged.getMergedSynapseDynamicsGroups()) {
+                CodeStream::Scope b(os);
+                os << "// merged synapse dynamics group " << s.getIndex() << std::endl;
+                const size_t profileIndex = modelMerged.getSynapseDynamicsProfileOffset() + s.getIndex();
+                ProfileTimer profileTimer(os, profileIndex, model.isProfilingEnabled());
+                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                {
+                    CodeStream::Scope b(os);
+
+                    // Get reference to group
+                    os << "const auto &group = mergedSynapseDynamicsGroup" << s.getIndex() << "[g]; " << std::endl;
+
+                    // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
+                    if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+                        os << "const unsigned int preReadDelayOffset = " << s.getPresynapticAxonalDelaySlot() << " * group.numSrcNeurons;" << std::endl;
+                    }
+
+                    // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
+                    if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
+                        os << "const unsigned int postReadDelayOffset = " << s.getPostsynapticBackPropDelaySlot() << " * group.numTrgNeurons;" << std::endl;
+                    }
+
+                    // If profiling is enabled, add rows traversed to profile along with synapses processed if connectivity is dense
+                    if(model.isProfilingEnabled()) {
+                        genProfileAdd(os, profileIndex, "numRows", "group.numSrcNeurons");
+                        if(!isRaggedConnectivity(s.getArchetype().getMatrixType())) {
+                            genProfileAdd(os, profileIndex, "numSynapticEvents", "(uint64_t)group.numSrcNeurons * group.numTrgNeurons");
+                        }
+                    }
+
+                    // Loop through presynaptic neurons, splitting rows across threads
+                    genParallelFor(os, "i", "group.numSrcNeurons", ParallelLoop::ROW, false, RangeHandler(),
+                        [&](CodeStream &os)
+                        {
+                            // If this synapse group has sparse connectivity, loop through length of this row
+                            if(isRaggedConnectivity(s.getArchetype().getMatrixType())) {
+                                if(model.isProfilingEnabled()) {
+                                    genProfileAdd(os, profileIndex, "numSynapticEvents", getRowLength(s.getArchetype().getMatrixType(), "i"));
+                                }
+                                if(s.getArchetype().isCompressedSparseIndEnabled()) {
+                                    genCompressedIndRowStart(os, "i");
+                                }
+                                os << "for(unsigned int s = 0; s < " << getRowLength(s.getArchetype().getMatrixType(), "i") << "; s++)";
+                            }
+                            // Otherwise, if it's dense, loop through each postsynaptic neuron
+                            else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+                                os << "for (unsigned int j = 0; j < group.numTrgNeurons; j++)";
+                            }
+                            else {
+                                throw std::runtime_error("Only DENSE, SPARSE and CSR format connectivity can be used for synapse dynamics");
+                            }
+                            {
+                                CodeStream::Scope b(os);
+
+                                Substitutions synSubs(&funcSubs);
+                                if(isRaggedConnectivity(s.getArchetype().getMatrixType())) {
+                                    // Calculate index of synapse and use it to look up postsynaptic index
+                                    os << "const unsigned int n = " << getRowStart(s.getArchetype().getMatrixType(), "i") << " + s;" << std::endl;
+                                    if(s.getArchetype().isCompressedSparseIndEnabled()) {
+                                        genCompressedIndDecode(os, "j");
+                                    }
+                                    else {
+                                        os << "const unsigned int j = group.ind[n];" << std::endl;
+                                    }
+
+                                    synSubs.addVarSubstitution("id_syn", "n");
+                                }
+                                else {
+                                    synSubs.addVarSubstitution("id_syn", "(i * group.numTrgNeurons) + j");
+                                }
+
+                                // Add pre and postsynaptic indices to substitutions
+                                synSubs.addVarSubstitution("id_pre", "i");
+                                synSubs.addVarSubstitution("id_post", "j");
+
+                                // Add correct functions for apply synaptic input
+                                // **NOTE** rows may be processed in parallel so input must be accumulated atomically
+                                if(s.getArchetype().isDendriticDelayRequired()) {
+                                    synSubs.addFuncSubstitution("addToInSynDelay", 2, getAtomicAdd("group.denDelay[" + getBatchedVarIndex(batchSize, s.getDendriticDelayOffset("$(1)") + "j") + "]", "$(0)", model.getPrecision()));
+                                }
+                                else {
+                                    synSubs.addFuncSubstitution("addToInSyn", 1, getAtomicAdd("group.inSyn[" + getBatchedVarIndex(batchSize, "j") + "]", "$(0)", model.getPrecision()));
+                                }
+
+                                // Call synapse dynamics handler for each batch
+                                // **NOTE** connectivity is shared between batches so it is only read once for all of them
+                                genBatchLoop(os, batchSize,
+                                    [&](CodeStream &os)
+                                    {
+                                        synapseDynamicsHandler(os, s, synSubs);
+                                    });
+                            }
+                        });
+                }
+            }
+        }
+
+        // Presynaptic update
+        {
+            Timer t(os, "presynapticUpdate", model.isTimingEnabled());
+            for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
+                CodeStream::Scope b(os);
+                os << "// merged presynaptic update group " << s.getIndex() << std::endl;
+                ProfileTimer profileTimer(os, modelMerged.getPresynapticUpdateProfileOffset() + s.getIndex(), model.isProfilingEnabled());
+                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                {
+                    CodeStream::Scope b(os);
+
+                    // Get reference to group
+                    os << "const auto &group = mergedPresynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
+
+                    // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
+                    if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+                        os << "const unsigned int preReadDelaySlot = " << s.getPresynapticAxonalDelaySlot() << ";" << std::endl;
+                        os << "const unsigned int preReadDelayOffset = preReadDelaySlot * group.numSrcNeurons;" << std::endl;
+                    }
+
+                    // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
+                    if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
+                        os << "const unsigned int postReadDelayOffset = " << s.getPostsynapticBackPropDelaySlot() << " * group.numTrgNeurons;" << std::endl;
+                    }
+
+                    // Process each batch's presynaptic spikes in turn
+                    // **NOTE** each batch has its own spikes so, unlike synapse dynamics, the batch loop is outermost
+                    genBatchLoop(os, batchSize,
+                        [&](CodeStream &os)
+                        {
+                            // generate the code for processing spike-like events
+                            if (s.getArchetype().isSpikeEventRequired()) {
+                                genPresynapticUpdate(os, modelMerged, s, funcSubs, false, wumThreshHandler, wumEventHandler, wumProceduralConnectHandler);
+                            }
+
+                            // generate the code for processing true spike events
+                            if (s.getArchetype().isTrueSpikeRequired()) {
+                                genPresynapticUpdate(os, modelMerged, s, funcSubs, true, wumThreshHandler, wumSimHandler, wumProceduralConnectHandler);
+                            }
+                        });
+                    os << std::endl;
+                }
+            }
+        }
+
+        // Postsynaptic update
+        {
+            Timer t(os, "postsynapticUpdate", model.isTimingEnabled());
+            for(const auto &s : modelMerged.getMergedPostsynapticUpdateGroups()) {
+                CodeStream::Scope b(os);
+                os << "// merged postsynaptic update group " << s.getIndex() << std::endl;
+                const size_t profileIndex = modelMerged.getPostsynapticUpdateProfileOffset() + s.getIndex();
+                ProfileTimer profileTimer(os, profileIndex, model.isProfilingEnabled());
+                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                {
+                    CodeStream::Scope b(os);
+
+                    // Get reference to group
+                    os << "const auto &group = mergedPostsynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
+
+                    // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
+                    if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+                        os << "const unsigned int preReadDelayOffset = " << s.getPresynapticAxonalDelaySlot() << " * group.numSrcNeurons;" << std::endl;
+                    }
+
+                    // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
+                    if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
+                        os << "const unsigned int postReadDelaySlot = " << s.getPostsynapticBackPropDelaySlot() << ";" << std::endl;
+                        os << "const unsigned int postReadDelayOffset = postReadDelaySlot * group.numTrgNeurons;" << std::endl;
+                    }
+
+                    // If connectivity is sparse, precompute divisor used to calculate presynaptic index from row-major synapse index
+                    if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                        os << "const FastDivisor rowStrideDivisor(group.rowStride);" << std::endl;
+                    }
+
+                    // Process each batch's postsynaptic spikes in turn
+                    // **NOTE** each batch has its own spikes so, unlike synapse dynamics, the batch loop is outermost
+                    genBatchLoop(os, batchSize,
+                        [&](CodeStream &os)
+                        {
+                            // Get number of postsynaptic spikes
+                            const bool trgSpikeDelayRequired = (s.getArchetype().getTrgNeuronGroup()->isDelayRequired() && s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired());
+                            const std::string trgNumDelaySlots = std::to_string(s.getArchetype().getTrgNeuronGroup()->getNumDelaySlots());
+                            if (trgSpikeDelayRequired) {
+                                os << "const unsigned int numSpikes = group.trgSpkCnt[" << getBatchOffset(batchSize, trgNumDelaySlots) << "postReadDelaySlot];" << std::endl;
+                            }
+                            else {
+                                os << "const unsigned int numSpikes = group.trgSpkCnt[" << ((batchSize == 1) ? "0" : "batch") << "];" << std::endl;
+                            }
+
+                            // If profiling is enabled, add columns traversed to profile along with synapses processed if connectivity is dense
+                            if(model.isProfilingEnabled()) {
+                                genProfileAdd(os, profileIndex, "numRows", "numSpikes");
+                                if(!isRaggedConnectivity(s.getArchetype().getMatrixType())) {
+                                    genProfileAdd(os, profileIndex, "numSynapticEvents", "(uint64_t)numSpikes * group.numSrcNeurons");
+                                }
+                            }
+
+                            // Loop through postsynaptic spikes, splitting them across threads
+                            // **NOTE** each postsynaptic spike updates a distinct column of synapses so this is race-free
+                            genParallelFor(os, "j", "numSpikes", ParallelLoop::SPIKE, false, RangeHandler(),
+                                [&](CodeStream &os)
+                                {
+                                    const std::string offsetTrueSpkPost = trgSpikeDelayRequired ? "postReadDelayOffset + " : "";
+                                    const std::string trgSpikeBatchOffset = getBatchOffset(batchSize, trgSpikeDelayRequired ? (trgNumDelaySlots + " * group.numTrgNeurons") : "group.numTrgNeurons");
+                                    os << "const unsigned int spike = group.trgSpk[" << trgSpikeBatchOffset << offsetTrueSpkPost << "j];" << std::endl;
+
+                                    // Loop through column of presynaptic neurons
+                                    if (isRaggedConnectivity(s.getArchetype().getMatrixType())) {
+                                        os << "const unsigned int npre = group.colLength[spike];" << std::endl;
+                                        if(model.isProfilingEnabled()) {
+                                            genProfileAdd(os, profileIndex, "numSynapticEvents", "npre");
+                                        }
+                                        os << "for (unsigned int i = 0; i < npre; i++)";
+                                    }
+                                    else {
+                                        os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                                    }
+                                    {
+                                        CodeStream::Scope b(os);
+
+                                        Substitutions synSubs(&funcSubs);
+                                        if(isRaggedConnectivity(s.getArchetype().getMatrixType())) {
+                                            os << "const unsigned int colMajorIndex = (spike * group.colStride) + i;" << std::endl;
+                                            os << "const unsigned int rowMajorIndex = group.remap[colMajorIndex];" << std::endl;
+
+                                            // If connectivity is CSR, rows are unpadded so read presynaptic index stored alongside remapping
+                                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                                                synSubs.addVarSubstitution("id_pre", "group.remapPre[colMajorIndex]");
+                                            }
+                                            else {
+                                                synSubs.addVarSubstitution("id_pre", "rowStrideDivisor.divide(rowMajorIndex)");
+                                            }
+                                            synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
+                                        }
+                                        else {
+                                            synSubs.addVarSubstitution("id_pre", "i");
+                                            synSubs.addVarSubstitution("id_syn", "((group.numTrgNeurons * i) + spike)");
+                                        }
+                                        synSubs.addVarSubstitution("id_post", "spike");
+
+                                        postLearnHandler(os, s, synSubs);
+                                    }
+                                });
+                        });
+                    os << std::endl;
+                }
+            }
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
+                         NeuronGroupMergedHandler localNGHandler, SynapseGroupMergedHandler sgDenseInitHandler,
+                         SynapseGroupMergedHandler sgSparseConnectHandler, SynapseGroupMergedHandler sgSparseInitHandler,
+                         HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+    os << "void initialize()";
+    {
+        CodeStream::Scope b(os);
+        Substitutions funcSubs(cpuFunctions, model.getPrecision());
+
+        // Push any required EGPs
+        initPushEGPHandler(os);
+
+        Timer t(os, "init", model.isTimingEnabled());
+
+        // If model requires an RNG, set seed used to key counter-based RNG streams
+        if(isGlobalRNGRequired(modelMerged)) {
+            // If no seed is specified, use system randomness to generate seed
+            if (model.getSeed() == 0) {
+                CodeStream::Scope b(os);
+                os << "std::random_device seedSource;" << std::endl;
+                os << "rngSeed = ((uint64_t)seedSource() << 32) | seedSource();" << std::endl;
+            }
+            // Otherwise, use model seed
+            else {
+                os << "rngSeed = " << model.getSeed() << "ull;" << std::endl;
+            }
+        }
+        os << std::endl;
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Local neuron groups" << std::endl;
+        for(const auto &n : modelMerged.getMergedNeuronInitGroups()) {
+            CodeStream::Scope b(os);
+            os << "// merged neuron init group " << n.getIndex() << std::endl;
+            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Get reference to group
+                os << "const auto &group = mergedNeuronInitGroup" << n.getIndex() << "[g]; " << std::endl;
+                Substitutions popSubs(&funcSubs);
+
+                // If initialisation requires an RNG, calculate key for this group's stream and substitute in RNG to be created by genVariableInit
+                if(n.getArchetype().isInitRNGRequired()) {
+                    genInitRNGKey(os, RNGStream::NEURON_INIT, n.getIndex());
+                    popSubs.addVarSubstitution("rng", "initRNG");
+                }
+                localNGHandler(os, n, popSubs);
+            }
+        }
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse groups with dense connectivity" << std::endl;
+        for(const auto &s : modelMerged.getMergedSynapseDenseInitGroups()) {
+            CodeStream::Scope b(os);
+            os << "// merged synapse dense init group " << s.getIndex() << std::endl;
+            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Get reference to group
+                os << "const auto &group = mergedSynapseDenseInitGroup" << s.getIndex() << "[g]; " << std::endl;
+                Substitutions popSubs(&funcSubs);
+
+                // If initialisation requires an RNG, calculate key for this group's stream and substitute in RNG to be created by genSynapseVariableRowInit
+                if(::Utils::isRNGRequired(s.getArchetype().getWUVarInitialisers())) {
+                    genInitRNGKey(os, RNGStream::SYNAPSE_DENSE_INIT, s.getIndex());
+                    popSubs.addVarSubstitution("rng", "initRNG");
+                }
+                sgDenseInitHandler(os, s, popSubs);
+            }
+        }
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse groups with sparse connectivity" << std::endl;
+        for(const auto &s : modelMerged.getMergedSynapseConnectivityInitGroups()) {
+            CodeStream::Scope b(os);
+            os << "// merged synapse connectivity init group " << s.getIndex() << std::endl;
+            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Get reference to group
+                os << "const auto &group = mergedSynapseConnectivityInitGroup" << s.getIndex() << "[g]; " << std::endl;
+
+                // If connectivity initialisation requires an RNG, calculate key for this group's stream
+                const bool connectRNG = ::Utils::isRNGRequired(s.getArchetype().getConnectivityInitialiser().getSnippet()->getRowBuildCode());
+                if(connectRNG) {
+                    os << "const uint64_t connectRNGKey = " << getRNGStreamKey(RNGStream::SYNAPSE_CONNECTIVITY_INIT, s.getIndex(), "g") << ";" << std::endl;
+                }
+
+                // If matrix connectivity is ragged
+                if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                    // Zero row lengths
+                    os << "memset(group.rowLength, 0, group.numSrcNeurons * sizeof(unsigned int));" << std::endl;
+
+                    // Loop through source neurons, splitting rows across threads
+                    // **NOTE** each row is only written by the thread building it and has its own RNG stream so this is race-free
+                    genParallelFor(os, "i", "group.numSrcNeurons", ParallelLoop::ROW, false, RangeHandler(),
+                        [&](CodeStream &os)
+                        {
+                            Substitutions popSubs(&funcSubs);
+                            popSubs.addVarSubstitution("id_pre", "i");
+                            popSubs.addVarSubstitution("id_post_begin", "0");
+                            popSubs.addVarSubstitution("id_thread", "0");
+                            popSubs.addVarSubstitution("num_threads", "1");
+                            popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+                            // If required, create counter-based RNG for this row
+                            if(connectRNG) {
+                                os << "Philox4x32 connectRNG(connectRNGKey, i);" << std::endl;
+                                popSubs.addVarSubstitution("rng", "connectRNG");
+                            }
+
+                            // Add function to increment row length and insert synapse into ind array
+                            popSubs.addFuncSubstitution("addSynapse", 1,
+                                                        "group.ind[(i * group.rowStride) + (group.rowLength[i]++)] = $(0)");
+
+                            sgSparseConnectHandler(os, s, popSubs);
+                        });
+                }
+                // Otherwise, if matrix connectivity is CSR
+                else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                    // Build substitutions for building row i of connectivity, using the row's counter-based RNG if required
+                    auto genRowSubs =
+                        [&](CodeStream &os, Substitutions &popSubs)
+                        {
+                            popSubs.addVarSubstitution("id_pre", "i");
+                            popSubs.addVarSubstitution("id_post_begin", "0");
+                            popSubs.addVarSubstitution("id_thread", "0");
+                            popSubs.addVarSubstitution("num_threads", "1");
+                            popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+                            if(connectRNG) {
+                                os << "Philox4x32 connectRNG(connectRNGKey, i);" << std::endl;
+                                popSubs.addVarSubstitution("rng", "connectRNG");
+                            }
+                        };
+
+                    // First row starts at beginning of ind array
+                    os << "group.rowPtr[0] = 0;" << std::endl;
+
+                    // If rows are built in parallel, their starts aren't known until every row before them has been built
+                    // so build each row twice - first to count its length and then, once these have been converted into row
+                    // pointers, to fill it. This is only valid because each row has its own counter-based RNG stream
+                    // so building it a second time generates the same synapses
+                    if(isMultiThreaded()) {
+                        // Count synapses in each row, writing length of row into following row pointer
+                        genParallelFor(os, "i", "group.numSrcNeurons", ParallelLoop::ROW, false, RangeHandler(),
+                            [&](CodeStream &os)
+                            {
+                                Substitutions popSubs(&funcSubs);
+                                genRowSubs(os, popSubs);
+
+                                os << "unsigned int rowLength = 0;" << std::endl;
+                                popSubs.addFuncSubstitution("addSynapse", 1, "((void)($(0)), rowLength++)");
+                                sgSparseConnectHandler(os, s, popSubs);
+                                os << "group.rowPtr[i + 1] = rowLength;" << std::endl;
+                            });
+
+                        // Convert row lengths into row pointers using (sequential) prefix sum
+                        os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "group.rowPtr[i + 1] += group.rowPtr[i];" << std::endl;
+                        }
+
+                        // Check synapses will fit before inserting any of them
+                        os << "if(group.rowPtr[group.numSrcNeurons] > group.maxNumSynapses)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "throw std::runtime_error(\"Number of synapses created by CSR connectivity initialisation exceeds maximum - use SynapseGroup::setMaxNumSynapses\");" << std::endl;
+                        }
+
+                        // Build rows again, this time inserting synapses into ind array starting at row pointer
+                        genParallelFor(os, "i", "group.numSrcNeurons", ParallelLoop::ROW, false, RangeHandler(),
+                            [&](CodeStream &os)
+                            {
+                                Substitutions popSubs(&funcSubs);
+                                genRowSubs(os, popSubs);
+
+                                os << "unsigned int rowEnd = group.rowPtr[i];" << std::endl;
+                                popSubs.addFuncSubstitution("addSynapse", 1, "group.ind[rowEnd++] = $(0)");
+                                sgSparseConnectHandler(os, s, popSubs);
+                            });
+                    }
+                    // Otherwise, build rows in order, starting each where the previous one ended
+                    else {
+                        os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                        {
+                            CodeStream::Scope b(os);
+
+                            Substitutions popSubs(&funcSubs);
+                            genRowSubs(os, popSubs);
+
+                            // Start this row where the previous one ended
+                            os << "group.rowPtr[i + 1] = group.rowPtr[i];" << std::endl;
+
+                            // Add function to check there is space for synapse, then insert it into ind array and advance end of row
+                            popSubs.addFuncSubstitution("addSynapse", 1,
+                                                        "do{ if(group.rowPtr[i + 1] == group.maxNumSynapses){ throw std::runtime_error(\"Number of synapses created by CSR connectivity initialisation exceeds maximum - use SynapseGroup::setMaxNumSynapses\"); } "
+                                                        "group.ind[group.rowPtr[i + 1]++] = $(0); } while(false)");
+
+                            sgSparseConnectHandler(os, s, popSubs);
+                        }
+                    }
+                }
+                // Otherwise, if matrix connectivity is a bitmask
+                else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                    // Zero memory before setting sparse bits
+                    os << "const size_t gpSize = ((((size_t)group.numSrcNeurons * (size_t)group.rowStride) + 32 - 1) / 32);" << std::endl;
+                    os << "memset(group.gp, 0, gpSize * sizeof(uint32_t));" << std::endl;
+
+                    // Loop through source neurons
+                    os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                    {
+                        // Calculate index of bit at start of this row
+                        CodeStream::Scope b(os);
+                        os << "const int64_t rowStartGID = i * group.rowStride;" << std::endl;
+
+                        // Build function template to set correct bit in bitmask
+                        Substitutions popSubs(&funcSubs);
+                        popSubs.addVarSubstitution("id_pre", "i");
+                        popSubs.addVarSubstitution("id_post_begin", "0");
+                        popSubs.addVarSubstitution("id_thread", "0");
+                        popSubs.addVarSubstitution("num_threads", "1");
+                        popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+                        // If required, create counter-based RNG for this row
+                        if(connectRNG) {
+                            os << "Philox4x32 connectRNG(connectRNGKey, i);" << std::endl;
+                            popSubs.addVarSubstitution("rng", "connectRNG");
+                        }
+
+                        // Add function to increment row length and insert synapse into ind array
+                        popSubs.addFuncSubstitution("addSynapse", 1,
+                                                    "setB(group.gp[(rowStartGID + $(0)) / 32], (rowStartGID + $(0)) & 31)");
+
+                        sgSparseConnectHandler(os, s, popSubs);
+                    }
+                }
+                else {
+                    throw std::runtime_error("Only BITMASK and SPARSE format connectivity can be generated using a connectivity initialiser");
+                }
+            }
+        }
+    }
+    os << std::endl;
+    os << "void initializeSparse()";
+    {
+        CodeStream::Scope b(os);
+        Substitutions funcSubs(cpuFunctions, model.getPrecision());
+
+        // Push any required EGPs
+        initSparsePushEGPHandler(os);
+
+        Timer t(os, "initSparse", model.isTimingEnabled());
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse groups with sparse connectivity" << std::endl;
+        for(const auto &s : modelMerged.getMergedSynapseSparseInitGroups()) {
+            CodeStream::Scope b(os);
+            os << "// merged sparse synapse init group " << s.getIndex() << std::endl;
+            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+            {
+                CodeStream::Scope b(os);
+
+                // Get reference to group
+                os << "const auto &group = mergedSynapseSparseInitGroup" << s.getIndex() << "[g]; " << std::endl;
+
+                // If initialisation requires an RNG, calculate key for this group's stream
+                const bool initRNG = ::Utils::isRNGRequired(s.getArchetype().getWUVarInitialisers());
+                if(initRNG) {
+                    os << "const uint64_t initRNGKey = " << getRNGStreamKey(RNGStream::SYNAPSE_SPARSE_INIT, s.getIndex(), "g") << ";" << std::endl;
+                }
+
+                // If postsynaptic learning is required, initially zero column lengths
+                const bool remapRequired = !s.getArchetype().getWUModel()->getLearnPostCode().empty();
+                if (remapRequired) {
+                    os << "// Zero column lengths" << std::endl;
+                    os << "std::fill_n(group.colLength, group.numTrgNeurons, 0);" << std::endl;
+                }
+
+                os << "// Loop through presynaptic neurons" << std::endl;
+                os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)" << std::endl;
+                {
+                    CodeStream::Scope b(os);
+
+                    // Generate sparse initialisation code
+                    if(s.getArchetype().isWUVarInitRequired()) {
+                        Substitutions popSubs(&funcSubs);
+                        popSubs.addVarSubstitution("id_pre", "i");
+                        popSubs.addVarSubstitution("row_len", getRowLength(s.getArchetype().getMatrixType(), "i"));
+
+                        // If required, substitute in RNG to be created by genSynapseVariableRowInit
+                        // **NOTE** sequence is per-row so rows can be initialised in any order
+                        if(initRNG) {
+                            os << "unsigned int initRNGSequence = 0;" << std::endl;
+                            popSubs.addVarSubstitution("rng", "initRNG");
+                        }
+                        sgSparseInitHandler(os, s, popSubs);
+                    }
+
+                    // If postsynaptic learning is required
+                    if(remapRequired) {
+                        os << "// Loop through synapses in corresponding matrix row" << std::endl;
+                        os << "for(unsigned int j = 0; j < " << getRowLength(s.getArchetype().getMatrixType(), "i") << "; j++)" << std::endl;
+                        {
+                            CodeStream::Scope b(os);
+
+                            // If postsynaptic learning is required, calculate column length and remapping
+                            if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
+                                os << "// Calculate index of this synapse in the row-major matrix" << std::endl;
+                                os << "const unsigned int rowMajorIndex = " << getRowStart(s.getArchetype().getMatrixType(), "i") << " + j;" << std::endl;
+                                os << "// Using this, lookup postsynaptic target" << std::endl;
+                                os << "const unsigned int postIndex = group.ind[rowMajorIndex];" << std::endl;
+                                os << "// From this calculate index of this synapse in the column-major matrix" << std::endl;
+                                os << "const unsigned int colMajorIndex = (postIndex * group.colStride) + group.colLength[postIndex];" << std::endl;
+                                os << "// Increment column length corresponding to this postsynaptic neuron" << std::endl;
+                                os << "group.colLength[postIndex]++;" << std::endl;
+                                os << "// Add remapping entry" << std::endl;
+                                os << "group.remap[colMajorIndex] = rowMajorIndex;" << std::endl;
+
+                                // If connectivity is CSR, also store presynaptic index as it can't be calculated from row-major index
+                                if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                                    os << "group.remapPre[colMajorIndex] = i;" << std::endl;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Build compressed copies of sparse indices now connectivity is complete
+        for(const auto &s : model.getSynapseGroups()) {
+            if(s.second.isCompressedSparseIndEnabled()) {
+                os << "compressSparseInd" << s.first << "();" << std::endl;
+            }
+        }
+    }
+}
+//--------------------------------------------------------------------------
+size_t BackendCPU::getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const
+{
+    if (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        return sg.getMaxConnections();
+    }
+    else if(getPreferences().enableBitmaskOptimisations && (sg.getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
+        return padSize(sg.getTrgNeuronGroup()->getNumNeurons(), 32);
+    }
+    else {
+        return sg.getTrgNeuronGroup()->getNumNeurons();
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &) const
+{
+    os << "// Standard C++ includes" << std::endl;
+    os << "#include <algorithm>" << std::endl;
+    os << "#include <chrono>" << std::endl;
+    os << "#include <iostream>" << std::endl;
+    os << "#include <random>" << std::endl;
+    os << std::endl;
+    os << "// Standard C includes" << std::endl;
+    os << "#include <cmath>" << std::endl;
+    os << "#include <cstdint>" << std::endl;
+    os << "#include <cstring>" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    os << "#define SUPPORT_CODE_FUNC inline" << std::endl;
+
+    // On windows, define an inline function, matching the signature of __builtin_clz which counts leading zeros
+#ifdef _WIN32
+    os << "#include <intrin.h>" << std::endl;
+    os << std::endl;
+    os << "int inline gennCLZ(unsigned int value)";
+    {
+        CodeStream::Scope b(os);
+        os << "unsigned long leadingZero = 0;" << std::endl;
+        os << "if( _BitScanReverse(&leadingZero, value))";
+        {
+            CodeStream::Scope b(os);
+            os << "return 31 - leadingZero;" << std::endl;
+        }
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "return 32;" << std::endl;
+        }
+    }
+    // Otherwise, on *nix, use __builtin_clz intrinsic
+#else
+    os << "#define gennCLZ __builtin_clz" << std::endl;
+#endif
+    os << std::endl;
+
+    // If model requires an RNG, generate counter-based RNG
+    if(isGlobalRNGRequired(modelMerged)) {
+        genPhiloxRNG(os, modelMerged.getModel().getPrecision());
+    }
+
+    // If SIMD neuron update is enabled, define loop hint
+    if(getPreferences().enableSIMDNeuronUpdate) {
+        genSIMDLoopMacro(os);
+    }
+
+    // If sparse postsynaptic learning is used, generate fast divisor
+    if(isFastDivisorRequired(modelMerged)) {
+        genFastDivisor(os);
+    }
+
+    // If aligned host allocation is enabled, generate allocator
+    if(getPreferences().enableAlignedHostAllocation) {
+        genHostAllocator(os, getPreferences().enableHugePages);
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &) const
+{
+    os << "template<class T>" << std::endl;
+    os << "T *getSymbolAddress(T &devSymbol)";
+    {
+        CodeStream::Scope b(os);
+        os << "return &devSymbol;" << std::endl;
+    }
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genAllocateMemPreamble(CodeStream &, const ModelSpecMerged &) const
+{
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genStepTimeFinalisePreamble(CodeStream &, const ModelSpecMerged &) const
+{
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genVariableDefinition(CodeStream &definitions, CodeStream &, const std::string &type, const std::string &name, VarLocation) const
+{
+    definitions << "EXPORT_VAR " << type << " " << name << ";" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genVariableImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation) const
+{
+    os << type << " " << name << ";" << std::endl;
+}
+//--------------------------------------------------------------------------
+MemAlloc BackendCPU::genVariableAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation, size_t count) const
+{
+    if(getPreferences().enableAlignedHostAllocation) {
+        os << name << " = gennAllocateHost<" << type << ">(" << count << ");" << std::endl;
+    }
+    else {
+        os << name << " = new " << type << "[" << count << "];" << std::endl;
+    }
+
+    // Account for padding added by aligned allocator
+    const size_t bytes = count * getSize(type);
+    return MemAlloc::host(getPreferences().enableAlignedHostAllocation ? getHostAllocationSize(bytes, getPreferences().enableHugePages) : bytes);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genVariableFree(CodeStream &os, const std::string &name, VarLocation) const
+{
+    if(getPreferences().enableAlignedHostAllocation) {
+        os << "gennFreeHost(" << name << ");" << std::endl;
+    }
+    else {
+        os << "delete[] " << name << ";" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genExtraGlobalParamDefinition(CodeStream &definitions, const std::string &type, const std::string &name, VarLocation) const
+{
+    definitions << "EXPORT_VAR " << type << " " << name << ";" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genExtraGlobalParamImplementation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const
+{
+    genVariableImplementation(os, type, name, loc);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genExtraGlobalParamAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation) const
+{
+    // Get underlying type
+    // **NOTE** could use std::remove_pointer but it seems unnecessarily elaborate
+    const std::string underlyingType = Utils::getUnderlyingType(type);
+
+    if(getPreferences().enableAlignedHostAllocation) {
+        os << name << " = gennAllocateHost<" << underlyingType << ">(count);" << std::endl;
+    }
+    else {
+        os << name << " = new " << underlyingType << "[count];" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genExtraGlobalParamPush(CodeStream &, const std::string &, const std::string &, VarLocation) const
+{
+    assert(!getPreferences().automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genExtraGlobalParamPull(CodeStream &, const std::string &, const std::string &, VarLocation) const
+{
+    assert(!getPreferences().automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMergedGroupImplementation(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const
+{
+    os << "Merged" << suffix << "Group" << idx << " merged" << suffix << "Group" << idx << "[" << numGroups << "];" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMergedGroupPush(CodeStream &os, const std::string &suffix, size_t idx, size_t numGroups) const
+{
+    os << "std::copy_n(group, " << numGroups << ", merged" << suffix << "Group" << idx << ");" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMergedExtraGlobalParamPush(CodeStream &os, const std::string &suffix, size_t mergedGroupIdx, size_t groupIdx,
+                                               const std::string &fieldName, const std::string &egpName) const
+{
+    os << "merged" << suffix << "Group" << mergedGroupIdx << "[" << groupIdx << "]." << fieldName << " = " << egpName << ";" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genPopVariableInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const
+{
+    Substitutions varSubs(&kernelSubs);
+    handler(os, varSubs);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
+                                 const Substitutions &kernelSubs, Handler handler) const
+{
+    // If an RNG is required, take next sequence for this variable
+    const bool rngRequired = kernelSubs.hasVarSubstitution("rng");
+    if(rngRequired) {
+        os << "const unsigned int varInitRNGSequence = initRNGSequence++;" << std::endl;
+    }
+
+     // **TODO** loops like this should be generated like CUDA threads
+    os << "for (unsigned i = 0; i < (" << count << "); i++)";
+    {
+        CodeStream::Scope b(os);
+
+        // If required, create counter-based RNG for this element
+        if(rngRequired) {
+            os << "Philox4x32 initRNG(initRNGKey, i, varInitRNGSequence);" << std::endl;
+        }
+
+        Substitutions varSubs(&kernelSubs);
+        varSubs.addVarSubstitution(indexVarName, "i");
+        handler(os, varSubs);
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMerged &sg, 
+                                           const Substitutions &kernelSubs, Handler handler) const
+{
+    // If required, create counter-based RNG for this row and variable
+    if(kernelSubs.hasVarSubstitution("rng")) {
+        os << "Philox4x32 initRNG(initRNGKey, " << kernelSubs["id_pre"] << ", initRNGSequence++);" << std::endl;
+    }
+
+    if(isRaggedConnectivity(sg.getArchetype().getMatrixType())) {
+        os << "for (unsigned j = 0; j < " << getRowLength(sg.getArchetype().getMatrixType(), kernelSubs["id_pre"]) << "; j++)";
+    }
+    else {
+        os << "for (unsigned j = 0; j < group.numTrgNeurons; j++)";
+    }
+    {
+        CodeStream::Scope b(os);
+
+        Substitutions varSubs(&kernelSubs);
+        if(isRaggedConnectivity(sg.getArchetype().getMatrixType())) {
+            const std::string rowStart = getRowStart(sg.getArchetype().getMatrixType(), kernelSubs["id_pre"]);
+            varSubs.addVarSubstitution("id_syn", rowStart + " + j");
+            varSubs.addVarSubstitution("id_post", "group.ind[" + rowStart + " + j]");
+        }
+        else {
+            varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group.rowStride) + j");
+            varSubs.addVarSubstitution("id_post", "j");
+        }
+        handler(os, varSubs);
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genVariablePush(CodeStream&, const std::string&, const std::string&, VarLocation, bool, size_t) const
+{
+    assert(!getPreferences().automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genVariablePull(CodeStream&, const std::string&, const std::string&, VarLocation, size_t) const
+{
+    assert(!getPreferences().automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentVariablePush(CodeStream &, const NeuronGroupInternal &, const std::string &, const std::string &, VarLocation) const
+{
+    assert(!getPreferences().automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentVariablePull(CodeStream &, const NeuronGroupInternal &, const std::string &, const std::string &, VarLocation) const
+{
+    assert(!getPreferences().automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentTrueSpikePush(CodeStream&, const NeuronGroupInternal&) const
+{
+    assert(!getPreferences().automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentTrueSpikePull(CodeStream&, const NeuronGroupInternal&) const
+{
+    assert(!getPreferences().automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentSpikeLikeEventPush(CodeStream&, const NeuronGroupInternal&) const
+{
+    assert(!getPreferences().automaticCopy);
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genCurrentSpikeLikeEventPull(CodeStream&, const NeuronGroupInternal&) const
+{
+    assert(!getPreferences().automaticCopy);
+}
+//--------------------------------------------------------------------------
+MemAlloc BackendCPU::genGlobalRNG(CodeStream &definitions, CodeStream &, CodeStream &runner, CodeStream &, CodeStream &) const
+{
+    // **NOTE** all RNG streams are counter-based so the only global state is the seed used to key them
+    definitions << "EXPORT_VAR " << "uint64_t rngSeed;" << std::endl;
+    runner << "uint64_t rngSeed;" << std::endl;
+
+    return MemAlloc::host(sizeof(uint64_t));
+}
+//--------------------------------------------------------------------------
+MemAlloc BackendCPU::genPopulationRNG(CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &,
+                                      const std::string&, size_t) const
+{
+    // No need for population RNGs as all CPU RNG streams are counter-based
+    return MemAlloc::zero();
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genTimer(CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &, const std::string &, bool) const
+{
+    // Timing CPU backends don't require any additional state
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMakefilePreamble(std::ostream &os) const
+{
+    std::string linkFlags = "-shared ";
+    std::string cxxFlags = "-c -fPIC -std=c++11 -MMD -MP -Wno-return-type-c-linkage";
+
+    // If generated code uses threads, compile and link it with thread support
+    if(isMultiThreaded()) {
+        linkFlags += "-pthread ";
+        cxxFlags += " -pthread";
+    }
+    cxxFlags += " " + getPreferences().userCxxFlagsGNU;
+    if (getPreferences().optimizeCode) {
+        cxxFlags += " -O3 -ffast-math";
+    }
+    if (getPreferences().debugCode) {
+        cxxFlags += " -O0 -g";
+    }
+
+    // SIMD neuron update relies on the compiler's auto-vectoriser so, if code isn't otherwise being optimised, enable it
+    if(getPreferences().enableSIMDNeuronUpdate && !getPreferences().optimizeCode && !getPreferences().debugCode) {
+        cxxFlags += " -O2 -ftree-vectorize";
+    }
+
+#ifdef MPI_ENABLE
+    // If MPI is enabled, add MPI include path
+    cxxFlags +=" -I\"$(MPI_PATH)/include\"";
+#endif
+
+    // Write variables to preamble
+    os << "CXXFLAGS := " << cxxFlags << std::endl;
+    os << "LINKFLAGS := " << linkFlags << std::endl;
+
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMakefileLinkRule(std::ostream &os) const
+{
+    os << "\t@$(CXX) $(LINKFLAGS) -o $@ $(OBJECTS)" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMakefileCompileRule(std::ostream &os) const
+{
+    os << "%.o: %.cc %.d" << std::endl;
+    os << "\t@$(CXX) $(CXXFLAGS) -o $@ $<" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMSBuildConfigProperties(std::ostream&) const
+{
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMSBuildImportProps(std::ostream&) const
+{
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMSBuildItemDefinitions(std::ostream &os) const
+{
+    // Add item definition for host compilation
+    os << "\t\t<ClCompile>" << std::endl;
+    os << "\t\t\t<WarningLevel>Level3</WarningLevel>" << std::endl;
+    os << "\t\t\t<Optimization Condition=\"'$(Configuration)'=='Release'\">MaxSpeed</Optimization>" << std::endl;
+    os << "\t\t\t<Optimization Condition=\"'$(Configuration)'=='Debug'\">Disabled</Optimization>" << std::endl;
+    os << "\t\t\t<FunctionLevelLinking Condition=\"'$(Configuration)'=='Release'\">true</FunctionLevelLinking>" << std::endl;
+    os << "\t\t\t<IntrinsicFunctions Condition=\"'$(Configuration)'=='Release'\">true</IntrinsicFunctions>" << std::endl;
+    os << "\t\t\t<ExceptionHandling>SyncCThrow</ExceptionHandling>" << std::endl;
+    os << "\t\t\t<PreprocessorDefinitions Condition=\"'$(Configuration)'=='Release'\">WIN32;WIN64;NDEBUG;_CONSOLE;BUILDING_GENERATED_CODE;%(PreprocessorDefinitions)</PreprocessorDefinitions>" << std::endl;
+    os << "\t\t\t<PreprocessorDefinitions Condition=\"'$(Configuration)'=='Debug'\">WIN32;WIN64;_DEBUG;_CONSOLE;BUILDING_GENERATED_CODE;%(PreprocessorDefinitions)</PreprocessorDefinitions>" << std::endl;
+    os << "\t\t\t<FloatingPointModel>" << (getPreferences().optimizeCode ? "Fast" : "Precise") << "</FloatingPointModel>" << std::endl;
+    os << "\t\t</ClCompile>" << std::endl;
+
+    // Add item definition for linking
+    os << "\t\t<Link>" << std::endl;
+    os << "\t\t\t<GenerateDebugInformation>true</GenerateDebugInformation>" << std::endl;
+    os << "\t\t\t<EnableCOMDATFolding Condition=\"'$(Configuration)'=='Release'\">true</EnableCOMDATFolding>" << std::endl;
+    os << "\t\t\t<OptimizeReferences Condition=\"'$(Configuration)'=='Release'\">true</OptimizeReferences>" << std::endl;
+    os << "\t\t\t<SubSystem>Console</SubSystem>" << std::endl;
+    os << "\t\t\t<AdditionalDependencies>kernel32.lib;user32.lib;gdi32.lib;winspool.lib;comdlg32.lib;advapi32.lib;shell32.lib;ole32.lib;oleaut32.lib;uuid.lib;odbc32.lib;odbccp32.lib;%(AdditionalDependencies)</AdditionalDependencies>" << std::endl;
+    os << "\t\t</Link>" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMSBuildCompileModule(const std::string &moduleName, std::ostream &os) const
+{
+    os << "\t\t<ClCompile Include=\"" << moduleName << ".cc\" />" << std::endl;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genMSBuildImportTarget(std::ostream&) const
+{
+}
+//--------------------------------------------------------------------------
+bool BackendCPU::isGlobalRNGRequired(const ModelSpecMerged &modelMerged) const
+{
+    // If any neuron groups require simulation RNGs or require RNG for initialisation, return true
+    // **NOTE** this takes postsynaptic model initialisation into account
+    const ModelSpecInternal &model = modelMerged.getModel();
+    if(std::any_of(model.getNeuronGroups().cbegin(), model.getNeuronGroups().cend(),
+        [](const ModelSpec::NeuronGroupValueType &n)
+        {
+            return n.second.isSimRNGRequired() || n.second.isInitRNGRequired();
+        }))
+    {
+        return true;
+    }
+
+    // If any synapse groups require an RNG for weight update model initialisation, return true
+    if(std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+        [](const ModelSpec::SynapseGroupValueType &s)
+        {
+            return s.second.isWUInitRNGRequired();
+        }))
+    {
+        return true;
+    }
+
+    // If any procedural synapse groups require an RNG, return true
+    return isProceduralRNGRequired(modelMerged);
+}
+//--------------------------------------------------------------------------
+std::vector<std::pair<std::string, std::string>> BackendCPU::getCheckpointGlobals(const ModelSpecMerged &modelMerged) const
+{
+    // Random numbers are generated from counters derived from the seed and iT so the seed is all that needs saving
+    if(isGlobalRNGRequired(modelMerged)) {
+        return {{"uint64_t", "rngSeed"}};
+    }
+    else {
+        return {};
+    }
+}
+//--------------------------------------------------------------------------
+size_t BackendCPU::getHostAllocationSize(size_t bytes, bool hugePages)
+{
+    // Round size up to a (non-zero) multiple of the alignment - this is what gennAllocateHost actually allocates
+    const size_t alignment = getHostAllocationAlignment(bytes, hugePages);
+    return std::max(alignment, ((bytes + alignment - 1) / alignment) * alignment);
+}
+//--------------------------------------------------------------------------
+size_t BackendCPU::getHostAllocationAlignment(size_t bytes, bool hugePages)
+{
+    // Arrays which span at least one huge page are aligned to huge page boundaries so they can be backed by them
+    return (hugePages && bytes >= hugePageSize) ? hugePageSize : hostAlignment;
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseGroupMerged &sg, const Substitutions &popSubs,
+                                      bool trueSpike, SynapseGroupMergedHandler wumThreshHandler, SynapseGroupMergedHandler wumSimHandler,
+                                      SynapseGroupMergedHandler wumProceduralConnectHandler) const
+{
+    // Get suffix based on type of events
+    const std::string eventSuffix = trueSpike ? "" : "Evnt";
+    const auto *wu = sg.getArchetype().getWUModel();
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+
+    // Determine offsets of this batch's spike counts and spikes
+    const bool srcDelayRequired = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired();
+    const std::string srcNumDelaySlots = std::to_string(sg.getArchetype().getSrcNeuronGroup()->getNumDelaySlots());
+    const std::string spikeCountBatchOffset = getBatchOffset(batchSize, srcDelayRequired ? srcNumDelaySlots : "1");
+    const std::string spikeBatchOffset = getBatchOffset(batchSize, srcDelayRequired ? (srcNumDelaySlots + " * group.numSrcNeurons") : "group.numSrcNeurons");
+
+    // Detect spike events or spikes and do the update, splitting presynaptic spikes across threads
+    os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
+    const std::string numSpikes = "group.srcSpkCnt" + eventSuffix + "[" + spikeCountBatchOffset + (srcDelayRequired ? "preReadDelaySlot]" : "0]");
+    genParallelFor(os, "i", numSpikes, ParallelLoop::SPIKE, false, RangeHandler(),
+        [&](CodeStream &os)
+        {
+            if (!wu->getSimSupportCode().empty()) {
+                os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) <<  ";" << std::endl;
+            }
+
+            const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
+            os << "const unsigned int ipre = group.srcSpk" << eventSuffix << "[" << spikeBatchOffset << queueOffset << "i];" << std::endl;
+
+            // If this is a spike-like event, insert threshold check for this presynaptic neuron
+            if (!trueSpike) {
+                os << "if(";
+
+                Substitutions threshSubs(&popSubs);
+                threshSubs.addVarSubstitution("id_pre", "ipre");
+
+                // Generate weight update threshold condition
+                wumThreshHandler(os, sg, threshSubs);
+
+                os << ")";
+                os << CodeStream::OB(10);
+            }
+
+            // If profiling is enabled, add row to profile
+            const bool profilingEnabled = modelMerged.getModel().isProfilingEnabled();
+            const size_t profileIndex = modelMerged.getPresynapticUpdateProfileOffset() + sg.getIndex();
+            if(profilingEnabled) {
+                genProfileAdd(os, profileIndex, "numRows", "1");
+            }
+
+            Substitutions synSubs(&popSubs);
+            synSubs.addVarSubstitution("id_pre", "ipre");
+            synSubs.addVarSubstitution("id_post", "ipost");
+            synSubs.addVarSubstitution("id_syn", "synAddress");
+
+            // **NOTE** presynaptic spikes may be processed in parallel so input must be accumulated atomically
+            const std::string &precision = modelMerged.getModel().getPrecision();
+            if(sg.getArchetype().isDendriticDelayRequired()) {
+                synSubs.addFuncSubstitution("addToInSynDelay", 2, getAtomicAdd("group.denDelay[" + getBatchedVarIndex(batchSize, sg.getDendriticDelayOffset("$(1)") + "ipost") + "]", "$(0)", precision));
+            }
+            else {
+                synSubs.addFuncSubstitution("addToInSyn", 1, getAtomicAdd("group.inSyn[" + getBatchedVarIndex(batchSize, "ipost") + "]", "$(0)", precision));
+            }
+
+            if (isRaggedConnectivity(sg.getArchetype().getMatrixType())) {
+                os << "const unsigned int npost = " << getRowLength(sg.getArchetype().getMatrixType(), "ipre") << ";" << std::endl;
+                if(profilingEnabled) {
+                    genProfileAdd(os, profileIndex, "numSynapticEvents", "npost");
+                }
+                if(sg.getArchetype().isCompressedSparseIndEnabled()) {
+                    genCompressedIndRowStart(os, "ipre");
+                }
+                os << "for (unsigned int j = 0; j < npost; j++)";
+                {
+                    CodeStream::Scope b(os);
+
+                    // **TODO** seperate stride from max connection
+                    os << "const unsigned int synAddress = " << getRowStart(sg.getArchetype().getMatrixType(), "ipre") << " + j;" << std::endl;
+                    if(sg.getArchetype().isCompressedSparseIndEnabled()) {
+                        genCompressedIndDecode(os, "ipost");
+                    }
+                    else {
+                        os << "const unsigned int ipost = group.ind[synAddress];" << std::endl;
+                    }
+
+                    wumSimHandler(os, sg, synSubs);
+                }
+            }
+            else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
+                // Create substitution stack for generating procedural connectivity code
+                Substitutions connSubs(&popSubs);
+                connSubs.addVarSubstitution("id_pre", "ipre");
+                connSubs.addVarSubstitution("num_threads", "1");
+                connSubs.addVarSubstitution("id_post_begin", "0");
+                connSubs.addVarSubstitution("id_thread", "0");
+                connSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+                // Create another substitution stack for generating presynaptic simulation code
+                Substitutions presynapticUpdateSubs(&popSubs);
+                presynapticUpdateSubs.addVarSubstitution("id_pre", "ipre");
+
+                // If connectivity or weights require an RNG, create counter-based RNG for this row
+                // **NOTE** this means the same row is regenerated every time this neuron spikes
+                const bool connectivityRNG = ::Utils::isRNGRequired(sg.getArchetype().getConnectivityInitialiser().getSnippet()->getRowBuildCode());
+                const bool weightRNG = ((sg.getArchetype().getMatrixType() & SynapseMatrixWeight::PROCEDURAL)
+                                        && ::Utils::isRNGRequired(sg.getArchetype().getWUVarInitialisers()));
+                if(connectivityRNG || weightRNG) {
+                    os << "Philox4x32 connectRNG(" << getRNGStreamKey(RNGStream::PROCEDURAL_CONNECTIVITY, sg.getIndex(), "g") << ", ipre);" << std::endl;
+
+                    connSubs.addVarSubstitution("rng", "connectRNG");
+                    presynapticUpdateSubs.addVarSubstitution("rng", "connectRNG");
+                }
+
+                // Replace $(id_post) with first 'function' parameter as simulation code is
+                // going to be, in turn, substituted into procedural connectivity generation code
+                presynapticUpdateSubs.addVarSubstitution("id_post", "$(0)");
+                if(sg.getArchetype().isDendriticDelayRequired()) {
+                    presynapticUpdateSubs.addFuncSubstitution("addToInSynDelay", 2, getAtomicAdd("group.denDelay[" + getBatchedVarIndex(batchSize, sg.getDendriticDelayOffset("$(1)") + "$(id_post)") + "]", "$(0)", precision));
+                }
+                else {
+                    presynapticUpdateSubs.addFuncSubstitution("addToInSyn", 1, getAtomicAdd("group.inSyn[" + getBatchedVarIndex(batchSize, "$(id_post)") + "]", "$(0)", precision));
+                }
+
+                // Generate presynaptic simulation code into new stringstream-backed code stream
+                std::ostringstream presynapticUpdateStream;
+                CodeStream presynapticUpdate(presynapticUpdateStream);
+                wumSimHandler(presynapticUpdate, sg, presynapticUpdateSubs);
+
+                // If profiling is enabled, count synapses generated in this row
+                if(profilingEnabled) {
+                    os << "uint64_t profileNumEvents = 0;" << std::endl;
+                    presynapticUpdate << std::endl << "profileNumEvents++";
+                }
+
+                // When a synapse should be 'added', substitute in presynaptic update code
+                connSubs.addFuncSubstitution("addSynapse", 1, presynapticUpdateStream.str());
+
+                // Generate procedural connectivity code
+                wumProceduralConnectHandler(os, sg, connSubs);
+
+                if(profilingEnabled) {
+                    genProfileAdd(os, profileIndex, "numSynapticEvents", "profileNumEvents");
+                }
+            }
+            else if(getPreferences().enableBitmaskOptimisations && (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
+                // Determine the number of words in each row
+                os << "const unsigned int rowWords = ((group.numTrgNeurons + 32 - 1) / 32);" << std::endl;
+                if(profilingEnabled) {
+                    os << "uint64_t profileNumEvents = 0;" << std::endl;
+                }
+                os << "for(unsigned int w = 0; w < rowWords; w++)";
+                {
+                    CodeStream::Scope b(os);
+
+                    // Read row word
+                    os << "uint32_t connectivityWord = group.gp[(ipre * rowWords) + w];" << std::endl;
+
+                    // Set ipost to first synapse in connectivity word
+                    os << "unsigned int ipost = w * 32;" << std::endl;
+
+                    // While there any bits left
+                    os << "while(connectivityWord != 0)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        // Cound leading zeros (as bits are indexed backwards this is index of next synapse)
+                        os << "const int numLZ = gennCLZ(connectivityWord);" << std::endl;
+
+                        // Shift off zeros and the one just discovered
+                        // **NOTE** << 32 appears to result in undefined behaviour
+                        os << "connectivityWord = (numLZ == 31) ? 0 : (connectivityWord << (numLZ + 1));" << std::endl;
+
+                        // Add to ipost
+                        os << "ipost += numLZ;" << std::endl;
+
+                        // If we aren't in padding region
+                        // **TODO** don't bother checking if there is no padding
+                        os << "if(ipost < group.numTrgNeurons)";
+                        {
+                            CodeStream::Scope b(os);
+                            wumSimHandler(os, sg, synSubs);
+                            if(profilingEnabled) {
+                                os << "profileNumEvents++;" << std::endl;
+                            }
+                        }
+
+                        // Increment ipost to take into account fact the next CLZ will go from bit AFTER synapse
+                        os << "ipost++;" << std::endl;
+                    }
+                }
+                if(profilingEnabled) {
+                    genProfileAdd(os, profileIndex, "numSynapticEvents", "profileNumEvents");
+                }
+            }
+            // Otherwise (DENSE or BITMASK)
+            else {
+                const bool bitmask = (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK);
+                if(profilingEnabled) {
+                    if(bitmask) {
+                        os << "uint64_t profileNumEvents = 0;" << std::endl;
+                    }
+                    else {
+                        genProfileAdd(os, profileIndex, "numSynapticEvents", "group.numTrgNeurons");
+                    }
+                }
+                os << "for (unsigned int ipost = 0; ipost < group.numTrgNeurons; ipost++)";
+                {
+                    CodeStream::Scope b(os);
+
+                    if (bitmask) {
+                        os << "const uint64_t gid = (ipre * (uint64_t)group.numTrgNeurons + ipost);" << std::endl;
+                        os << "if (B(group.gp[gid / 32], gid & 31))" << CodeStream::OB(20);
+                    }
+
+                    os << "const unsigned int synAddress = (ipre * group.numTrgNeurons) + ipost;" << std::endl;
+
+                    wumSimHandler(os, sg, synSubs);
+
+                    if (bitmask) {
+                        if(profilingEnabled) {
+                            os << "profileNumEvents++;" << std::endl;
+                        }
+                        os << CodeStream::CB(20);
+                    }
+                }
+                if(profilingEnabled && bitmask) {
+                    genProfileAdd(os, profileIndex, "numSynapticEvents", "profileNumEvents");
+                }
+            }
+            // If this is a spike-like event, close braces around threshold check
+            if (!trueSpike) {
+                os << CodeStream::CB(10);
+            }
+        });
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genEmitSpike(CodeStream &os, const NeuronGroupMerged &ng, const Substitutions &subs, bool trueSpike, unsigned int batchSize) const
+{
+    // Determine if delay is required and thus, at what offset we should write into the spike queue
+    const bool spikeDelayRequired = trueSpike ? (ng.getArchetype().isDelayRequired() && ng.getArchetype().isTrueSpikeRequired()) : ng.getArchetype().isDelayRequired();
+    const std::string spikeQueueOffset = spikeDelayRequired ? "writeDelayOffset + " : "";
+
+    // Determine offsets of this batch's spike counts and spikes
+    const std::string numDelaySlots = std::to_string(ng.getArchetype().getNumDelaySlots());
+    const std::string spikeCountBatchOffset = getBatchOffset(batchSize, spikeDelayRequired ? numDelaySlots : "1");
+    const std::string spikeBatchOffset = getBatchOffset(batchSize, spikeDelayRequired ? (numDelaySlots + " * group.numNeurons") : "group.numNeurons");
+
+    // **NOTE** neurons may be updated in parallel so spike count must be incremented atomically
+    const std::string suffix = trueSpike ? "" : "Evnt";
+    const std::string spikeCount = "group.spkCnt" + suffix + "[" + spikeCountBatchOffset + (spikeDelayRequired ? "*group.spkQuePtr]" : "0]");
+    os << "group.spk" << suffix << "[" << spikeBatchOffset << spikeQueueOffset << getAtomicIncrement(spikeCount) << "] = " << subs["id"] << ";" << std::endl;
+
+    // Reset spike time if this is a true spike and spike time is required
+    if(trueSpike && ng.getArchetype().isSpikeTimeRequired()) {
+        const std::string queueOffset = ng.getArchetype().isDelayRequired() ? "writeDelayOffset + " : "";
+        os << "group.sT[" << getBatchedVarIndex(batchSize, queueOffset + subs["id"]) << "] = " << subs["t"] << ";" << std::endl;
+    }
+
+    // If this is a true spike and spike recording is enabled, set bit in recording buffer
+    if(trueSpike && ng.getArchetype().isSpikeRecordingEnabled()) {
+        // **NOTE** neighbouring neurons may be updated by different threads so bits must be set atomically
+        const std::string recordBatchOffset = getBatchOffset(batchSize, "numRecordingTimesteps * numRecordingWords");
+        os << getAtomicOr("recordSpk[" + recordBatchOffset + subs["id"] + " / 32]", "(1u << (" + subs["id"] + " % 32))") << ";" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void BackendCPU::genProfileAdd(CodeStream &os, size_t profileIndex, const std::string &counter, const std::string &value) const
+{
+    // **NOTE** counters may be incremented from within parallel loops so must be updated atomically
+    os << getAtomicAdd("mergedGroupProfile[" + std::to_string(profileIndex) + "]." + counter, value, "uint64_t") << ";" << std::endl;
+}
+}   // namespace CodeGenerator
@@ -1,24 +1,10 @@
 #include "code_generator/codeGenUtils.h"
 
-// Is C++ regex library operational?
-// We assume it is for:
-// 1) Compilers that don't define __GNUCC__
-// 2) Clang
-// 3) GCC 5.X.Y and future
-// 4) Any future (4.10.Y?) GCC 4.X.Y releases
-// 5) GCC 4.9.1 and subsequent patch releases (GCC fully implemented regex in 4.9.0
-// BUT bug 61227 https://gcc.gnu.org/bugzilla/show_bug.cgi?id=61227 prevented \w from working until 4.9.1)
-#if !defined(__GNUC__) || \
-    __clang__ || \
-    __GNUC__ > 4 || \
-    (__GNUC__ == 4 && (__GNUC_MINOR__ > 9 || \
-                      (__GNUC_MINOR__ == 9 && __GNUC_PATCHLEVEL__ >= 1)))
-    #include <regex>
-#else
-    #error "GeNN now requires a functioning std::regex implementation - please upgrade your version of GCC to at least 4.9.1"
-#endif
+// Standard C++ includes
+#include <unordered_map>
 
 // Standard C includes
+#include <cctype>
 #include <cstring>
 
 // GeNN includes
@@ -103,25 +89,110 @@ const char *mathsFuncs[][MathsFuncMax] = {
 };
 
 //--------------------------------------------------------------------------
-/*! \brief This function converts code to contain only explicit single precision (float) function calls (C99 standard)
+bool isIdentifierChar(char c)
+{
+    return (std::isalnum(static_cast<unsigned char>(c)) || c == '_');
+}
+
+//--------------------------------------------------------------------------
+//! Is the identifier ending at position i followed by an (optionally whitespace-separated) open bracket
+//--------------------------------------------------------------------------
+bool isFunctionCall(const std::string &s, size_t i)
+{
+    while(i < s.size() && std::isspace(static_cast<unsigned char>(s[i]))) {
+        i++;
+    }
+    return (i < s.size() && s[i] == '(');
+}
+
+//--------------------------------------------------------------------------
+/*! \brief Tool for substituting all occurances of trg in s which are preceded by the start of the string or a character
+ *  which can't be part of an identifier and are followed by a suffix for which isValidSuffix returns true
  */
 //--------------------------------------------------------------------------
-void ensureMathFunctionFtype(std::string &code, const std::string &type)
+template<typename S>
+bool delimitedSubstitute(std::string &s, const std::string &trg, const std::string &rep, S isValidSuffix)
 {
-    using namespace CodeGenerator;
+    if(trg.empty()) {
+        return false;
+    }
 
-    // If type is double, substitute any single precision maths functions for double precision version
-    if (type == "double") {
-        for(const auto &m : mathsFuncs) {
-            regexFuncSubstitute(code, m[MathsFuncSingle], m[MathsFuncDouble]);
+    std::string output;
+    size_t i = 0;
+    bool substituted = false;
+    for(size_t found = s.find(trg); found != std::string::npos; found = s.find(trg, found + 1)) {
+        // **NOTE** the preceding character can't be part of the previous match
+        const bool validPrefix = (found == 0) || (found > i && !isIdentifierChar(s[found - 1]));
+        if(validPrefix && isValidSuffix(s, found + trg.size())) {
+            output.append(s, i, found - i);
+            output.append(rep);
+            i = found + trg.size();
+            substituted = true;
         }
     }
+
+    // If any substitutions were made, copy remainder of string and replace
+    if(substituted) {
+        output.append(s, i, std::string::npos);
+        s.swap(output);
+    }
+    return substituted;
+}
+
+//--------------------------------------------------------------------------
+//! Builds lookup table of maths functions to rewrite for a given precision
+//--------------------------------------------------------------------------
+std::unordered_map<std::string, std::string> buildMathsFuncMap(MathsFunc from, MathsFunc to)
+{
+    std::unordered_map<std::string, std::string> map;
+    for(const auto &m : mathsFuncs) {
+        map.emplace(m[from], m[to]);
+    }
+    return map;
+}
+
+//--------------------------------------------------------------------------
+/*! \brief This function converts code to contain only explicit single precision (float) function calls (C99 standard)
+ */
+//--------------------------------------------------------------------------
+void ensureMathFunctionFtype(std::string &code, const std::string &type)
+{
+    // If type is double, substitute any single precision maths functions for double precision version
     // Otherwise, substitute any double precision maths functions for single precision version
-    else {
-        for(const auto &m : mathsFuncs) {
-            regexFuncSubstitute(code, m[MathsFuncDouble], m[MathsFuncSingle]);
+    static const auto singleToDouble = buildMathsFuncMap(MathsFuncSingle, MathsFuncDouble);
+    static const auto doubleToSingle = buildMathsFuncMap(MathsFuncDouble, MathsFuncSingle);
+    const auto &funcs = (type == "double") ? singleToDouble : doubleToSingle;
+
+    // Scan code, identifier by identifier, copying to output
+    std::string output;
+    output.reserve(code.size());
+    size_t i = 0;
+    while(i < code.size()) {
+        // If this isn't the start of an identifier, copy character
+        if(!isIdentifierChar(code[i])) {
+            output += code[i++];
+            continue;
+        }
+
+        // Find end of identifier
+        size_t end = i + 1;
+        while(end < code.size() && isIdentifierChar(code[end])) {
+            end++;
+        }
+
+        // If identifier is a function call to one of the maths functions being replaced, substitute
+        // **NOTE** identifiers can't start with digits but this is checked implicitly as none of the maths functions do either
+        const auto func = funcs.find(code.substr(i, end - i));
+        if(func != funcs.cend() && isFunctionCall(code, end)) {
+            output += func->second;
+        }
+        // Otherwise, copy identifier
+        else {
+            output.append(code, i, end - i);
         }
+        i = end;
     }
+    code.swap(output);
 }
 
 //--------------------------------------------------------------------------
@@ -150,48 +221,6 @@ void doFinal(std::string &code, unsigned int i, const std::string &type, unsigne
     }
 }
 
-bool regexSubstitute(std::string &s, const std::regex &regex, const std::string &format)
-{
-    // **NOTE** the following code performs the same function as std::regex_replace
-    // but has a return value indicating whether any replacements are made
-    // see http://en.cppreference.com/w/cpp/regex/regex_replace
-
-    // Create regex iterator to iterate over matches found in code
-    std::sregex_iterator matchesBegin(s.cbegin(), s.cend(), regex);
-    std::sregex_iterator matchesEnd;
-
-    // If there are no matches, leave s unmodified and return false
-    if(matchesBegin == matchesEnd) {
-        return false;
-    }
-    // Otherwise
-    else {
-        // Loop through matches
-        std::string output;
-        for(std::sregex_iterator m = matchesBegin;;) {
-            // Copy the non-matched subsequence (m->prefix()) onto output
-            std::copy(m->prefix().first, m->prefix().second, std::back_inserter(output));
-
-            // Then replaces the matched subsequence with the formatted replacement string
-            m->format(std::back_inserter(output), format);
-
-            // If there are no subsequent matches
-            if(std::next(m) == matchesEnd) {
-                // Copy the remaining non-matched characters onto output
-                std::copy(m->suffix().first, m->suffix().second, std::back_inserter(output));
-                break;
-            }
-            // Otherwise go onto next match
-            else {
-                m++;
-            }
-        }
-
-        // Set reference to newly processed version and return true
-        s = output;
-        return true;
-    }
-}
 }    // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -212,37 +241,22 @@ void substitute(std::string &s, const std::string &trg, const std::string &rep)
 }
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting variable  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting variable names in the neuron code strings or other templates
 //--------------------------------------------------------------------------
 bool regexVarSubstitute(std::string &s, const std::string &trg, const std::string &rep)
 {
-    // Build a regex to match variable name with at least one
-    // character that can't be in a variable name on either side (or an end/beginning of string)
-    // **NOTE** the suffix is non-capturing so two instances of variables separated by a single character are matched e.g. a*a
-    std::regex regex("(^|[^0-9a-zA-Z_])" + trg + "(?=$|[^a-zA-Z0-9_])");
-
-    // Create format string to replace in text
-    // **NOTE** preceding character is captured as C++ regex doesn't support lookbehind so this needs to be replaced in
-    const std::string format = "$1" + rep;
-
-    return regexSubstitute(s, regex, format);
+    // Match variable name with a character that can't be in a variable name on either side (or an end/beginning of string)
+    return delimitedSubstitute(s, trg, rep,
+                               [](const std::string &code, size_t i){ return (i == code.size() || !isIdentifierChar(code[i])); });
 }
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting function  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting function names in the neuron code strings or other templates
 //--------------------------------------------------------------------------
 bool regexFuncSubstitute(std::string &s, const std::string &trg, const std::string &rep)
 {
-    // Build a regex to match function name with at least one
-    // character that can't be part of the function name on the left and a bracket on the right (with optional whitespace)
-    // **NOTE** the suffix is non-capturing so two instances of functions separated by a single character are matched e.g. sin(cos(x));
-    std::regex regex("(^|[^0-9a-zA-Z_])" + trg + "(?=\\s*\\()");
-
-    // Create format string to replace in text
-    // **NOTE** preceding character is captured as C++ regex doesn't support lookbehind so this needs to be replaced in
-    const std::string format = "$1" + rep;
-
-    return regexSubstitute(s, regex, format);
+    // Match function name with a character that can't be part of the function name on the left and a bracket on the right (with optional whitespace)
+    return delimitedSubstitute(s, trg, rep, isFunctionCall);
 }
 
 //--------------------------------------------------------------------------
@@ -346,27 +360,48 @@ void functionSubstitute(std::string &code, const std::string &funcName,
     }
 }
 
-void genMergedGroupSpikeCountReset(CodeStream &os, const NeuronGroupMerged &n)
+void genBatchLoop(CodeStream &os, unsigned int batchSize, BackendBase::HostHandler handler)
 {
-    if(n.getArchetype().isDelayRequired()) { // with delay
-        if(n.getArchetype().isSpikeEventRequired()) {
-            os << "group.spkCntEvnt[*group.spkQuePtr] = 0;" << std::endl;
-        }
-        if(n.getArchetype().isTrueSpikeRequired()) {
-            os << "group.spkCnt[*group.spkQuePtr] = 0;" << std::endl;
-        }
-        else {
-            os << "group.spkCnt[0] = 0;" << std::endl;
-        }
+    if(batchSize == 1) {
+        handler(os);
     }
-    else { // no delay
-        if(n.getArchetype().isSpikeEventRequired()) {
-            os << "group.spkCntEvnt[0] = 0;" << std::endl;
+    else {
+        os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+        {
+            CodeStream::Scope b(os);
+            handler(os);
         }
-        os << "group.spkCnt[0] = 0;" << std::endl;
     }
 }
 
+void genMergedGroupSpikeCountReset(CodeStream &os, const NeuronGroupMerged &n, unsigned int batchSize)
+{
+    // Each batch has its own spike counts
+    genBatchLoop(os, batchSize,
+        [&n, batchSize](CodeStream &os)
+        {
+            const std::string numDelaySlots = std::to_string(n.getArchetype().getNumDelaySlots());
+            const std::string batchIndex = (batchSize > 1) ? "batch" : "0";
+            if(n.getArchetype().isDelayRequired()) { // with delay
+                if(n.getArchetype().isSpikeEventRequired()) {
+                    os << "group.spkCntEvnt[" << getBatchOffset(batchSize, numDelaySlots) << "*group.spkQuePtr] = 0;" << std::endl;
+                }
+                if(n.getArchetype().isTrueSpikeRequired()) {
+                    os << "group.spkCnt[" << getBatchOffset(batchSize, numDelaySlots) << "*group.spkQuePtr] = 0;" << std::endl;
+                }
+                else {
+                    os << "group.spkCnt[" << batchIndex << "] = 0;" << std::endl;
+                }
+            }
+            else { // no delay
+                if(n.getArchetype().isSpikeEventRequired()) {
+                    os << "group.spkCntEvnt[" << batchIndex << "] = 0;" << std::endl;
+                }
+                os << "group.spkCnt[" << batchIndex << "] = 0;" << std::endl;
+            }
+        });
+}
+
 void genScalarEGPPush(CodeStream &os, const MergedEGPMap &mergedEGPs, const std::string &suffix, const BackendBase &backend)
 {
     // Loop through all merged EGPs
@@ -492,10 +527,16 @@ std::string ensureFtype(const std::string &oldcode, const std::string &type)
 
 void checkUnreplacedVariables(const std::string &code, const std::string &codeName)
 {
-    std::regex rgx("\\$\\([\\w]+\\)");
+    // Find any remaining $(name) references
     std::string vars= "";
-    for (std::sregex_iterator it(code.begin(), code.end(), rgx), end; it != end; it++) {
-        vars+= it->str().substr(2,it->str().size()-3) + ", ";
+    for(size_t found = code.find("$("); found != std::string::npos; found = code.find("$(", found + 1)) {
+        size_t end = found + 2;
+        while(end < code.size() && isIdentifierChar(code[end])) {
+            end++;
+        }
+        if(end > (found + 2) && end < code.size() && code[end] == ')') {
+            vars+= code.substr(found + 2, end - found - 2) + ", ";
+        }
     }
     if (vars.size() > 0) {
         vars= vars.substr(0, vars.size()-2);
@@ -506,6 +547,184 @@ void checkUnreplacedVariables(const std::string &code, const std::string &codeNa
     }
 }
 
+//--------------------------------------------------------------------------
+std::string getVarStorageType(VarStorage storage, const std::string &type)
+{
+    switch(storage) {
+    case VarStorage::INT8:
+        return "int8_t";
+    case VarStorage::INT16:
+        return "int16_t";
+    case VarStorage::HALF:
+    case VarStorage::BFLOAT16:
+        return "uint16_t";
+    default:
+        return type;
+    }
+}
+//--------------------------------------------------------------------------
+std::string getVarStorageLoad(VarStorage storage, double scale, const std::string &type, const std::string &value)
+{
+    switch(storage) {
+    case VarStorage::INT8:
+    case VarStorage::INT16:
+        return "((" + type + ")(" + value + ") * (" + type + ")" + writePreciseString(scale) + ")";
+    case VarStorage::HALF:
+        return "((" + type + ")gennHalfToFloat(" + value + "))";
+    case VarStorage::BFLOAT16:
+        return "((" + type + ")gennBFloat16ToFloat(" + value + "))";
+    default:
+        return value;
+    }
+}
+//--------------------------------------------------------------------------
+std::string getVarStorageStore(VarStorage storage, double scale, const std::string &value)
+{
+    switch(storage) {
+    case VarStorage::INT8:
+        return "gennQuantiseInt8((" + value + ") * " + writePreciseString(1.0 / scale) + ")";
+    case VarStorage::INT16:
+        return "gennQuantiseInt16((" + value + ") * " + writePreciseString(1.0 / scale) + ")";
+    case VarStorage::HALF:
+        return "gennFloatToHalf(" + value + ")";
+    case VarStorage::BFLOAT16:
+        return "gennFloatToBFloat16(" + value + ")";
+    default:
+        return value;
+    }
+}
+//--------------------------------------------------------------------------
+void genVarStorageConversions(CodeStream &os)
+{
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// reduced-precision storage conversions" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "inline uint32_t gennFloatBits(float f)";
+    {
+        CodeStream::Scope b(os);
+        os << "uint32_t u;" << std::endl;
+        os << "std::memcpy(&u, &f, sizeof(float));" << std::endl;
+        os << "return u;" << std::endl;
+    }
+    os << std::endl;
+    os << "inline float gennBitsFloat(uint32_t u)";
+    {
+        CodeStream::Scope b(os);
+        os << "float f;" << std::endl;
+        os << "std::memcpy(&f, &u, sizeof(float));" << std::endl;
+        os << "return f;" << std::endl;
+    }
+    os << std::endl;
+
+    os << "// Convert IEEE 754 half-precision value to single precision" << std::endl;
+    os << "inline float gennHalfToFloat(uint16_t h)";
+    {
+        CodeStream::Scope b(os);
+        os << "// Shift exponent and mantissa into place and rebias exponent by multiplying by 2^112" << std::endl;
+        os << "// **NOTE** this also correctly converts subnormal values" << std::endl;
+        os << "float f = gennBitsFloat((uint32_t)(h & 0x7FFFu) << 13) * 5.192296858534828e33f;" << std::endl;
+        os << "uint32_t u = gennFloatBits(f);" << std::endl;
+        os << std::endl;
+        os << "// Restore infinities and NaNs" << std::endl;
+        os << "if((h & 0x7C00u) == 0x7C00u)";
+        {
+            CodeStream::Scope b(os);
+            os << "u |= 0x7F800000u;" << std::endl;
+        }
+        os << "return gennBitsFloat(u | ((uint32_t)(h & 0x8000u) << 16));" << std::endl;
+    }
+    os << std::endl;
+
+    os << "// Convert single-precision value to IEEE 754 half precision, rounding to nearest even" << std::endl;
+    os << "inline uint16_t gennFloatToHalf(float f)";
+    {
+        CodeStream::Scope b(os);
+        os << "uint32_t u = gennFloatBits(f);" << std::endl;
+        os << "const uint16_t sign = (uint16_t)((u >> 16) & 0x8000u);" << std::endl;
+        os << "u &= 0x7FFFFFFFu;" << std::endl;
+        os << std::endl;
+        os << "// Overflow to infinity or NaN" << std::endl;
+        os << "if(u >= ((127u + 16u) << 23))";
+        {
+            CodeStream::Scope b(os);
+            os << "return sign | ((u > 0x7F800000u) ? 0x7E00u : 0x7C00u);" << std::endl;
+        }
+        os << "// Subnormal or zero: let floating point addition perform rounding" << std::endl;
+        os << "else if(u < (113u << 23))";
+        {
+            CodeStream::Scope b(os);
+            os << "const uint32_t denorm = gennFloatBits(gennBitsFloat(u) + 0.5f) - gennFloatBits(0.5f);" << std::endl;
+            os << "return sign | (uint16_t)denorm;" << std::endl;
+        }
+        os << "// Normal: rebias exponent and round mantissa" << std::endl;
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "const uint32_t mantissaOdd = (u >> 13) & 1u;" << std::endl;
+            os << "u += 0xC8000FFFu + mantissaOdd;" << std::endl;
+            os << "return sign | (uint16_t)(u >> 13);" << std::endl;
+        }
+    }
+    os << std::endl;
+
+    os << "// Convert bfloat16 value to single precision" << std::endl;
+    os << "inline float gennBFloat16ToFloat(uint16_t b)";
+    {
+        CodeStream::Scope b(os);
+        os << "return gennBitsFloat((uint32_t)b << 16);" << std::endl;
+    }
+    os << std::endl;
+
+    os << "// Convert single-precision value to bfloat16, rounding to nearest even" << std::endl;
+    os << "inline uint16_t gennFloatToBFloat16(float f)";
+    {
+        CodeStream::Scope b(os);
+        os << "const uint32_t u = gennFloatBits(f);" << std::endl;
+        os << "if((u & 0x7FFFFFFFu) > 0x7F800000u)";
+        {
+            CodeStream::Scope b(os);
+            os << "return (uint16_t)((u >> 16) | 0x40u);" << std::endl;
+        }
+        os << "return (uint16_t)((u + 0x7FFFu + ((u >> 16) & 1u)) >> 16);" << std::endl;
+    }
+    os << std::endl;
+
+    os << "// Quantise value to 8-bit signed integer, rounding to nearest and saturating" << std::endl;
+    os << "inline int8_t gennQuantiseInt8(double x)";
+    {
+        CodeStream::Scope b(os);
+        os << "return (int8_t)std::fmin(std::fmax(std::round(x), -128.0), 127.0);" << std::endl;
+    }
+    os << std::endl;
+
+    os << "// Quantise value to 16-bit signed integer, rounding to nearest and saturating" << std::endl;
+    os << "inline int16_t gennQuantiseInt16(double x)";
+    {
+        CodeStream::Scope b(os);
+        os << "return (int16_t)std::fmin(std::fmax(std::round(x), -32768.0), 32767.0);" << std::endl;
+    }
+    os << std::endl;
+}
+
+//--------------------------------------------------------------------------
+std::string getLatestDelayedVar(const std::string &var, const std::string &latestVar, const std::string &latestSpikeTimestep,
+                                const std::string &offset, const std::string &idx, unsigned int delaySteps,
+                                const std::string &varPrefix, const std::string &varSuffix, unsigned int batchSize)
+{
+    // If latest delay slot is being read, read latest value directly
+    const std::string latest = varPrefix + latestVar + "[" + getBatchedVarIndex(batchSize, idx) + "]" + varSuffix;
+    if(delaySteps == 0) {
+        return latest;
+    }
+    // Otherwise, if neuron last spiked before delay slot was written, read latest value, otherwise read delay slot
+    // **NOTE** the delay slot being read was written delaySteps + 1 timesteps ago as the latest one was written in the previous timestep
+    else {
+        const std::string spikeTimestep = varPrefix + latestSpikeTimestep + "[" + getBatchedVarIndex(batchSize, idx) + "]" + varSuffix;
+        return "(((iT - " + spikeTimestep + ") > " + std::to_string(delaySteps + 1) + ") ? "
+            + latest + " : " + varPrefix + var + "[" + getBatchedVarIndex(batchSize, offset + idx) + "]" + varSuffix + ")";
+    }
+}
+
 //-------------------------------------------------------------------------
 /*!
   \brief Function for performing the code and value substitutions necessary to insert neuron related variables, parameters, and extraGlobal parameters into synaptic code.
@@ -521,19 +740,29 @@ void neuronSubstitutionsInSynapticCode(
     const std::string &sourceSuffix,
     const std::string &destSuffix,
     const std::string &varPrefix,
-    const std::string &varSuffix)
+    const std::string &varSuffix,
+    unsigned int delaySteps,
+    bool latestDelayedStateSupported,
+    unsigned int batchSize)
 {
     using namespace CodeGenerator;
 
     // presynaptic neuron variables, parameters, and global parameters
     const auto *neuronModel = ng->getNeuronModel();
-    substitutions.addVarSubstitution("sT" + sourceSuffix,
-                                     "(" + delayOffset + varPrefix + "group.sT" + destSuffix + "[" + offset + idx + "]" + varSuffix + ")");
+    if(latestDelayedStateSupported && ng->isSpikeTimeRequired() && ng->isLatestSpikeTimestepRequired()) {
+        substitutions.addVarSubstitution("sT" + sourceSuffix,
+                                         "(" + delayOffset + getLatestDelayedVar("group.sT" + destSuffix, "group.sTLatest" + destSuffix, "group.spkTimestepLatest" + destSuffix,
+                                                                                 offset, idx, delaySteps, varPrefix, varSuffix, batchSize) + ")");
+    }
+    else {
+        substitutions.addVarSubstitution("sT" + sourceSuffix,
+                                         "(" + delayOffset + varPrefix + "group.sT" + destSuffix + "[" + getBatchedVarIndex(batchSize, offset + idx) + "]" + varSuffix + ")");
+    }
     for(const auto &v : neuronModel->getVars()) {
         const std::string varIdx = ng->isVarQueueRequired(v.name) ? offset + idx : idx;
 
         substitutions.addVarSubstitution(v.name + sourceSuffix,
-                                         varPrefix + "group." + v.name + destSuffix + "[" + varIdx + "]" + varSuffix);
+                                         varPrefix + "group." + v.name + destSuffix + "[" + getBatchedVarIndex(batchSize, varIdx) + "]" + varSuffix);
     }
     substitutions.addParamValueSubstitution(neuronModel->getParamNames(), ng->getParams(), sourceSuffix);
     substitutions.addVarValueSubstitution(neuronModel->getDerivedParams(), ng->getDerivedParams(), sourceSuffix);
@@ -549,14 +778,18 @@ void neuronSubstitutionsInSynapticCode(
     const std::string &preVarPrefix,     //!< prefix to be used for presynaptic variable accesses - typically combined with suffix to wrap in function call such as __ldg(&XXX)
     const std::string &preVarSuffix,     //!< suffix to be used for presynaptic variable accesses - typically combined with prefix to wrap in function call such as __ldg(&XXX)
     const std::string &postVarPrefix,    //!< prefix to be used for postsynaptic variable accesses - typically combined with suffix to wrap in function call such as __ldg(&XXX)
-    const std::string &postVarSuffix)    //!< suffix to be used for postsynaptic variable accesses - typically combined with prefix to wrap in function call such as __ldg(&XXX)
+    const std::string &postVarSuffix,    //!< suffix to be used for postsynaptic variable accesses - typically combined with prefix to wrap in function call such as __ldg(&XXX)
+    unsigned int batchSize,              //!< number of batches variables are duplicated for
+    bool latestDelayedStateSupported)    //!< can delayed spike-triggered state only be written to the delay slots of neurons which spike?
 {
     const std::string axonalDelayOffset = writePreciseString(dt * (double)(sg.getDelaySteps() + 1u)) + " + ";
     const std::string preOffset = sg.getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
-    neuronSubstitutionsInSynapticCode(substitutions, sg.getSrcNeuronGroup(), preOffset, axonalDelayOffset, preIdx, "_pre", "Pre", preVarPrefix, preVarSuffix);
+    neuronSubstitutionsInSynapticCode(substitutions, sg.getSrcNeuronGroup(), preOffset, axonalDelayOffset, preIdx, "_pre", "Pre", preVarPrefix, preVarSuffix,
+                                      sg.getDelaySteps(), latestDelayedStateSupported, batchSize);
     
     const std::string backPropDelayMs = writePreciseString(dt * (double)(sg.getBackPropDelaySteps() + 1u)) + " + ";
     const std::string postOffset = sg.getTrgNeuronGroup()->isDelayRequired() ? "postReadDelayOffset + " : "";
-    neuronSubstitutionsInSynapticCode(substitutions, sg.getTrgNeuronGroup(), postOffset, backPropDelayMs, postIdx, "_post", "Post", postVarPrefix, postVarSuffix);
+    neuronSubstitutionsInSynapticCode(substitutions, sg.getTrgNeuronGroup(), postOffset, backPropDelayMs, postIdx, "_post", "Post", postVarPrefix, postVarSuffix,
+                                      sg.getBackPropDelaySteps(), latestDelayedStateSupported, batchSize);
 }
 }   // namespace CodeGenerator
@@ -2,9 +2,16 @@
 
 // Standard C++ includes
 #include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
+// Standard C includes
+#include <cstdint>
+
 // PLOG includes
 #include <plog/Log.h>
 
@@ -15,6 +22,7 @@
 #include "modelSpecInternal.h"
 
 // Code generator includes
+#include "code_generator/backendBase.h"
 #include "code_generator/codeStream.h"
 #include "code_generator/generateInit.h"
 #include "code_generator/generateNeuronUpdate.h"
@@ -23,23 +31,104 @@
 #include "code_generator/generateRunner.h"
 #include "code_generator/modelSpecMerged.h"
 
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+// 64-bit FNV-1a parameters
+const uint64_t fnvOffsetBasis = 14695981039346656037ull;
+const uint64_t fnvPrime = 1099511628211ull;
+
+void updateHash(uint64_t &hash, const std::string &contents)
+{
+    for(const char c : contents) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= fnvPrime;
+    }
+}
+//--------------------------------------------------------------------------
+bool readFile(const filesystem::path &path, std::string &contents)
+{
+    std::ifstream file(path.str(), std::ios::binary);
+    if(!file.good()) {
+        return false;
+    }
+
+    std::ostringstream contentsStream;
+    contentsStream << file.rdbuf();
+    contents = contentsStream.str();
+    return true;
+}
+}   // Anonymous namespace
+
 //--------------------------------------------------------------------------
 // CodeGenerator
 //--------------------------------------------------------------------------
+bool CodeGenerator::writeFileIfChanged(const filesystem::path &path, const std::string &contents)
+{
+    // If file already exists and its contents match the new contents, leave it (and its timestamp) alone
+    std::string existingContents;
+    if(readFile(path, existingContents) && existingContents == contents) {
+        LOGD_CODE_GEN << "Generated file '" << path.str() << "' unchanged";
+        return false;
+    }
+
+    // Otherwise, overwrite file
+    std::ofstream file(path.str(), std::ios::binary);
+    file << contents;
+    if(!file.good()) {
+        throw std::runtime_error("Unable to write generated file '" + path.str() + "'");
+    }
+    return true;
+}
+//--------------------------------------------------------------------------
+std::string CodeGenerator::getBuildCacheKey(const BackendBase &backend, const filesystem::path &outputPath,
+                                            const std::vector<std::string> &moduleNames)
+{
+    // Hash makefile preamble as this contains compiler flags derived from backend preferences
+    uint64_t hash = fnvOffsetBasis;
+    std::ostringstream preamble;
+    backend.genMakefilePreamble(preamble);
+    updateHash(hash, preamble.str());
+
+    // Hash generated headers and modules
+    std::vector<std::string> filenames = {"definitions.h", "definitionsInternal.h", "supportCode.h"};
+    for(const auto &m : moduleNames) {
+        filenames.push_back(m + ".cc");
+    }
+    for(const auto &f : filenames) {
+        std::string contents;
+        if(!readFile(outputPath / f, contents)) {
+            throw std::runtime_error("Unable to read generated file '" + (outputPath / f).str() + "'");
+        }
+
+        // **NOTE** filename is included so contents can't 'move' between files without changing key
+        updateHash(hash, f);
+        updateHash(hash, contents);
+    }
+
+    // Return hash as fixed-width hex string
+    std::ostringstream key;
+    key << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return key.str();
+}
+//--------------------------------------------------------------------------
 std::vector<std::string> CodeGenerator::generateAll(const ModelSpecInternal &model, const BackendBase &backend,
                                                     const filesystem::path &outputPath, bool standaloneModules)
 {
     // Create directory for generated code
     filesystem::create_directory(outputPath);
 
-    // Open output file streams for generated code files
-    std::ofstream definitionsStream((outputPath / "definitions.h").str());
-    std::ofstream definitionsInternalStream((outputPath / "definitionsInternal.h").str());
-    std::ofstream supportCodeStream((outputPath / "supportCode.h").str());
-    std::ofstream neuronUpdateStream((outputPath / "neuronUpdate.cc").str());
-    std::ofstream synapseUpdateStream((outputPath / "synapseUpdate.cc").str());
-    std::ofstream initStream((outputPath / "init.cc").str());
-    std::ofstream runnerStream((outputPath / "runner.cc").str());
+    // Generate code into string streams so files only need to be overwritten if they've changed
+    // **NOTE** this preserves the timestamps of unchanged modules so they aren't needlessly recompiled
+    std::ostringstream definitionsStream;
+    std::ostringstream definitionsInternalStream;
+    std::ostringstream supportCodeStream;
+    std::ostringstream neuronUpdateStream;
+    std::ostringstream synapseUpdateStream;
+    std::ostringstream initStream;
+    std::ostringstream runnerStream;
 
     // Wrap output file streams in CodeStreams for formatting
     CodeStream definitions(definitionsStream);
@@ -62,6 +151,19 @@ std::vector<std::string> CodeGenerator::generateAll(const ModelSpecInternal &mod
 
     generateSupportCode(supportCode, modelMerged);
 
+    // Write any generated files which have changed
+    const std::vector<std::pair<std::string, const std::ostringstream&>> generatedFiles{
+        {"definitions.h", definitionsStream}, {"definitionsInternal.h", definitionsInternalStream},
+        {"supportCode.h", supportCodeStream}, {"neuronUpdate.cc", neuronUpdateStream},
+        {"synapseUpdate.cc", synapseUpdateStream}, {"init.cc", initStream}, {"runner.cc", runnerStream}};
+    size_t numWritten = 0;
+    for(const auto &f : generatedFiles) {
+        if(writeFileIfChanged(outputPath / f.first, f.second.str())) {
+            numWritten++;
+        }
+    }
+    LOGI_CODE_GEN << numWritten << "/" << generatedFiles.size() << " generated files changed";
+
     // Create basic list of modules
     std::vector<std::string> modules = {"neuronUpdate", "synapseUpdate", "init"};
 
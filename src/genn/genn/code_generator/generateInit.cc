@@ -19,7 +19,8 @@
 namespace
 {
 void genInitSpikeCount(CodeGenerator::CodeStream &os, const CodeGenerator::BackendBase &backend,
-                       const CodeGenerator::Substitutions &popSubs, const CodeGenerator::NeuronGroupMerged &ng, bool spikeEvent)
+                       const CodeGenerator::Substitutions &popSubs, const CodeGenerator::NeuronGroupMerged &ng, bool spikeEvent,
+                       unsigned int batchSize)
 {
     using namespace CodeGenerator;
 
@@ -28,7 +29,7 @@ void genInitSpikeCount(CodeGenerator::CodeStream &os, const CodeGenerator::Backe
     if(initRequired) {
         // Generate variable initialisation code
         backend.genPopVariableInit(os, popSubs,
-            [&backend, &ng, spikeEvent] (CodeStream &os, Substitutions &)
+            [&backend, &ng, spikeEvent, batchSize] (CodeStream &os, Substitutions &)
             {
                 // Get variable name
                 const char *spikeCntName = spikeEvent ? "spkCntEvnt" : "spkCnt";
@@ -38,23 +39,30 @@ void genInitSpikeCount(CodeGenerator::CodeStream &os, const CodeGenerator::Backe
                     ng.getArchetype().isDelayRequired() :
                     (ng.getArchetype().isTrueSpikeRequired() && ng.getArchetype().isDelayRequired());
 
-                if(delayRequired) {
-                    os << "for (unsigned int d = 0; d < " << ng.getArchetype().getNumDelaySlots() << "; d++)";
+                // Each batch has its own spike counts
+                genBatchLoop(os, batchSize,
+                    [&ng, spikeCntName, delayRequired, batchSize](CodeStream &os)
                     {
-                        CodeStream::Scope b(os);
-                        os << "group." << spikeCntName << "[d] = 0;" << std::endl;
-                    }
-                }
-                else {
-                    os << "group." << spikeCntName << "[0] = 0;" << std::endl;
-                }
+                        if(delayRequired) {
+                            const std::string numDelaySlots = std::to_string(ng.getArchetype().getNumDelaySlots());
+                            os << "for (unsigned int d = 0; d < " << numDelaySlots << "; d++)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "group." << spikeCntName << "[" << getBatchOffset(batchSize, numDelaySlots) << "d] = 0;" << std::endl;
+                            }
+                        }
+                        else {
+                            os << "group." << spikeCntName << "[" << ((batchSize > 1) ? "batch" : "0") << "] = 0;" << std::endl;
+                        }
+                    });
             });
     }
 
 }
 //--------------------------------------------------------------------------
 void genInitSpikes(CodeGenerator::CodeStream &os, const CodeGenerator::BackendBase &backend,
-                   const CodeGenerator::Substitutions &popSubs, const CodeGenerator::NeuronGroupMerged &ng, bool spikeEvent)
+                   const CodeGenerator::Substitutions &popSubs, const CodeGenerator::NeuronGroupMerged &ng, bool spikeEvent,
+                   unsigned int batchSize)
 {
     using namespace CodeGenerator;
 
@@ -63,7 +71,7 @@ void genInitSpikes(CodeGenerator::CodeStream &os, const CodeGenerator::BackendBa
     if(initRequired) {
         // Generate variable initialisation code
         backend.genVariableInit(os, "group.numNeurons", "id", popSubs,
-            [&backend, &ng, spikeEvent] (CodeStream &os, Substitutions &varSubs)
+            [&backend, &ng, spikeEvent, batchSize] (CodeStream &os, Substitutions &varSubs)
             {
                 // Get variable name
                 const char *spikeName = spikeEvent ? "spkEvnt" : "spk";
@@ -73,16 +81,22 @@ void genInitSpikes(CodeGenerator::CodeStream &os, const CodeGenerator::BackendBa
                     ng.getArchetype().isDelayRequired() :
                     (ng.getArchetype().isTrueSpikeRequired() && ng.getArchetype().isDelayRequired());
 
-                if(delayRequired) {
-                    os << "for (unsigned int d = 0; d < " << ng.getArchetype().getNumDelaySlots() << "; d++)";
+                // Each batch has its own spikes
+                genBatchLoop(os, batchSize,
+                    [&ng, &varSubs, spikeName, delayRequired, batchSize](CodeStream &os)
                     {
-                        CodeStream::Scope b(os);
-                        os << "group." << spikeName << "[(d * group.numNeurons) + " + varSubs["id"] + "] = 0;" << std::endl;
-                    }
-                }
-                else {
-                    os << "group." << spikeName << "[" << varSubs["id"] << "] = 0;" << std::endl;
-                }
+                        if(delayRequired) {
+                            const std::string numDelaySlots = std::to_string(ng.getArchetype().getNumDelaySlots());
+                            os << "for (unsigned int d = 0; d < " << numDelaySlots << "; d++)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "group." << spikeName << "[" << getBatchOffset(batchSize, numDelaySlots + " * group.numNeurons") << "(d * group.numNeurons) + " + varSubs["id"] + "] = 0;" << std::endl;
+                            }
+                        }
+                        else {
+                            os << "group." << spikeName << "[" << getBatchOffset(batchSize, "group.numNeurons") << varSubs["id"] << "] = 0;" << std::endl;
+                        }
+                    });
             });
     }
 }
@@ -90,8 +104,8 @@ void genInitSpikes(CodeGenerator::CodeStream &os, const CodeGenerator::BackendBa
 template<typename I, typename Q>
 void genInitNeuronVarCode(CodeGenerator::CodeStream &os, const CodeGenerator::BackendBase &backend, const CodeGenerator::Substitutions &popSubs,
                           const Models::Base::VarVec &vars, const std::string &fieldSuffix, const std::string &countMember, 
-                          size_t numDelaySlots, const size_t groupIndex, const std::string &ftype,
-                          I getVarInitialiser, Q isVarQueueRequired)
+                          size_t numDelaySlots, const size_t groupIndex, const std::string &ftype, unsigned int batchSize,
+                          I getVarInitialiser, Q isVarQueueRequired, bool latestRequired = false)
 {
     using namespace CodeGenerator;
 
@@ -105,39 +119,50 @@ void genInitNeuronVarCode(CodeGenerator::CodeStream &os, const CodeGenerator::Ba
 
             // Generate target-specific code to initialise variable
             backend.genVariableInit(os, count, "id", popSubs,
-                [&backend, &vars, &varInit, &fieldSuffix, &ftype, groupIndex, k, count, isVarQueueRequired, numDelaySlots]
+                [&backend, &vars, &varInit, &fieldSuffix, &ftype, groupIndex, k, count, isVarQueueRequired, numDelaySlots, latestRequired, batchSize]
                 (CodeStream &os, Substitutions &varSubs)
                 {
                     varSubs.addParamValueSubstitution(varInit.getSnippet()->getParamNames(), varInit.getParams());
                     varSubs.addVarValueSubstitution(varInit.getSnippet()->getDerivedParams(), varInit.getDerivedParams());
 
-                    // If variable requires a queue
-                    if (isVarQueueRequired(k)) {
-                        // Generate initial value into temporary variable
-                        os << vars[k].type << " initVal;" << std::endl;
-                        varSubs.addVarSubstitution("value", "initVal");
-
-
-                        std::string code = varInit.getSnippet()->getCode();
-                        varSubs.applyCheckUnreplaced(code, "initVar : " + vars[k].name + "merged" + std::to_string(groupIndex));
-                        code = ensureFtype(code, ftype);
-                        os << code << std::endl;
-
-                        // Copy this into all delay slots
-                        os << "for (unsigned int d = 0; d < " << numDelaySlots << "; d++)";
+                    // Initialise each batch's copy of variable in turn
+                    // **NOTE** if initialisation code draws random numbers, successive batches take successive draws from this element's stream
+                    genBatchLoop(os, batchSize,
+                        [&](CodeStream &os)
                         {
-                            CodeStream::Scope b(os);
-                            os << "group." + vars[k].name << fieldSuffix << "[(d * " << count << ") + " + varSubs["id"] + "] = initVal;" << std::endl;
-                        }
-                    }
-                    else {
-                        varSubs.addVarSubstitution("value", "group." + vars[k].name + fieldSuffix + "[" + varSubs["id"] + "]");
-
-                        std::string code = varInit.getSnippet()->getCode();
-                        varSubs.applyCheckUnreplaced(code, "initVar : " + vars[k].name + "merged" + std::to_string(groupIndex));
-                        code = ensureFtype(code, ftype);
-                        os << code << std::endl;
-                    }
+                            // If variable requires a queue
+                            if (isVarQueueRequired(k)) {
+                                // Generate initial value into temporary variable
+                                os << vars[k].type << " initVal;" << std::endl;
+                                varSubs.addVarSubstitution("value", "initVal");
+
+
+                                std::string code = varInit.getSnippet()->getCode();
+                                varSubs.applyCheckUnreplaced(code, "initVar : " + vars[k].name + "merged" + std::to_string(groupIndex));
+                                code = ensureFtype(code, ftype);
+                                os << code << std::endl;
+
+                                // Copy this into all delay slots
+                                os << "for (unsigned int d = 0; d < " << numDelaySlots << "; d++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "group." + vars[k].name << fieldSuffix << "[" << getBatchedVarIndex(batchSize, "(d * " + count + ") + " + varSubs["id"]) << "] = initVal;" << std::endl;
+                                }
+
+                                // If latest value is stored separately from delay slots, also copy it there
+                                if(latestRequired) {
+                                    os << "group." + vars[k].name << "Latest" << fieldSuffix << "[" + getBatchedVarIndex(batchSize, varSubs["id"]) + "] = initVal;" << std::endl;
+                                }
+                            }
+                            else {
+                                varSubs.addVarSubstitution("value", "group." + vars[k].name + fieldSuffix + "[" + getBatchedVarIndex(batchSize, varSubs["id"]) + "]");
+
+                                std::string code = varInit.getSnippet()->getCode();
+                                varSubs.applyCheckUnreplaced(code, "initVar : " + vars[k].name + "merged" + std::to_string(groupIndex));
+                                code = ensureFtype(code, ftype);
+                                os << code << std::endl;
+                            }
+                        });
                 });
         }
     }
@@ -146,16 +171,17 @@ void genInitNeuronVarCode(CodeGenerator::CodeStream &os, const CodeGenerator::Ba
 template<typename I>
 void genInitNeuronVarCode(CodeGenerator::CodeStream &os, const CodeGenerator::BackendBase &backend, const CodeGenerator::Substitutions &popSubs,
                           const Models::Base::VarVec &vars, const std::string &fieldSuffix, const std::string &countMember, 
-                          const size_t groupIndex, const std::string &ftype, I getVarInitialiser)
+                          const size_t groupIndex, const std::string &ftype, unsigned int batchSize, I getVarInitialiser)
 {
-    genInitNeuronVarCode(os, backend, popSubs, vars, fieldSuffix, countMember, 0, groupIndex, ftype,
+    genInitNeuronVarCode(os, backend, popSubs, vars, fieldSuffix, countMember, 0, groupIndex, ftype, batchSize,
                          getVarInitialiser,
                          [](size_t){ return false; });
 }
 //------------------------------------------------------------------------
 // Initialise one row of weight update model variables
 void genInitWUVarCode(CodeGenerator::CodeStream &os, const CodeGenerator::BackendBase &backend,
-                      const CodeGenerator::Substitutions &popSubs, const CodeGenerator::SynapseGroupMerged &sg, const std::string &ftype)
+                      const CodeGenerator::Substitutions &popSubs, const CodeGenerator::SynapseGroupMerged &sg, const std::string &ftype,
+                      unsigned int batchSize)
 {
     using namespace CodeGenerator;
 
@@ -169,17 +195,36 @@ void genInitWUVarCode(CodeGenerator::CodeStream &os, const CodeGenerator::Backen
 
             // Generate target-specific code to initialise variable
             backend.genSynapseVariableRowInit(os, sg, popSubs,
-                [&backend, &vars, &varInit, &sg, &ftype, k]
+                [&backend, &vars, &varInit, &sg, &ftype, k, batchSize]
                 (CodeStream &os, Substitutions &varSubs)
                 {
-                    varSubs.addVarSubstitution("value", "group." + vars[k].name + "[" + varSubs["id_syn"] +  "]");
+                    const std::string var = "group." + vars[k].name + "[" + getBatchedVarIndex(batchSize, varSubs["id_syn"]) +  "]";
+                    const VarStorage storage = sg.getArchetype().getWUVarStorage(k);
                     varSubs.addParamValueSubstitution(varInit.getSnippet()->getParamNames(), varInit.getParams());
                     varSubs.addVarValueSubstitution(varInit.getSnippet()->getDerivedParams(), varInit.getDerivedParams());
 
-                    std::string code = varInit.getSnippet()->getCode();
-                    varSubs.applyCheckUnreplaced(code, "initVar : merged" + vars[k].name + std::to_string(sg.getIndex()));
-                    code = ensureFtype(code, ftype);
-                    os << code << std::endl;
+                    // Initialise each batch's copy of this synapse's variable in turn
+                    genBatchLoop(os, batchSize,
+                        [&](CodeStream &os)
+                        {
+                            std::string code = varInit.getSnippet()->getCode();
+
+                            // If variable is stored natively, initialise it directly
+                            if(storage == VarStorage::NATIVE) {
+                                varSubs.addVarSubstitution("value", var);
+                                varSubs.applyCheckUnreplaced(code, "initVar : merged" + vars[k].name + std::to_string(sg.getIndex()));
+                                os << ensureFtype(code, ftype) << std::endl;
+                            }
+                            // Otherwise, initialise local variable and convert it into storage format
+                            else {
+                                CodeStream::Scope b(os);
+                                varSubs.addVarSubstitution("value", "initVal");
+                                varSubs.applyCheckUnreplaced(code, "initVar : merged" + vars[k].name + std::to_string(sg.getIndex()));
+                                os << vars[k].type << " initVal;" << std::endl;
+                                os << ensureFtype(code, ftype) << std::endl;
+                                os << var << " = " << getVarStorageStore(storage, sg.getArchetype().getWUVarStorageScale(k), "initVal") << ";" << std::endl;
+                            }
+                        });
                 });
         }
     }
@@ -201,6 +246,7 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedEGPMap &mergedEGPs,
 
     // Generate functions to push merged synapse group structures
     const ModelSpecInternal &model = modelMerged.getModel();
+    const unsigned int batchSize = model.getBatchSize();
     genMergedGroupPush(os, modelMerged.getMergedNeuronInitGroups(), mergedEGPs, "NeuronInit", backend);
     genMergedGroupPush(os, modelMerged.getMergedSynapseDenseInitGroups(), mergedEGPs, "SynapseDenseInit", backend);
     genMergedGroupPush(os, modelMerged.getMergedSynapseConnectivityInitGroups(), mergedEGPs, "SynapseConnectivityInit", backend);
@@ -208,39 +254,60 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedEGPMap &mergedEGPs,
 
     backend.genInit(os, modelMerged,
         // Local neuron group initialisation
-        [&backend, &model](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &popSubs)
+        [&backend, &model, batchSize](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &popSubs)
         {
             // Initialise spike counts
-            genInitSpikeCount(os, backend, popSubs, ng, false);
-            genInitSpikeCount(os, backend, popSubs, ng, true);
+            genInitSpikeCount(os, backend, popSubs, ng, false, batchSize);
+            genInitSpikeCount(os, backend, popSubs, ng, true, batchSize);
 
             // Initialise spikes
-            genInitSpikes(os, backend, popSubs, ng, false);
-            genInitSpikes(os, backend, popSubs, ng, true);
+            genInitSpikes(os, backend, popSubs, ng, false, batchSize);
+            genInitSpikes(os, backend, popSubs, ng, true, batchSize);
 
             // If spike times are required
             if(ng.getArchetype().isSpikeTimeRequired()) {
                 // Generate variable initialisation code
                 backend.genVariableInit(os, "group.numNeurons", "id", popSubs,
-                    [&backend, &ng] (CodeStream &os, Substitutions &varSubs)
+                    [&backend, &ng, batchSize] (CodeStream &os, Substitutions &varSubs)
                     {
-                        // Is delay required
-                        if(ng.getArchetype().isDelayRequired()) {
-                            os << "for (unsigned int d = 0; d < " << ng.getArchetype().getNumDelaySlots() << "; d++)";
+                        genBatchLoop(os, batchSize,
+                            [&ng, &varSubs, batchSize](CodeStream &os)
                             {
-                                CodeStream::Scope b(os);
-                                os << "group.sT[(d * group.numNeurons) + " + varSubs["id"] + "] = -TIME_MAX;" << std::endl;
-                            }
-                        }
-                        else {
-                            os << "group.sT[" << varSubs["id"] << "] = -TIME_MAX;" << std::endl;
-                        }
+                                // Is delay required
+                                if(ng.getArchetype().isDelayRequired()) {
+                                    os << "for (unsigned int d = 0; d < " << ng.getArchetype().getNumDelaySlots() << "; d++)";
+                                    {
+                                        CodeStream::Scope b(os);
+                                        os << "group.sT[" << getBatchedVarIndex(batchSize, "(d * group.numNeurons) + " + varSubs["id"]) << "] = -TIME_MAX;" << std::endl;
+                                    }
+                                }
+                                else {
+                                    os << "group.sT[" << getBatchedVarIndex(batchSize, varSubs["id"]) << "] = -TIME_MAX;" << std::endl;
+                                }
+                            });
+                    });
+            }
+
+            // If timesteps (and times) of latest spikes are stored separately from delay slots
+            // **NOTE** timesteps are initialised to zero as, until neurons spike, delay slots and latest values are identical
+            if(backend.isLatestDelayedStateSupported() && ng.getArchetype().isLatestSpikeTimestepRequired()) {
+                backend.genVariableInit(os, "group.numNeurons", "id", popSubs,
+                    [&ng, batchSize] (CodeStream &os, Substitutions &varSubs)
+                    {
+                        genBatchLoop(os, batchSize,
+                            [&ng, &varSubs, batchSize](CodeStream &os)
+                            {
+                                os << "group.spkTimestepLatest[" << getBatchedVarIndex(batchSize, varSubs["id"]) << "] = 0;" << std::endl;
+                                if(ng.getArchetype().isSpikeTimeRequired()) {
+                                    os << "group.sTLatest[" << getBatchedVarIndex(batchSize, varSubs["id"]) << "] = -TIME_MAX;" << std::endl;
+                                }
+                            });
                     });
             }
 
             // Initialise neuron variables
             genInitNeuronVarCode(os, backend, popSubs, ng.getArchetype().getNeuronModel()->getVars(), "", "numNeurons",
-                                 ng.getArchetype().getNumDelaySlots(), ng.getIndex(), model.getPrecision(),
+                                 ng.getArchetype().getNumDelaySlots(), ng.getIndex(), model.getPrecision(), batchSize,
                                  [&ng](size_t i){ return ng.getArchetype().getVarInitialisers().at(i); },
                                  [&ng](size_t i){ return ng.getArchetype().isVarQueueRequired(i); });
 
@@ -253,21 +320,29 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedEGPMap &mergedEGPs,
                 // If this synapse group's input variable should be initialised on device
                 // Generate target-specific code to initialise variable
                 backend.genVariableInit(os, "group.numNeurons", "id", popSubs,
-                    [&backend, &model, sg, i] (CodeStream &os, Substitutions &varSubs)
+                    [&backend, &model, sg, i, batchSize] (CodeStream &os, Substitutions &varSubs)
                     {
-                        os << "group.inSynInSyn" << i << "[" << varSubs["id"] << "] = " << model.scalarExpr(0.0) << ";" << std::endl;
+                        genBatchLoop(os, batchSize,
+                            [&model, &varSubs, i, batchSize](CodeStream &os)
+                            {
+                                os << "group.inSynInSyn" << i << "[" << getBatchedVarIndex(batchSize, varSubs["id"]) << "] = " << model.scalarExpr(0.0) << ";" << std::endl;
+                            });
                     });
 
                 // If dendritic delays are required
                 if(sg->isDendriticDelayRequired()) {
                     backend.genVariableInit(os, "group.numNeurons", "id", popSubs,
-                        [&backend, &model, sg, i](CodeStream &os, Substitutions &varSubs)
+                        [&backend, &model, sg, i, batchSize](CodeStream &os, Substitutions &varSubs)
                         {
                             os << "for (unsigned int d = 0; d < " << sg->getMaxDendriticDelayTimesteps() << "; d++)";
                             {
                                 CodeStream::Scope b(os);
                                 const std::string denDelayIndex = "(d * group.numNeurons) + " + varSubs["id"];
-                                os << "group.denDelayInSyn" << i << "[" << denDelayIndex << "] = " << model.scalarExpr(0.0) << ";" << std::endl;
+                                genBatchLoop(os, batchSize,
+                                    [&model, &denDelayIndex, i, batchSize](CodeStream &os)
+                                    {
+                                        os << "group.denDelayInSyn" << i << "[" << getBatchedVarIndex(batchSize, denDelayIndex) << "] = " << model.scalarExpr(0.0) << ";" << std::endl;
+                                    });
                             }
                         });
                 }
@@ -276,7 +351,7 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedEGPMap &mergedEGPs,
                 if(sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
                     genInitNeuronVarCode(os, backend, popSubs, sg->getPSModel()->getVars(), 
                                          "InSyn" + std::to_string(i), "numNeurons",
-                                         i, model.getPrecision(),
+                                         i, model.getPrecision(), batchSize,
                                          [sg](size_t i){ return sg->getPSVarInitialisers().at(i); });
                 }
             }
@@ -287,9 +362,10 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedEGPMap &mergedEGPs,
                 const auto *sg = inSynWithPostCode[i];
                 genInitNeuronVarCode(os, backend, popSubs, sg->getWUModel()->getPostVars(),
                                      "WUPost" + std::to_string(i), "numNeurons", sg->getTrgNeuronGroup()->getNumDelaySlots(),
-                                     i, model.getPrecision(),
+                                     i, model.getPrecision(), batchSize,
                                      [&sg](size_t i){ return sg->getWUPostVarInitialisers().at(i); },
-                                     [&sg](size_t){ return (sg->getBackPropDelaySteps() != NO_DELAY); });
+                                     [&sg](size_t){ return (sg->getBackPropDelaySteps() != NO_DELAY); },
+                                     backend.isLatestDelayedStateSupported() && sg->isWUPostVarLatestRequired());
             }
 
             // Loop through outgoing synaptic populations with presynaptic update code
@@ -299,9 +375,10 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedEGPMap &mergedEGPs,
                 // **NOTE** number of delay slots is based on the source neuron (for simplicity) but whether delay is required is based on the synapse group
                 genInitNeuronVarCode(os, backend, popSubs, sg->getWUModel()->getPreVars(),
                                      "WUPre" + std::to_string(i), "numNeurons", sg->getSrcNeuronGroup()->getNumDelaySlots(),
-                                     i, model.getPrecision(),
+                                     i, model.getPrecision(), batchSize,
                                      [&sg](size_t i){ return sg->getWUPreVarInitialisers().at(i); },
-                                     [&sg](size_t){ return (sg->getDelaySteps() != NO_DELAY); });
+                                     [&sg](size_t){ return (sg->getDelaySteps() != NO_DELAY); },
+                                     backend.isLatestDelayedStateSupported() && sg->isWUPreVarLatestRequired());
             }
 
             // Loop through current sources
@@ -311,19 +388,19 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedEGPMap &mergedEGPs,
 
                 genInitNeuronVarCode(os, backend, popSubs, cs->getCurrentSourceModel()->getVars(), 
                                      "CS" + std::to_string(i), "numNeurons",
-                                     i, model.getPrecision(),
+                                     i, model.getPrecision(), batchSize,
                                      [cs](size_t i){ return cs->getVarInitialisers().at(i); });
             }
         },
         // Dense syanptic matrix variable initialisation
-        [&backend, &model](CodeStream &os, const SynapseGroupMerged &sg, Substitutions &popSubs)
+        [&backend, &model, batchSize](CodeStream &os, const SynapseGroupMerged &sg, Substitutions &popSubs)
         {
             // Loop through rows
             os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
             {
                 CodeStream::Scope b(os);
                 popSubs.addVarSubstitution("id_pre", "i");
-                genInitWUVarCode(os, backend, popSubs, sg, model.getPrecision());
+                genInitWUVarCode(os, backend, popSubs, sg, model.getPrecision(), batchSize);
 
             }
         },
@@ -357,9 +434,9 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedEGPMap &mergedEGPs,
             }
         },
         // Sparse synaptic matrix var initialisation
-        [&backend, &model](CodeStream &os, const SynapseGroupMerged &sg, Substitutions &popSubs)
+        [&backend, &model, batchSize](CodeStream &os, const SynapseGroupMerged &sg, Substitutions &popSubs)
         {
-            genInitWUVarCode(os, backend, popSubs, sg, model.getPrecision());
+            genInitWUVarCode(os, backend, popSubs, sg, model.getPrecision(), batchSize);
         },
         // Initialise push EGP handler
         [&backend, &mergedEGPs](CodeStream &os)
@@ -13,7 +13,8 @@
 // CodeGenerator
 //--------------------------------------------------------------------------
 void CodeGenerator::generateMakefile(std::ostream &os, const BackendBase &backend,
-                                     const std::vector<std::string> &moduleNames)
+                                     const std::vector<std::string> &moduleNames,
+                                     const std::string &buildCacheKey, const std::string &buildCacheDirectory)
 {
     //**TODO** deal with standard include paths e.g. MPI here
 
@@ -39,6 +40,29 @@ void CodeGenerator::generateMakefile(std::ostream &os, const BackendBase &backen
     os << "all: librunner.so" << std::endl;
     os << std::endl;
 
+    // If a build cache key is provided
+    const bool buildCache = !buildCacheKey.empty();
+    if(buildCache) {
+        // Write cache location, allowing directory to be overriden from environment
+        os << "GENN_BUILD_CACHE ?= " << buildCacheDirectory << std::endl;
+        os << std::endl;
+
+        // If cache is enabled, hash identity and version of compiler along with the flags make will actually use
+        // **NOTE** these can be overriden when make is invoked so can't be included in key at generation time
+        os << "ifneq ($(GENN_BUILD_CACHE),)" << std::endl;
+        os << "BUILD_CONFIG_KEY := $(shell ($(CXX) --version; $(if $(NVCC),$(NVCC) --version;) echo '$(CXX) $(NVCC) $(CXXFLAGS) $(NVCCFLAGS) $(LINKFLAGS)') 2>/dev/null | cksum | cut -d' ' -f1)" << std::endl;
+        os << "CACHED_RUNNER := $(GENN_BUILD_CACHE)/" << buildCacheKey << "/$(BUILD_CONFIG_KEY)/librunner.so" << std::endl;
+        os << "endif" << std::endl;
+        os << std::endl;
+
+        // If cache is enabled and contains runner, copy it rather than building
+        // **NOTE** the makefile is only rewritten when the key changes so it's a suitable stamp to detect a stale runner
+        os << "ifneq ($(and $(GENN_BUILD_CACHE),$(wildcard $(CACHED_RUNNER))),)" << std::endl;
+        os << "librunner.so: Makefile" << std::endl;
+        os << "\t@cp $(CACHED_RUNNER) $@" << std::endl;
+        os << "else" << std::endl;
+    }
+
     // Add rule to build shared library from objects
     os << "librunner.so: $(OBJECTS)" << std::endl;
     backend.genMakefileLinkRule(os);
@@ -46,6 +70,15 @@ void CodeGenerator::generateMakefile(std::ostream &os, const BackendBase &backen
 #ifdef __APPLE__
     os << "\t@install_name_tool -id \"@rpath/$@\" $@" << std::endl;
 #endif
+
+    // If cache is enabled, add freshly-built runner to it
+    // **NOTE** copy to temporary file and rename so concurrent builds never see a partial runner
+    if(buildCache) {
+        os << "ifneq ($(GENN_BUILD_CACHE),)" << std::endl;
+        os << "\t@mkdir -p $(dir $(CACHED_RUNNER)) && cp $@ $(CACHED_RUNNER).$$$$ && mv -f $(CACHED_RUNNER).$$$$ $(CACHED_RUNNER)" << std::endl;
+        os << "endif" << std::endl;
+        os << "endif" << std::endl;
+    }
     os << std::endl;
 
     // Include depencies
@@ -32,6 +32,53 @@ void addNeuronModelSubstitutions(CodeGenerator::Substitutions &substitution, con
     substitution.addVarValueSubstitution(nm->getDerivedParams(), ng.getDerivedParams(), sourceSuffix);
     substitution.addVarNameSubstitution(nm->getExtraGlobalParams(), sourceSuffix, "group.");
 }
+//--------------------------------------------------------------------------
+void genFillDelaySlotsSinceLatestSpike(CodeGenerator::CodeStream &os, const CodeGenerator::NeuronGroupMerged &ng,
+                                       const CodeGenerator::Substitutions &popSubs, unsigned int batchSize)
+{
+    using namespace CodeGenerator;
+
+    // Spike times and spike-triggered weight update model variables are only written to the delay slots of neurons which spike
+    // so, to avoid copying them between delay slots every timestep, copy latest values into slots written since previous spike
+    // **NOTE** the slot for this timestep is written by the spike itself and only slots which may still be read need filling
+    CodeStream::Scope b(os);
+    const unsigned int numDelaySlots = ng.getArchetype().getNumDelaySlots();
+    const std::string id = popSubs["id"];
+    const std::string latestIdx = getBatchedVarIndex(batchSize, id);
+    const std::string gapIdx = getBatchedVarIndex(batchSize, "gapDelayOffset + " + id);
+    os << "const unsigned long long numGapSteps = iT - group.spkTimestepLatest[" << latestIdx << "];" << std::endl;
+    os << "const unsigned int numGapSlots = (numGapSteps > " << numDelaySlots << ") ? " << (numDelaySlots - 1) << " : ((numGapSteps == 0) ? 0 : (unsigned int)(numGapSteps - 1));" << std::endl;
+    os << "for(unsigned int d = 1; d <= numGapSlots; d++)";
+    {
+        CodeStream::Scope b(os);
+        os << "const unsigned int gapDelayOffset = ((*group.spkQuePtr + " << numDelaySlots << " - d) % " << numDelaySlots << ") * group.numNeurons;" << std::endl;
+        if(ng.getArchetype().isSpikeTimeRequired()) {
+            os << "group.sT[" << gapIdx << "] = group.sTLatest[" << latestIdx << "];" << std::endl;
+        }
+
+        // Fill presynaptic WUM variables
+        const auto outSynWithPreCode = ng.getArchetype().getOutSynWithPreCode();
+        for(size_t i = 0; i < outSynWithPreCode.size(); i++) {
+            if(outSynWithPreCode[i]->isWUPreVarLatestRequired()) {
+                for(const auto &v : outSynWithPreCode[i]->getWUModel()->getPreVars()) {
+                    os << "group." << v.name << "WUPre" << i << "[" << gapIdx << "] = ";
+                    os << "group." << v.name << "LatestWUPre" << i << "[" << latestIdx << "];" << std::endl;
+                }
+            }
+        }
+
+        // Fill postsynaptic WUM variables
+        const auto inSynWithPostCode = ng.getArchetype().getInSynWithPostCode();
+        for(size_t i = 0; i < inSynWithPostCode.size(); i++) {
+            if(inSynWithPostCode[i]->isWUPostVarLatestRequired()) {
+                for(const auto &v : inSynWithPostCode[i]->getWUModel()->getPostVars()) {
+                    os << "group." << v.name << "WUPost" << i << "[" << gapIdx << "] = ";
+                    os << "group." << v.name << "LatestWUPost" << i << "[" << latestIdx << "];" << std::endl;
+                }
+            }
+        }
+    }
+}
 }   // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -63,6 +110,10 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
         {
             const ModelSpecInternal &model = modelMerged.getModel();
             const NeuronModels::Base *nm = ng.getArchetype().getNeuronModel();
+            const unsigned int batchSize = model.getBatchSize();
+
+            // Are delayed spike times and spike-triggered variables only written to the delay slots of neurons which spike?
+            const bool latestDelayedState = (backend.isLatestDelayedStateSupported() && ng.getArchetype().isLatestSpikeTimestepRequired());
 
             // Generate code to copy neuron state into local variable
             for(const auto &v : nm->getVars()) {
@@ -70,20 +121,20 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                     os << "const ";
                 }
                 os << v.type << " l" << v.name << " = ";
-                os << "group." << v.name << "[";
-                if (ng.getArchetype().isVarQueueRequired(v.name) && ng.getArchetype().isDelayRequired()) {
-                    os << "readDelayOffset + ";
-                }
-                os << popSubs["id"] << "];" << std::endl;
+                const bool delayed = (ng.getArchetype().isVarQueueRequired(v.name) && ng.getArchetype().isDelayRequired());
+                os << "group." << v.name << "[" << getBatchedVarIndex(batchSize, (delayed ? "readDelayOffset + " : "") + popSubs["id"]) << "];" << std::endl;
             }
     
             // Also read spike time into local variable
+            // **NOTE** if spike times are only written to the delay slots of neurons which spike, the latest one is stored separately
             if(ng.getArchetype().isSpikeTimeRequired()) {
-                os << model.getTimePrecision() << " lsT = group.sT[";
-                if (ng.getArchetype().isDelayRequired()) {
-                    os << "readDelayOffset + ";
+                if(latestDelayedState) {
+                    os << model.getTimePrecision() << " lsT = group.sTLatest[" << getBatchedVarIndex(batchSize, popSubs["id"]) << "];" << std::endl;
+                }
+                else {
+                    const std::string offset = ng.getArchetype().isDelayRequired() ? "readDelayOffset + " : "";
+                    os << model.getTimePrecision() << " lsT = group.sT[" << getBatchedVarIndex(batchSize, offset + popSubs["id"]) << "];" << std::endl;
                 }
-                os << popSubs["id"] << "];" << std::endl;
             }
             os << std::endl;
 
@@ -119,13 +170,14 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                 const auto *psm = sg->getPSModel();
 
                 os << "// pull inSyn values in a coalesced access" << std::endl;
-                os << model.getPrecision() << " linSyn = group.inSynInSyn" << i << "[" << popSubs["id"] << "];" << std::endl;
+                os << model.getPrecision() << " linSyn = group.inSynInSyn" << i << "[" << getBatchedVarIndex(batchSize, popSubs["id"]) << "];" << std::endl;
 
                 // If dendritic delay is required
                 if (sg->isDendriticDelayRequired()) {
                     // Get reference to dendritic delay buffer input for this timestep
                     os << model.getPrecision() << " &denDelayFront = ";
-                    os << "group.denDelayInSyn" << i << "[(*group.denDelayPtrInSyn" << i << " * group.numNeurons) + " << popSubs["id"] << "];" << std::endl;
+                    const std::string denDelayIndex = "(*group.denDelayPtrInSyn" + std::to_string(i) + " * group.numNeurons) + " + popSubs["id"];
+                    os << "group.denDelayInSyn" << i << "[" << getBatchedVarIndex(batchSize, denDelayIndex) << "];" << std::endl;
 
                     // Add delayed input from buffer into inSyn
                     os << "linSyn += denDelayFront;" << std::endl;
@@ -142,7 +194,7 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                             os << "const ";
                         }
                         os << v.type << " lps" << v.name;
-                        os << " = group." << v.name << "InSyn" << i << "[" << neuronSubs["id"] << "];" << std::endl;
+                        os << " = group." << v.name << "InSyn" << i << "[" << getBatchedVarIndex(batchSize, neuronSubs["id"]) << "];" << std::endl;
                     }
                 }
 
@@ -183,12 +235,12 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                 }
 
                 // Write back linSyn
-                os << "group.inSynInSyn"  << i << "[" << inSynSubs["id"] << "] = linSyn;" << std::endl;
+                os << "group.inSynInSyn"  << i << "[" << getBatchedVarIndex(batchSize, inSynSubs["id"]) << "] = linSyn;" << std::endl;
 
                 // Copy any non-readonly postsynaptic model variables back to global state variables dd_V etc
                 for (const auto &v : psm->getVars()) {
                     if(v.access == VarAccess::READ_WRITE) {
-                        os << "group." << v.name << "InSyn" << i << "[" << inSynSubs["id"] << "]" << " = lps" << v.name << ";" << std::endl;
+                        os << "group." << v.name << "InSyn" << i << "[" << getBatchedVarIndex(batchSize, inSynSubs["id"]) << "]" << " = lps" << v.name << ";" << std::endl;
                     }
                 }
             }
@@ -204,7 +256,7 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
 
                 // Read current source variables into registers
                 for(const auto &v : csm->getVars()) {
-                    os << v.type << " lcs" << v.name << " = " << "group." << v.name << "CS" << i <<"[" << popSubs["id"] << "];" << std::endl;
+                    os << v.type << " lcs" << v.name << " = " << "group." << v.name << "CS" << i <<"[" << getBatchedVarIndex(batchSize, popSubs["id"]) << "];" << std::endl;
                 }
 
                 Substitutions currSourceSubs(&popSubs);
@@ -222,7 +274,7 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                 // Write read/write variables back to global memory
                 for(const auto &v : csm->getVars()) {
                     if(v.access == VarAccess::READ_WRITE) {
-                        os << "group." << v.name << "CS" << i << "[" << currSourceSubs["id"] << "] = lcs" << v.name << ";" << std::endl;
+                        os << "group." << v.name << "CS" << i << "[" << getBatchedVarIndex(batchSize, currSourceSubs["id"]) << "] = lcs" << v.name << ";" << std::endl;
                     }
                 }
             }
@@ -313,6 +365,12 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                 }
                 {
                     CodeStream::Scope b(os);
+
+                    // If spike-triggered state is delayed, fill delay slots written since neuron's previous spike
+                    if(latestDelayedState) {
+                        genFillDelaySlotsSinceLatestSpike(os, ng, popSubs, batchSize);
+                    }
+
                     genEmitTrueSpike(os, ng, popSubs);
 
                     // add after-spike reset if provided
@@ -326,9 +384,9 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                     }
                 }
 
-                // Spike triggered variables don't need to be copied
-                // if delay isn't required as there's only one copy of them
-                if(ng.getArchetype().isDelayRequired()) {
+                // Otherwise, if spike triggered variables are delayed but always written to the delay slots, copy them into the next
+                // **NOTE** they don't need to be copied if delay isn't required as there's only one copy of them
+                if(ng.getArchetype().isDelayRequired() && !latestDelayedState) {
                     const auto outSynWithPreCode = ng.getArchetype().getOutSynWithPreCode();
                     const auto inSynWithPostCode = ng.getArchetype().getInSynWithPostCode();
 
@@ -347,7 +405,7 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
 
                         // If spike timing is required, copy spike time from register
                         if(ng.getArchetype().isSpikeTimeRequired()) {
-                            os << "group.sT[writeDelayOffset + " << popSubs["id"] << "] = lsT;" << std::endl;
+                            os << "group.sT[" << getBatchedVarIndex(batchSize, "writeDelayOffset + " + popSubs["id"]) << "] = lsT;" << std::endl;
                         }
 
                         // Copy presynaptic WUM variables between delay slots
@@ -355,20 +413,19 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                             const auto *sg = outSynWithPreCode[i];
                             if(sg->getDelaySteps() != NO_DELAY) {
                                 for(const auto &v : sg->getWUModel()->getPreVars()) {
-                                    os << "group." << v.name << "WUPre" << i << "[writeDelayOffset + " << popSubs["id"] <<  "] = ";
-                                    os << "group." << v.name << "WUPre" << i << "[readDelayOffset + " << popSubs["id"] << "];" << std::endl;
+                                    os << "group." << v.name << "WUPre" << i << "[" << getBatchedVarIndex(batchSize, "writeDelayOffset + " + popSubs["id"]) <<  "] = ";
+                                    os << "group." << v.name << "WUPre" << i << "[" << getBatchedVarIndex(batchSize, "readDelayOffset + " + popSubs["id"]) << "];" << std::endl;
                                 }
                             }
                         }
 
-
                         // Copy postsynaptic WUM variables between delay slots
                         for(size_t i = 0; i < inSynWithPostCode.size(); i++) {
                             const auto *sg = inSynWithPostCode[i];
                             if(sg->getBackPropDelaySteps() != NO_DELAY) {
                                 for(const auto &v : sg->getWUModel()->getPostVars()) {
-                                    os << "group." << v.name << "WUPost" << i << "[writeDelayOffset + " << popSubs["id"] <<  "] = ";
-                                    os << "group." << v.name << "WUPost" << i << "[readDelayOffset + " << popSubs["id"] << "];" << std::endl;
+                                    os << "group." << v.name << "WUPost" << i << "[" << getBatchedVarIndex(batchSize, "writeDelayOffset + " + popSubs["id"]) <<  "] = ";
+                                    os << "group." << v.name << "WUPost" << i << "[" << getBatchedVarIndex(batchSize, "readDelayOffset + " + popSubs["id"]) << "];" << std::endl;
                                 }
                             }
                         }
@@ -383,18 +440,16 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                 // back to global state variables dd_V etc  
                 const bool delayed = (ng.getArchetype().isVarQueueRequired(v.name) && ng.getArchetype().isDelayRequired());
                 if((v.access == VarAccess::READ_WRITE) || delayed) {
-                    os << "group." << v.name << "[";
-
-                    if (delayed) {
-                        os << "writeDelayOffset + ";
-                    }
-                    os << popSubs["id"] << "] = l" << v.name << ";" << std::endl;
+                    os << "group." << v.name << "[" << getBatchedVarIndex(batchSize, (delayed ? "writeDelayOffset + " : "") + popSubs["id"]) << "] = l" << v.name << ";" << std::endl;
                 }
             }
         },
         // WU var update handler
         [&backend, &modelMerged](CodeStream &os, const NeuronGroupMerged &ng, Substitutions &popSubs)
         {
+            const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+            const bool latestDelayedStateSupported = backend.isLatestDelayedStateSupported();
+
             // Loop through outgoing synaptic populations with presynaptic update code
             const auto outSynWithPreCode = ng.getArchetype().getOutSynWithPreCode();
             for(size_t i = 0; i < outSynWithPreCode.size(); i++) {
@@ -406,11 +461,14 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
 
                 // Fetch presynaptic variables from global memory
                 for(const auto &v : sg->getWUModel()->getPreVars()) {
-                    os << v.type << " l" << v.name << " = group." << v.name << "WUPre" << i << "[";
-                    if (sg->getDelaySteps() != NO_DELAY) {
-                        os << "readDelayOffset + ";
+                    // **NOTE** if variables are only written to the delay slots of neurons which spike, the latest values are stored separately
+                    if (latestDelayedStateSupported && sg->isWUPreVarLatestRequired()) {
+                        os << v.type << " l" << v.name << " = group." << v.name << "LatestWUPre" << i << "[" << getBatchedVarIndex(batchSize, preSubs["id"]) << "];" << std::endl;
+                    }
+                    else {
+                        const std::string offset = (sg->getDelaySteps() != NO_DELAY) ? "readDelayOffset + " : "";
+                        os << v.type << " l" << v.name << " = group." << v.name << "WUPre" << i << "[" << getBatchedVarIndex(batchSize, offset + preSubs["id"]) << "];" << std::endl;
                     }
-                    os << preSubs["id"] << "];" << std::endl;
                 }
 
                 preSubs.addParamValueSubstitution(sg->getWUModel()->getParamNames(), sg->getWUParams());
@@ -419,7 +477,8 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                 preSubs.addVarNameSubstitution(sg->getWUModel()->getPreVars(), "", "l");
 
                 const std::string offset = sg->getSrcNeuronGroup()->isDelayRequired() ? "readDelayOffset + " : "";
-                neuronSubstitutionsInSynapticCode(preSubs, sg->getSrcNeuronGroup(), offset, "", preSubs["id"], "_pre", "");
+                neuronSubstitutionsInSynapticCode(preSubs, sg->getSrcNeuronGroup(), offset, "", preSubs["id"], "_pre", "",
+                                                  "", "", 0, latestDelayedStateSupported, batchSize);
 
                 // Perform standard substitutions
                 std::string code = sg->getWUModel()->getPreSpikeCode();
@@ -434,11 +493,10 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                     // back to global state variables dd_V etc
                     const bool delayed = (sg->getDelaySteps() != NO_DELAY);
                     if((v.access == VarAccess::READ_WRITE) || delayed) {
-                        os << "group." << v.name << "WUPre" << i << "[";
-                        if (delayed) {
-                            os << "writeDelayOffset + ";
-                        }
-                        os << preSubs["id"] <<  "] = l" << v.name << ";" << std::endl;
+                        os << "group." << v.name << "WUPre" << i << "[" << getBatchedVarIndex(batchSize, (delayed ? "writeDelayOffset + " : "") + preSubs["id"]) <<  "] = l" << v.name << ";" << std::endl;
+                    }
+                    if(latestDelayedStateSupported && sg->isWUPreVarLatestRequired()) {
+                        os << "group." << v.name << "LatestWUPre" << i << "[" << getBatchedVarIndex(batchSize, preSubs["id"]) << "] = l" << v.name << ";" << std::endl;
                     }
                 }
             }
@@ -454,11 +512,14 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
 
                 // Fetch postsynaptic variables from global memory
                 for(const auto &v : sg->getWUModel()->getPostVars()) {
-                    os << v.type << " l" << v.name << " = group." << v.name << "WUPost" << i << "[";
-                    if (sg->getBackPropDelaySteps() != NO_DELAY) {
-                        os << "readDelayOffset + ";
+                    // **NOTE** if variables are only written to the delay slots of neurons which spike, the latest values are stored separately
+                    if (latestDelayedStateSupported && sg->isWUPostVarLatestRequired()) {
+                        os << v.type << " l" << v.name << " = group." << v.name << "LatestWUPost" << i << "[" << getBatchedVarIndex(batchSize, postSubs["id"]) << "];" << std::endl;
+                    }
+                    else {
+                        const std::string offset = (sg->getBackPropDelaySteps() != NO_DELAY) ? "readDelayOffset + " : "";
+                        os << v.type << " l" << v.name << " = group." << v.name << "WUPost" << i << "[" << getBatchedVarIndex(batchSize, offset + postSubs["id"]) << "];" << std::endl;
                     }
-                    os << postSubs["id"] << "];" << std::endl;
                 }
 
                 postSubs.addParamValueSubstitution(sg->getWUModel()->getParamNames(), sg->getWUParams());
@@ -467,7 +528,8 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                 postSubs.addVarNameSubstitution(sg->getWUModel()->getPostVars(), "", "l");
 
                 const std::string offset = sg->getTrgNeuronGroup()->isDelayRequired() ? "readDelayOffset + " : "";
-                neuronSubstitutionsInSynapticCode(postSubs, sg->getTrgNeuronGroup(), offset, "", postSubs["id"], "_post", "");
+                neuronSubstitutionsInSynapticCode(postSubs, sg->getTrgNeuronGroup(), offset, "", postSubs["id"], "_post", "",
+                                                  "", "", 0, latestDelayedStateSupported, batchSize);
 
                 // Perform standard substitutions
                 std::string code = sg->getWUModel()->getPostSpikeCode();
@@ -482,12 +544,20 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
                     // back to global state variables dd_V etc
                     const bool delayed = (sg->getBackPropDelaySteps() != NO_DELAY);
                     if((v.access == VarAccess::READ_WRITE) || delayed) {
-                        os << "group." << v.name << "WUPost" << i << "[";
-                        if (delayed) {
-                            os << "writeDelayOffset + ";
-                        }
-                        os << popSubs["id"] <<  "] = l" << v.name << ";" << std::endl;
+                        os << "group." << v.name << "WUPost" << i << "[" << getBatchedVarIndex(batchSize, (delayed ? "writeDelayOffset + " : "") + popSubs["id"]) <<  "] = l" << v.name << ";" << std::endl;
                     }
+                    if(latestDelayedStateSupported && sg->isWUPostVarLatestRequired()) {
+                        os << "group." << v.name << "LatestWUPost" << i << "[" << getBatchedVarIndex(batchSize, popSubs["id"]) << "] = l" << v.name << ";" << std::endl;
+                    }
+                }
+            }
+
+            // Finally, update timestep and time of latest spike
+            // **NOTE** this is done after presynaptic and postsynaptic updates so they read previous spike time
+            if(latestDelayedStateSupported && ng.getArchetype().isLatestSpikeTimestepRequired()) {
+                os << "group.spkTimestepLatest[" << getBatchedVarIndex(batchSize, popSubs["id"]) << "] = iT;" << std::endl;
+                if(ng.getArchetype().isSpikeTimeRequired()) {
+                    os << "group.sTLatest[" << getBatchedVarIndex(batchSize, popSubs["id"]) << "] = " << popSubs["t"] << ";" << std::endl;
                 }
             }
         },
@@ -496,4 +566,19 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedEGPMap &mer
         {
             genScalarEGPPush(os, mergedEGPs, "NeuronUpdate", backend);
         });
+    os << std::endl;
+
+    // Update neurons after pushing EGPs
+    // **NOTE** stepTimeN only pushes EGPs once before simulating and then calls updateNeuronsInternal every timestep
+    const ModelSpecInternal &model = modelMerged.getModel();
+    os << "void updateNeurons(" << model.getTimePrecision() << " t";
+    if(model.isRecordingInUse()) {
+        os << ", unsigned int recordingTimestep";
+    }
+    os << ")";
+    {
+        CodeStream::Scope b(os);
+        os << "pushNeuronUpdateEGPs();" << std::endl;
+        os << "updateNeuronsInternal(t" << (model.isRecordingInUse() ? ", recordingTimestep" : "") << ");" << std::endl;
+    }
 }
@@ -1,8 +1,11 @@
 #include "code_generator/generateRunner.h"
 
 // Standard C++ includes
+#include <algorithm>
 #include <sstream>
 #include <string>
+#include <tuple>
+#include <vector>
 
 // GeNN includes
 #include "gennUtils.h"
@@ -55,6 +58,496 @@ void genTypeRange(CodeGenerator::CodeStream &os, const std::string &precision, c
     os << std::endl;
 }
 //-------------------------------------------------------------------------
+unsigned int getNumRecordingWords(const NeuronGroupInternal &ng)
+{
+    // Spikes are recorded as one bit per neuron, packed into 32-bit words
+    return (ng.getNumNeurons() + 31) / 32;
+}
+//-------------------------------------------------------------------------
+// Sizes of each batch's copy of the arrays which are duplicated for each batch
+//-------------------------------------------------------------------------
+size_t getNumSpikeCounts(const NeuronGroupInternal &ng)
+{
+    return ng.isTrueSpikeRequired() ? ng.getNumDelaySlots() : 1;
+}
+//-------------------------------------------------------------------------
+size_t getNumSpikes(const NeuronGroupInternal &ng)
+{
+    return ng.isTrueSpikeRequired() ? ng.getNumNeurons() * ng.getNumDelaySlots() : ng.getNumNeurons();
+}
+//-------------------------------------------------------------------------
+size_t getNumDelayedNeurons(const NeuronGroupInternal &ng)
+{
+    return (size_t)ng.getNumNeurons() * ng.getNumDelaySlots();
+}
+//-------------------------------------------------------------------------
+size_t getNumNeuronVarElements(const NeuronGroupInternal &ng, bool queueRequired)
+{
+    return queueRequired ? getNumDelayedNeurons(ng) : ng.getNumNeurons();
+}
+//-------------------------------------------------------------------------
+size_t getNumWUVarElements(const CodeGenerator::BackendBase &backend, const SynapseGroupInternal &sg)
+{
+    // **NOTE** CSR connectivity is sized by the total number of synapses rather than a padded row stride
+    return (sg.getMatrixType() & SynapseMatrixConnectivity::CSR)
+        ? sg.getMaxNumSynapses()
+        : sg.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(sg);
+}
+//-------------------------------------------------------------------------
+size_t getNumWUPreVarElements(const SynapseGroupInternal &sg)
+{
+    return getNumNeuronVarElements(*sg.getSrcNeuronGroup(), sg.getDelaySteps() != NO_DELAY);
+}
+//-------------------------------------------------------------------------
+size_t getNumWUPostVarElements(const SynapseGroupInternal &sg)
+{
+    return getNumNeuronVarElements(*sg.getTrgNeuronGroup(), sg.getBackPropDelaySteps() != NO_DELAY);
+}
+//-------------------------------------------------------------------------
+template<typename G>
+void genMergedGroupProfiles(CodeGenerator::CodeStream &os, std::vector<std::string> &groupsJSON,
+                            const std::vector<G> &mergedGroups, const std::string &kernel)
+{
+    for(const auto &m : mergedGroups) {
+        // Build comma-separated list of group names and the equivalent JSON array contents
+        std::string groups;
+        std::string json;
+        for(const auto &g : m.getGroups()) {
+            groups += (groups.empty() ? "" : ",") + g.get().getName();
+            json += (json.empty() ? "\\\"" : ", \\\"") + g.get().getName() + "\\\"";
+        }
+        groupsJSON.push_back(json);
+
+        os << "    {\"" << kernel << "\", " << m.getIndex() << ", \"" << groups << "\", 0.0, 0, 0, 0}," << std::endl;
+    }
+}
+//-------------------------------------------------------------------------
+// StateFileEntries
+//-------------------------------------------------------------------------
+//! Host variables which saveState writes to state files and loadState reads back
+class StateFileEntries
+{
+public:
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    void addArray(const std::string &type, const std::string &name, size_t count)
+    {
+        m_Entries.emplace_back(name, name, std::to_string(count) + " * sizeof(" + type + ")");
+    }
+
+    void addScalar(const std::string &type, const std::string &name)
+    {
+        m_Entries.emplace_back(name, "&" + name, "sizeof(" + type + ")");
+    }
+
+    //! Generate array of StateFileEntry structs describing each variable
+    void gen(CodeGenerator::CodeStream &os) const
+    {
+        os << "const StateFileEntry entries[] = {" << std::endl;
+        for(const auto &e : m_Entries) {
+            os << "    {\"" << std::get<0>(e) << "\", " << std::get<1>(e) << ", " << std::get<2>(e) << "}," << std::endl;
+        }
+        os << "};" << std::endl;
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    //! Name, address and size of each entry
+    std::vector<std::tuple<std::string, std::string, std::string>> m_Entries;
+};
+//-------------------------------------------------------------------------
+void genStateFileHelpers(CodeGenerator::CodeStream &os)
+{
+    using namespace CodeGenerator;
+
+    os << "// Standard C includes" << std::endl;
+    os << "#include <cstdint>" << std::endl;
+    os << "#include <cstdio>" << std::endl;
+    os << "#include <cstring>" << std::endl;
+    os << std::endl;
+    os << "// Standard C++ includes" << std::endl;
+    os << "#include <stdexcept>" << std::endl;
+    os << "#include <string>" << std::endl;
+    os << "#include <vector>" << std::endl;
+    os << std::endl;
+    os << "// POSIX includes" << std::endl;
+    os << "#ifndef _WIN32" << std::endl;
+    os << "#include <fcntl.h>" << std::endl;
+    os << "#include <sys/mman.h>" << std::endl;
+    os << "#include <sys/stat.h>" << std::endl;
+    os << "#include <unistd.h>" << std::endl;
+    os << "#endif" << std::endl;
+    os << std::endl;
+
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// state files" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// State files consist of a 64 byte header, a directory with an entry per variable," << std::endl;
+    os << "// the names of all variables and then the data of each variable, aligned to 64 bytes" << std::endl;
+    os << "namespace" << std::endl;
+    {
+        CodeStream::Scope b(os);
+        os << "const uint32_t stateFileVersion = 1;" << std::endl;
+        os << "const uint64_t stateFileAlignment = 64;" << std::endl;
+        os << std::endl;
+
+        os << "struct StateFileEntry";
+        {
+            CodeStream::Scope b(os);
+            os << "const char *name;" << std::endl;
+            os << "void *data;" << std::endl;
+            os << "uint64_t size;" << std::endl;
+        }
+        os << ";" << std::endl << std::endl;
+
+        os << "struct StateFileHeader";
+        {
+            CodeStream::Scope b(os);
+            os << "char magic[8];" << std::endl;
+            os << "uint32_t version;" << std::endl;
+            os << "uint32_t numEntries;" << std::endl;
+            os << "uint64_t namesOffset;" << std::endl;
+            os << "uint64_t namesSize;" << std::endl;
+            os << "uint64_t reserved[4];" << std::endl;
+        }
+        os << ";" << std::endl << std::endl;
+
+        os << "struct StateFileDirectoryEntry";
+        {
+            CodeStream::Scope b(os);
+            os << "uint64_t nameOffset;" << std::endl;
+            os << "uint64_t nameLength;" << std::endl;
+            os << "uint64_t offset;" << std::endl;
+            os << "uint64_t size;" << std::endl;
+        }
+        os << ";" << std::endl << std::endl;
+
+        os << "uint64_t alignStateFileOffset(uint64_t offset)";
+        {
+            CodeStream::Scope b(os);
+            os << "return ((offset + stateFileAlignment - 1) / stateFileAlignment) * stateFileAlignment;" << std::endl;
+        }
+        os << std::endl;
+
+        os << "void writeStateFile(const char *path, const StateFileEntry *entries, uint32_t numEntries)";
+        {
+            CodeStream::Scope b(os);
+            os << "// Build directory and table of names" << std::endl;
+            os << "std::vector<StateFileDirectoryEntry> directory(numEntries);" << std::endl;
+            os << "std::string names;" << std::endl;
+            os << "for(uint32_t i = 0; i < numEntries; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "directory[i].nameOffset = names.size();" << std::endl;
+                os << "directory[i].nameLength = strlen(entries[i].name);" << std::endl;
+                os << "directory[i].size = entries[i].size;" << std::endl;
+                os << "names += entries[i].name;" << std::endl;
+            }
+            os << std::endl;
+            os << "StateFileHeader header = {};" << std::endl;
+            os << "memcpy(header.magic, \"GENNSTAT\", 8);" << std::endl;
+            os << "header.version = stateFileVersion;" << std::endl;
+            os << "header.numEntries = numEntries;" << std::endl;
+            os << "header.namesOffset = sizeof(StateFileHeader) + (sizeof(StateFileDirectoryEntry) * numEntries);" << std::endl;
+            os << "header.namesSize = names.size();" << std::endl;
+            os << std::endl;
+            os << "// Align data so it can be used directly from a mapped file" << std::endl;
+            os << "uint64_t offset = alignStateFileOffset(header.namesOffset + header.namesSize);" << std::endl;
+            os << "for(auto &d : directory)";
+            {
+                CodeStream::Scope b(os);
+                os << "d.offset = offset;" << std::endl;
+                os << "offset = alignStateFileOffset(offset + d.size);" << std::endl;
+            }
+            os << std::endl;
+            os << "FILE *file = fopen(path, \"wb\");" << std::endl;
+            os << "if(file == nullptr)";
+            {
+                CodeStream::Scope b(os);
+                os << "throw std::runtime_error(\"Unable to open state file '\" + std::string(path) + \"' for writing\");" << std::endl;
+            }
+            os << "bool success = (fwrite(&header, sizeof(StateFileHeader), 1, file) == 1);" << std::endl;
+            os << "success = success && (fwrite(directory.data(), sizeof(StateFileDirectoryEntry), numEntries, file) == numEntries);" << std::endl;
+            os << "success = success && (fwrite(names.data(), 1, names.size(), file) == names.size());" << std::endl;
+            os << "uint64_t position = header.namesOffset + header.namesSize;" << std::endl;
+            os << "const char padding[stateFileAlignment] = {};" << std::endl;
+            os << "for(uint32_t i = 0; success && i < numEntries; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "const uint64_t paddingSize = directory[i].offset - position;" << std::endl;
+                os << "success = (fwrite(padding, 1, paddingSize, file) == paddingSize);" << std::endl;
+                os << "success = success && (fwrite(entries[i].data, 1, entries[i].size, file) == entries[i].size);" << std::endl;
+                os << "position = directory[i].offset + directory[i].size;" << std::endl;
+            }
+            os << "const bool closed = (fclose(file) == 0);" << std::endl;
+            os << "if(!success || !closed)";
+            {
+                CodeStream::Scope b(os);
+                os << "throw std::runtime_error(\"Unable to write state file '\" + std::string(path) + \"'\");" << std::endl;
+            }
+        }
+        os << std::endl;
+
+        os << "struct StateFileMapping";
+        {
+            CodeStream::Scope b(os);
+            os << "std::string path;" << std::endl;
+            os << "char *data;" << std::endl;
+            os << "uint64_t size;" << std::endl;
+            os << "StateFileHeader header;" << std::endl;
+            os << "uint32_t nextEntry;" << std::endl;
+        }
+        os << ";" << std::endl << std::endl;
+
+        os << "void unmapStateFile(StateFileMapping &mapping)";
+        {
+            CodeStream::Scope b(os);
+            os << "if(mapping.data != nullptr)";
+            {
+                CodeStream::Scope b(os);
+                os << "#ifdef _WIN32" << std::endl;
+                os << "delete [] mapping.data;" << std::endl;
+                os << "#else" << std::endl;
+                os << "munmap(mapping.data, mapping.size);" << std::endl;
+                os << "#endif" << std::endl;
+                os << "mapping.data = nullptr;" << std::endl;
+            }
+        }
+        os << std::endl;
+
+        os << "// Map state file into memory and validate its header" << std::endl;
+        os << "// **NOTE** mappings are private so, if they are writable, modified pages are copied rather than written back" << std::endl;
+        os << "StateFileMapping mapStateFile(const char *path, bool writable)";
+        {
+            CodeStream::Scope b(os);
+            os << "StateFileMapping mapping = {path, nullptr, 0, {}, 0};" << std::endl;
+            os << "#ifdef _WIN32" << std::endl;
+            os << "FILE *file = fopen(path, \"rb\");" << std::endl;
+            os << "if(file == nullptr || _fseeki64(file, 0, SEEK_END) != 0)";
+            {
+                CodeStream::Scope b(os);
+                os << "if(file != nullptr)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "fclose(file);" << std::endl;
+                }
+                os << "throw std::runtime_error(\"Unable to open state file '\" + mapping.path + \"'\");" << std::endl;
+            }
+            os << "mapping.size = _ftelli64(file);" << std::endl;
+            os << "rewind(file);" << std::endl;
+            os << "mapping.data = new char[mapping.size];" << std::endl;
+            os << "const bool success = (fread(mapping.data, 1, mapping.size, file) == mapping.size);" << std::endl;
+            os << "fclose(file);" << std::endl;
+            os << "if(!success)";
+            {
+                CodeStream::Scope b(os);
+                os << "unmapStateFile(mapping);" << std::endl;
+                os << "throw std::runtime_error(\"Unable to read state file '\" + mapping.path + \"'\");" << std::endl;
+            }
+            os << "#else" << std::endl;
+            os << "const int fd = open(path, O_RDONLY);" << std::endl;
+            os << "struct stat fileStat;" << std::endl;
+            os << "if(fd == -1 || fstat(fd, &fileStat) != 0)";
+            {
+                CodeStream::Scope b(os);
+                os << "if(fd != -1)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "close(fd);" << std::endl;
+                }
+                os << "throw std::runtime_error(\"Unable to open state file '\" + mapping.path + \"'\");" << std::endl;
+            }
+            os << "mapping.size = fileStat.st_size;" << std::endl;
+            os << "void *data = (mapping.size == 0) ? MAP_FAILED : mmap(nullptr, mapping.size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_PRIVATE, fd, 0);" << std::endl;
+            os << "close(fd);" << std::endl;
+            os << "if(data == MAP_FAILED)";
+            {
+                CodeStream::Scope b(os);
+                os << "throw std::runtime_error(\"Unable to map state file '\" + mapping.path + \"'\");" << std::endl;
+            }
+            os << "mapping.data = static_cast<char*>(data);" << std::endl;
+            os << "#endif" << std::endl;
+            os << std::endl;
+            os << "// Validate header" << std::endl;
+            os << "std::string error;" << std::endl;
+            os << "if(mapping.size < sizeof(StateFileHeader))";
+            {
+                CodeStream::Scope b(os);
+                os << "error = \"State file '\" + mapping.path + \"' is truncated\";" << std::endl;
+            }
+            os << "else";
+            {
+                CodeStream::Scope b(os);
+                os << "memcpy(&mapping.header, mapping.data, sizeof(StateFileHeader));" << std::endl;
+                os << "const uint64_t directoryEnd = sizeof(StateFileHeader) + (sizeof(StateFileDirectoryEntry) * (uint64_t)mapping.header.numEntries);" << std::endl;
+                os << "if(memcmp(mapping.header.magic, \"GENNSTAT\", 8) != 0)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "error = \"'\" + mapping.path + \"' is not a GeNN state file\";" << std::endl;
+                }
+                os << "else if(mapping.header.version != stateFileVersion)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "error = \"State file '\" + mapping.path + \"' has unsupported version \" + std::to_string(mapping.header.version);" << std::endl;
+                }
+                os << "else if(directoryEnd > mapping.header.namesOffset || mapping.header.namesOffset > mapping.size" << std::endl;
+                os << "        || mapping.header.namesSize > (mapping.size - mapping.header.namesOffset))";
+                {
+                    CodeStream::Scope b(os);
+                    os << "error = \"State file '\" + mapping.path + \"' is truncated\";" << std::endl;
+                }
+            }
+            os << "if(!error.empty())";
+            {
+                CodeStream::Scope b(os);
+                os << "unmapStateFile(mapping);" << std::endl;
+                os << "throw std::runtime_error(error);" << std::endl;
+            }
+            os << "return mapping;" << std::endl;
+        }
+        os << std::endl;
+
+        os << "// Get pointer to the data of a named entry in a mapped state file, checking it has the expected size" << std::endl;
+        os << "void *getMappedStateFileEntry(StateFileMapping &mapping, const char *name, uint64_t size)";
+        {
+            CodeStream::Scope b(os);
+            os << "// Search directory from the entry after the last match" << std::endl;
+            os << "// **NOTE** entries are typically read in the order they were written so this is usually immediately successful" << std::endl;
+            os << "const char *names = mapping.data + mapping.header.namesOffset;" << std::endl;
+            os << "const uint64_t nameLength = strlen(name);" << std::endl;
+            os << "for(uint32_t j = 0; j < mapping.header.numEntries; j++)";
+            {
+                CodeStream::Scope b(os);
+                os << "const uint32_t k = (mapping.nextEntry + j) % mapping.header.numEntries;" << std::endl;
+                os << "StateFileDirectoryEntry directoryEntry;" << std::endl;
+                os << "memcpy(&directoryEntry, mapping.data + sizeof(StateFileHeader) + (sizeof(StateFileDirectoryEntry) * k), sizeof(StateFileDirectoryEntry));" << std::endl;
+                os << "if(directoryEntry.nameLength == nameLength && directoryEntry.nameOffset <= mapping.header.namesSize" << std::endl;
+                os << "   && nameLength <= (mapping.header.namesSize - directoryEntry.nameOffset)" << std::endl;
+                os << "   && memcmp(names + directoryEntry.nameOffset, name, nameLength) == 0)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "if(directoryEntry.size != size)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "throw std::runtime_error(\"Size of '\" + std::string(name) + \"' in state file '\" + mapping.path + \"' does not match model\");" << std::endl;
+                    }
+                    os << "if(directoryEntry.offset > mapping.size || directoryEntry.size > (mapping.size - directoryEntry.offset))";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "throw std::runtime_error(\"State file '\" + mapping.path + \"' is truncated\");" << std::endl;
+                    }
+                    os << "mapping.nextEntry = k + 1;" << std::endl;
+                    os << "return mapping.data + directoryEntry.offset;" << std::endl;
+                }
+            }
+            os << "throw std::runtime_error(\"State file '\" + mapping.path + \"' does not contain '\" + std::string(name) + \"'\");" << std::endl;
+        }
+        os << std::endl;
+
+        os << "void readStateFile(const char *path, const StateFileEntry *entries, uint32_t numEntries)";
+        {
+            CodeStream::Scope b(os);
+            os << "StateFileMapping mapping = mapStateFile(path, false);" << std::endl;
+            os << "#ifndef _WIN32" << std::endl;
+            os << "madvise(mapping.data, mapping.size, MADV_SEQUENTIAL);" << std::endl;
+            os << "#endif" << std::endl;
+            os << "try";
+            {
+                CodeStream::Scope b(os);
+                os << "for(uint32_t i = 0; i < numEntries; i++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "memcpy(entries[i].data, getMappedStateFileEntry(mapping, entries[i].name, entries[i].size), entries[i].size);" << std::endl;
+                }
+            }
+            os << "catch(...)";
+            {
+                CodeStream::Scope b(os);
+                os << "unmapStateFile(mapping);" << std::endl;
+                os << "throw;" << std::endl;
+            }
+            os << "unmapStateFile(mapping);" << std::endl;
+        }
+    }
+    os << std::endl;
+}
+//-------------------------------------------------------------------------
+void genCompressedSparseIndHelpers(CodeGenerator::CodeStream &os)
+{
+    using namespace CodeGenerator;
+
+    os << "// Standard C includes" << std::endl;
+    os << "#include <cstdint>" << std::endl;
+    os << std::endl;
+
+    os << "// Get number of bytes required to store delta between consecutive sparse indices" << std::endl;
+    os << "inline unsigned int getPackedIndDeltaWidth(uint32_t delta)";
+    {
+        CodeStream::Scope b(os);
+        os << "return (delta <= 0xFFu) ? 1 : ((delta <= 0xFFFFu) ? 2 : 4);" << std::endl;
+    }
+    os << std::endl;
+
+    os << "// Compress row of sparse indices, returning number of bytes required" << std::endl;
+    os << "// **NOTE** each index is stored as the (wrapping) difference from the previous one in the row, starting from zero." << std::endl;
+    os << "// Runs of up to 32 differences of the same width are packed into blocks, each with a header byte containing" << std::endl;
+    os << "// the width in the lower 3 bits and the number of differences minus one in the upper 5 bits." << std::endl;
+    os << "// If packed is nullptr, only the number of bytes is calculated" << std::endl;
+    os << "template<typename I>" << std::endl;
+    os << "uint64_t packSparseIndRow(const I *ind, unsigned int rowLength, uint8_t *packed)";
+    {
+        CodeStream::Scope b(os);
+        os << "uint64_t numBytes = 0;" << std::endl;
+        os << "uint32_t prev = 0;" << std::endl;
+        os << "unsigned int j = 0;" << std::endl;
+        os << "while(j < rowLength)";
+        {
+            CodeStream::Scope b(os);
+            os << "// Extend block while subsequent differences have the same width" << std::endl;
+            os << "const unsigned int width = getPackedIndDeltaWidth((uint32_t)ind[j] - prev);" << std::endl;
+            os << "unsigned int blockLength = 1;" << std::endl;
+            os << "while((j + blockLength) < rowLength && blockLength < 32" << std::endl;
+            os << "      && getPackedIndDeltaWidth((uint32_t)ind[j + blockLength] - (uint32_t)ind[j + blockLength - 1]) == width)";
+            {
+                CodeStream::Scope b(os);
+                os << "blockLength++;" << std::endl;
+            }
+            os << std::endl;
+            os << "if(packed != nullptr)";
+            {
+                CodeStream::Scope b(os);
+                os << "// Write header" << std::endl;
+                os << "*packed++ = (uint8_t)(((blockLength - 1) << 3) | width);" << std::endl;
+                os << std::endl;
+                os << "// Write little-endian differences" << std::endl;
+                os << "for(unsigned int k = 0; k < blockLength; k++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const uint32_t delta = (uint32_t)ind[j + k] - prev;" << std::endl;
+                    os << "for(unsigned int b = 0; b < width; b++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "*packed++ = (uint8_t)(delta >> (8 * b));" << std::endl;
+                    }
+                    os << "prev = (uint32_t)ind[j + k];" << std::endl;
+                }
+            }
+            os << "else";
+            {
+                CodeStream::Scope b(os);
+                os << "prev = (uint32_t)ind[j + blockLength - 1];" << std::endl;
+            }
+            os << "numBytes += 1 + (blockLength * width);" << std::endl;
+            os << "j += blockLength;" << std::endl;
+        }
+        os << "return numBytes;" << std::endl;
+    }
+    os << std::endl;
+}
+//-------------------------------------------------------------------------
 void genSpikeMacros(CodeGenerator::CodeStream &os, const NeuronGroupInternal &ng, bool trueSpike)
 {
     const bool delayRequired = trueSpike
@@ -175,10 +668,27 @@ void genMergedNeuronStruct(const CodeGenerator::BackendBase &backend, CodeGenera
         gen.addPointerField(timePrecision, "sT", backend.getArrayPrefix() + "sT");
     }
 
+    if(backend.isLatestDelayedStateSupported() && m.getArchetype().isLatestSpikeTimestepRequired()) {
+        gen.addPointerField("unsigned long long", "spkTimestepLatest", backend.getArrayPrefix() + "spkTimestepLatest");
+        if(m.getArchetype().isSpikeTimeRequired()) {
+            gen.addPointerField(timePrecision, "sTLatest", backend.getArrayPrefix() + "sTLatest");
+        }
+    }
+
     if(backend.isPopulationRNGRequired() && m.getArchetype().isSimRNGRequired()) {
         gen.addPointerField("curandState", "rng", backend.getArrayPrefix() + "rng");
     }
 
+    // Spike recording buffers are allocated at runtime so are handled like extra global parameters
+    if(!init && m.getArchetype().isSpikeRecordingEnabled()) {
+        gen.addField("uint32_t*", "recordSpk",
+                     [&backend](const NeuronGroupInternal &ng, size_t)
+                     {
+                         return backend.getArrayPrefix() + "recordSpk" + ng.getName();
+                     },
+                     CodeGenerator::MergedNeuronStructGenerator::FieldType::PointerEGP);
+    }
+
     // Add pointers to variables
     const NeuronModels::Base *nm = m.getArchetype().getNeuronModel();
     gen.addVars(nm->getVars(), backend.getArrayPrefix());
@@ -265,6 +775,13 @@ void genMergedNeuronStruct(const CodeGenerator::BackendBase &backend, CodeGenera
         for(const auto &v : sg->getWUModel()->getPostVars()) {
             gen.addSynPointerField(v.type, v.name + "WUPost", i, backend.getArrayPrefix() + v.name, sortedInSynWithPostCode);
         }
+
+        // If variables are only written to the delay slots of neurons which spike, add pointers to their latest values
+        if(backend.isLatestDelayedStateSupported() && sg->isWUPostVarLatestRequired()) {
+            for(const auto &v : sg->getWUModel()->getPostVars()) {
+                gen.addSynPointerField(v.type, v.name + "LatestWUPost", i, backend.getArrayPrefix() + v.name + "Latest", sortedInSynWithPostCode);
+            }
+        }
     }
 
     // Build vector of vectors containing each child group's incoming synapse groups
@@ -284,6 +801,13 @@ void genMergedNeuronStruct(const CodeGenerator::BackendBase &backend, CodeGenera
         for(const auto &v : sg->getWUModel()->getPreVars()) {
             gen.addSynPointerField(v.type, v.name + "WUPre", i, backend.getArrayPrefix() + v.name, sortedOutSynWithPreCode);
         }
+
+        // If variables are only written to the delay slots of neurons which spike, add pointers to their latest values
+        if(backend.isLatestDelayedStateSupported() && sg->isWUPreVarLatestRequired()) {
+            for(const auto &v : sg->getWUModel()->getPreVars()) {
+                gen.addSynPointerField(v.type, v.name + "LatestWUPre", i, backend.getArrayPrefix() + v.name + "Latest", sortedOutSynWithPreCode);
+            }
+        }
     }
 
     std::vector<std::vector<SynapseGroupInternal *>> eventThresholdSGs;
@@ -446,10 +970,38 @@ void genMergedSynapseStruct(const CodeGenerator::BackendBase &backend, CodeGener
             gen.addTrgPointerField(timePrecision, "sTPost", backend.getArrayPrefix() + "sT");
         }
 
+        // Add timesteps and times of latest spikes if they are used to read delayed spike times or variables
+        const bool preLatest = (backend.isLatestDelayedStateSupported() && m.getArchetype().getSrcNeuronGroup()->isLatestSpikeTimestepRequired());
+        if(preLatest && (wum->isPreSpikeTimeRequired() || m.getArchetype().isWUPreVarLatestRequired())) {
+            gen.addSrcPointerField("unsigned long long", "spkTimestepLatestPre", backend.getArrayPrefix() + "spkTimestepLatest");
+        }
+        if(preLatest && wum->isPreSpikeTimeRequired()) {
+            gen.addSrcPointerField(timePrecision, "sTLatestPre", backend.getArrayPrefix() + "sTLatest");
+        }
+        const bool postLatest = (backend.isLatestDelayedStateSupported() && m.getArchetype().getTrgNeuronGroup()->isLatestSpikeTimestepRequired());
+        if(postLatest && (wum->isPostSpikeTimeRequired() || m.getArchetype().isWUPostVarLatestRequired())) {
+            gen.addTrgPointerField("unsigned long long", "spkTimestepLatestPost", backend.getArrayPrefix() + "spkTimestepLatest");
+        }
+        if(postLatest && wum->isPostSpikeTimeRequired()) {
+            gen.addTrgPointerField(timePrecision, "sTLatestPost", backend.getArrayPrefix() + "sTLatest");
+        }
+
         // Add pre and postsynaptic variables to struct
         gen.addVars(wum->getPreVars(), backend.getArrayPrefix());
         gen.addVars(wum->getPostVars(), backend.getArrayPrefix());
 
+        // Add latest values of pre and postsynaptic variables only written to the delay slots of neurons which spike to struct
+        if(backend.isLatestDelayedStateSupported() && m.getArchetype().isWUPreVarLatestRequired()) {
+            for(const auto &v : wum->getPreVars()) {
+                gen.addPointerField(v.type, v.name + "Latest", backend.getArrayPrefix() + v.name + "Latest");
+            }
+        }
+        if(backend.isLatestDelayedStateSupported() && m.getArchetype().isWUPostVarLatestRequired()) {
+            for(const auto &v : wum->getPostVars()) {
+                gen.addPointerField(v.type, v.name + "Latest", backend.getArrayPrefix() + v.name + "Latest");
+            }
+        }
+
         // Add EGPs to struct
         gen.addEGPs(wum->getExtraGlobalParams());
     }
@@ -474,6 +1026,20 @@ void genMergedSynapseStruct(const CodeGenerator::BackendBase &backend, CodeGener
             gen.addPointerField("unsigned int", "synRemap", backend.getArrayPrefix() + "synRemap");
         }
     }
+    else if(m.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+        gen.addPointerField("unsigned int", "rowPtr", backend.getArrayPrefix() + "rowPtr");
+        gen.addPointerField(m.getArchetype().getSparseIndType(),"ind", backend.getArrayPrefix() + "ind");
+
+        // Add additional structure for postsynaptic access
+        // **NOTE** as CSR rows are unpadded, the presynaptic index can't be calculated from the row-major index so is also stored
+        if(backend.isPostsynapticRemapRequired() && !wum->getLearnPostCode().empty()
+           && (role == MergedSynapseStruct::PostsynapticUpdate || role == MergedSynapseStruct::SparseInit))
+        {
+            gen.addPointerField("unsigned int", "colLength", backend.getArrayPrefix() + "colLength");
+            gen.addPointerField("unsigned int", "remap", backend.getArrayPrefix() + "remap");
+            gen.addPointerField("unsigned int", "remapPre", backend.getArrayPrefix() + "remapPre");
+        }
+    }
     else if(m.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
         gen.addPointerField("uint32_t", "gp", backend.getArrayPrefix() + "gp");
     }
@@ -481,9 +1047,27 @@ void genMergedSynapseStruct(const CodeGenerator::BackendBase &backend, CodeGener
         gen.addEGPs(m.getArchetype().getConnectivityInitialiser().getSnippet()->getExtraGlobalParams());
     }
 
-    // Add pointers to var pointers to struct
+    // If sparse indices are compressed, add pointers to compressed rows for the presynaptic update and synapse dynamics
+    // **NOTE** compressed rows are allocated when they are built so are handled like extra global parameters
+    if(m.getArchetype().isCompressedSparseIndEnabled()
+       && (role == MergedSynapseStruct::PresynapticUpdate || role == MergedSynapseStruct::SynapseDynamics))
+    {
+        gen.addPointerField("uint64_t", "indPackedRowPtr", backend.getArrayPrefix() + "indPackedRowPtr");
+        gen.addField("uint8_t*", "indPacked",
+                     [&backend](const SynapseGroupInternal &sg, size_t)
+                     {
+                         return backend.getArrayPrefix() + "indPacked" + sg.getName();
+                     },
+                     CodeGenerator::MergedSynapseStructGenerator::FieldType::PointerEGP);
+    }
+
+    // Add pointers to var pointers to struct, using the types they are stored as in memory
     if(m.getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-        gen.addVars(wum->getVars(), backend.getArrayPrefix());
+        const auto wuVars = wum->getVars();
+        for(size_t i = 0; i < wuVars.size(); i++) {
+            gen.addPointerField(CodeGenerator::getVarStorageType(m.getArchetype().getWUVarStorage(i), wuVars[i].type), wuVars[i].name,
+                                backend.getArrayPrefix() + wuVars[i].name);
+        }
     }
 
     // Generate structure definitions and instantiation
@@ -619,7 +1203,7 @@ CodeGenerator::MemAlloc genVariable(const CodeGenerator::BackendBase &backend, C
                                     CodeGenerator::CodeStream &allocations, CodeGenerator::CodeStream &free,
                                     CodeGenerator::CodeStream &push, CodeGenerator::CodeStream &pull,
                                     const std::string &type, const std::string &name, VarLocation loc, bool autoInitialized, size_t count,
-                                    std::vector<std::string> &statePushPullFunction)
+                                    std::vector<std::string> &statePushPullFunction, StateFileEntries &stateFileEntries)
 {
     // Generate push and pull functions
     genVarPushPullScope(definitionsFunc, push, pull, loc, backend.isAutomaticCopyEnabled(), name, statePushPullFunction,
@@ -628,11 +1212,28 @@ CodeGenerator::MemAlloc genVariable(const CodeGenerator::BackendBase &backend, C
             backend.genVariablePushPull(push, pull, type, name, loc, autoInitialized, count);
         });
 
+    // Add variable to state files
+    stateFileEntries.addArray(type, name, count);
+
     // Generate variables
     return backend.genArray(definitionsVar, definitionsInternal, runner, allocations, free,
                             type, name, loc, count);
 }
 //-------------------------------------------------------------------------
+void genExternalConnectivityArray(const CodeGenerator::BackendBase &backend, CodeGenerator::CodeStream &definitionsVar,
+                                  CodeGenerator::CodeStream &definitionsInternal, CodeGenerator::CodeStream &runner,
+                                  CodeGenerator::CodeStream &allocations, const SynapseGroupInternal &sg,
+                                  const std::string &type, const std::string &name, VarLocation loc, size_t count)
+{
+    // Declare variable as normal
+    backend.genVariableDefinition(definitionsVar, definitionsInternal, type + "*", name + sg.getName(), loc);
+    backend.genVariableImplementation(runner, type + "*", name + sg.getName(), loc);
+
+    // But, rather than allocating it, point it into the mapped external connectivity file
+    allocations << name << sg.getName() << " = static_cast<" << type << "*>(getMappedStateFileEntry(externalConnectivity" << sg.getName();
+    allocations << ", \"" << name << "\", " << count << " * sizeof(" << type << ")));" << std::endl;
+}
+//-------------------------------------------------------------------------
 void genExtraGlobalParam(const CodeGenerator::BackendBase &backend, CodeGenerator::CodeStream &definitionsVar, CodeGenerator::CodeStream &definitionsFunc,
                          CodeGenerator::CodeStream &definitionsInternal, CodeGenerator::CodeStream &runner, CodeGenerator::CodeStream &extraGlobalParam,
                          CodeGenerator::MergedEGPMap &mergedEGPs, const std::string &type, const std::string &name, VarLocation loc)
@@ -730,12 +1331,18 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
     
     // write DT macro
     const ModelSpecInternal &model = modelMerged.getModel();
+
+    // Every state variable, spike buffer and postsynaptic input is duplicated for each batch
+    const size_t batchSize = model.getBatchSize();
     if (model.getTimePrecision() == "float") {
         definitions << "#define DT " << std::to_string(model.getDT()) << "f" << std::endl;
     } else {
         definitions << "#define DT " << std::to_string(model.getDT()) << std::endl;
     }
 
+    // Write number of batches
+    definitions << "#define BATCH_SIZE " << batchSize << std::endl;
+
     // Typedefine scalar type
     definitions << "typedef " << model.getPrecision() << " scalar;" << std::endl;
 
@@ -750,10 +1357,61 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
     definitions << "#define delB(x,i) x= ((x) & (~(0x80000000 >> (i)))) //!< Set the bit at the specified position i in x to 0" << std::endl;
     definitions << std::endl;
 
+    // If any synapse groups store variables in reduced-precision formats, write functions to convert them
+    // **NOTE** these are written to definitions so user code can use them to access variables
+    const bool anyReducedPrecisionStorage = std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+                                                        [](const ModelSpec::SynapseGroupValueType &s)
+                                                        {
+                                                            const size_t numVars = s.second.getWUModel()->getVars().size();
+                                                            for(size_t i = 0; i < numVars; i++) {
+                                                                if(s.second.getWUVarStorage(i) != VarStorage::NATIVE) {
+                                                                    return true;
+                                                                }
+                                                            }
+                                                            return false;
+                                                        });
+    if(anyReducedPrecisionStorage) {
+        genVarStorageConversions(definitions);
+    }
+
     // Write runner preamble
     runner << "#include \"definitionsInternal.h\"" << std::endl << std::endl;
     backend.genRunnerPreamble(runner, modelMerged);
 
+    // If backend supports checkpointing, write helpers for reading and writing state files
+    if(backend.isCheckpointSupported()) {
+        genStateFileHelpers(runner);
+    }
+
+    // If any synapse groups have compressed sparse indices, write helpers for compressing them
+    const bool anyCompressedSparseInd = std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+                                                    [](const ModelSpec::SynapseGroupValueType &s){ return s.second.isCompressedSparseIndEnabled(); });
+    if(anyCompressedSparseInd) {
+        genCompressedSparseIndHelpers(runner);
+    }
+
+    // If profiling is enabled, include headers used to write profiles to JSON
+    // **NOTE** recording also throws if buffers haven't been allocated before simulating
+    if(model.isProfilingEnabled() || model.isRecordingInUse()) {
+        runner << "// Standard C includes" << std::endl;
+        runner << "#include <cstdio>" << std::endl;
+        runner << std::endl;
+        runner << "// Standard C++ includes" << std::endl;
+        runner << "#include <stdexcept>" << std::endl;
+        runner << "#include <string>" << std::endl;
+        runner << std::endl;
+    }
+
+    // Declare mappings of external connectivity files
+    for(const auto &s : model.getSynapseGroups()) {
+        if(s.second.isExternalConnectivity()) {
+            if((s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) && batchSize > 1) {
+                throw std::runtime_error("Synapse group '" + s.first + "' has individual weights mapped from an external connectivity file which cannot be used with batched models");
+            }
+            runner << "StateFileMapping externalConnectivity" << s.first << " = {};" << std::endl;
+        }
+    }
+
     // Create codestreams to generate different sections of runner and definitions
     std::stringstream runnerVarDeclStream;
     std::stringstream runnerVarAllocStream;
@@ -799,11 +1457,26 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
     definitionsVar << "EXPORT_VAR " << model.getTimePrecision() << " t;" << std::endl;
     runnerVarDecl << "unsigned long long iT;" << std::endl;
     runnerVarDecl << model.getTimePrecision() << " t;" << std::endl;
+    StateFileEntries stateFileEntries;
+    stateFileEntries.addScalar("unsigned long long", "iT");
+    stateFileEntries.addScalar(model.getTimePrecision(), "t");
+
+    // If any populations record spikes, declare variable to hold size of recording buffers
+    if(model.isRecordingInUse()) {
+        definitionsVar << "EXPORT_VAR unsigned long long numRecordingTimesteps;" << std::endl;
+        runnerVarDecl << "unsigned long long numRecordingTimesteps = 0;" << std::endl;
+        runnerVarFree << "numRecordingTimesteps = 0;" << std::endl;
+    }
 
     // If backend requires a global RNG to simulate (or initialize) this model
     if(backend.isGlobalRNGRequired(modelMerged)) {
         mem += backend.genGlobalRNG(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree);
     }
+
+    // Add any backend-specific global state to state files
+    for(const auto &g : backend.getCheckpointGlobals(modelMerged)) {
+        stateFileEntries.addScalar(g.first, g.second);
+    }
     allVarStreams << std::endl;
 
     // Generate preamble for the final stage of time step
@@ -860,6 +1533,40 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
         allVarStreams << std::endl;
     }
 
+    // If profiling is enabled, define structure to hold wall time and event counts of each merged group
+    std::vector<std::string> profileGroupsJSON;
+    if(model.isProfilingEnabled()) {
+        allVarStreams << "// ------------------------------------------------------------------------" << std::endl;
+        allVarStreams << "// merged group profiles" << std::endl;
+        allVarStreams << "// ------------------------------------------------------------------------" << std::endl;
+
+        definitionsVar << "#define NUM_MERGED_GROUP_PROFILES " << modelMerged.getNumProfiles() << std::endl;
+        definitionsVar << "struct MergedGroupProfile";
+        {
+            CodeStream::Scope b(definitionsVar);
+            definitionsVar << "const char *kernel;              // neuronUpdate, synapseDynamics, presynapticUpdate or postsynapticUpdate" << std::endl;
+            definitionsVar << "unsigned int index;              // Index of merged group within kernel" << std::endl;
+            definitionsVar << "const char *groups;              // Comma-separated names of groups merged into this group" << std::endl;
+            definitionsVar << "double time;                     // Wall time spent updating merged group (s)" << std::endl;
+            definitionsVar << "uint64_t numSpikes;              // Spikes emitted by neuron groups" << std::endl;
+            definitionsVar << "uint64_t numSynapticEvents;      // Synapses processed by synapse groups" << std::endl;
+            definitionsVar << "uint64_t numRows;                // Rows (or columns) of synapses traversed by synapse groups" << std::endl;
+        }
+        definitionsVar << ";" << std::endl;
+
+        // **NOTE** array is always given at least one element so it's valid C++ even if the model has no merged groups
+        const size_t numProfileElements = std::max<size_t>(1, modelMerged.getNumProfiles());
+        definitionsInternalVar << "EXPORT_VAR MergedGroupProfile mergedGroupProfile[" << numProfileElements << "];" << std::endl;
+        runnerVarDecl << "unsigned long long profileStartTimestep = 0;" << std::endl;
+        runnerVarDecl << "MergedGroupProfile mergedGroupProfile[" << numProfileElements << "] = {" << std::endl;
+        genMergedGroupProfiles(runnerVarDecl, profileGroupsJSON, modelMerged.getMergedNeuronUpdateGroups(), "neuronUpdate");
+        genMergedGroupProfiles(runnerVarDecl, profileGroupsJSON, modelMerged.getMergedSynapseDynamicsGroups(), "synapseDynamics");
+        genMergedGroupProfiles(runnerVarDecl, profileGroupsJSON, modelMerged.getMergedPresynapticUpdateGroups(), "presynapticUpdate");
+        genMergedGroupProfiles(runnerVarDecl, profileGroupsJSON, modelMerged.getMergedPostsynapticUpdateGroups(), "postsynapticUpdate");
+        runnerVarDecl << "};" << std::endl;
+        allVarStreams << std::endl;
+    }
+
     definitionsInternal << "// ------------------------------------------------------------------------" << std::endl;
     definitionsInternal << "// merged group structures" << std::endl;
     definitionsInternal << "// ------------------------------------------------------------------------" << std::endl;
@@ -896,6 +1603,12 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
             gen.addPointerField("unsigned int", "rowLength", backend.getArrayPrefix() + "rowLength");
             gen.addPointerField(m.getArchetype().getSparseIndType(), "ind", backend.getArrayPrefix() + "ind");
         }
+        else if(m.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            gen.addField("unsigned int", "maxNumSynapses",
+                         [](const SynapseGroupInternal &sg, size_t){ return std::to_string(sg.getMaxNumSynapses()); });
+            gen.addPointerField("unsigned int", "rowPtr", backend.getArrayPrefix() + "rowPtr");
+            gen.addPointerField(m.getArchetype().getSparseIndType(), "ind", backend.getArrayPrefix() + "ind");
+        }
         else if(m.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
             gen.addPointerField("uint32_t", "gp", backend.getArrayPrefix() + "gp");
         }
@@ -992,12 +1705,23 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
         genSpikeMacros(definitionsVar, n.second, true);
 
         // True spike variables
-        const size_t numSpikeCounts = n.second.isTrueSpikeRequired() ? n.second.getNumDelaySlots() : 1;
-        const size_t numSpikes = n.second.isTrueSpikeRequired() ? n.second.getNumNeurons() * n.second.getNumDelaySlots() : n.second.getNumNeurons();
+        const size_t numSpikeCounts = getNumSpikeCounts(n.second) * batchSize;
+        const size_t numSpikes = getNumSpikes(n.second) * batchSize;
         mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                 "unsigned int", "glbSpkCnt" + n.first, n.second.getSpikeLocation(), numSpikeCounts);
         mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                 "unsigned int", "glbSpk" + n.first, n.second.getSpikeLocation(), numSpikes);
+        stateFileEntries.addArray("unsigned int", "glbSpkCnt" + n.first, numSpikeCounts);
+        stateFileEntries.addArray("unsigned int", "glbSpk" + n.first, numSpikes);
+
+        // If neuron group's spike-triggered state is only written to the delay slots of neurons which spike, timesteps of latest spikes are stored separately
+        const bool latestSpikeTimestepRequired = (backend.isLatestDelayedStateSupported() && n.second.isLatestSpikeTimestepRequired());
+        const size_t numLatestSpikes = n.second.getNumNeurons() * batchSize;
+        if(latestSpikeTimestepRequired) {
+            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                    "unsigned long long", "spkTimestepLatest" + n.first, n.second.getSpikeLocation(), numLatestSpikes);
+            stateFileEntries.addArray("unsigned long long", "spkTimestepLatest" + n.first, numLatestSpikes);
+        }
 
         // True spike push and pull functions
         genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeLocation(),
@@ -1008,6 +1732,10 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
                                             "unsigned int", "glbSpkCnt" + n.first, n.second.getSpikeLocation(), true, numSpikeCounts);
                 backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
                                             "unsigned int", "glbSpk" + n.first, n.second.getSpikeLocation(), true, numSpikes);
+                if(latestSpikeTimestepRequired) {
+                    backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
+                                                "unsigned long long", "spkTimestepLatest" + n.first, n.second.getSpikeLocation(), true, numLatestSpikes);
+                }
             });
 
         // Current true spike push and pull functions
@@ -1028,12 +1756,16 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
             genSpikeMacros(definitionsVar, n.second, false);
 
             // Spike-like event variables
+            const size_t numSpikeEventCounts = n.second.getNumDelaySlots() * batchSize;
+            const size_t numSpikeEvents = getNumDelayedNeurons(n.second) * batchSize;
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                     "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeEventLocation(),
-                                    n.second.getNumDelaySlots());
+                                    numSpikeEventCounts);
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                     "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeEventLocation(),
-                                    n.second.getNumNeurons() * n.second.getNumDelaySlots());
+                                    numSpikeEvents);
+            stateFileEntries.addArray("unsigned int", "glbSpkCntEvnt" + n.first, numSpikeEventCounts);
+            stateFileEntries.addArray("unsigned int", "glbSpkEvnt" + n.first, numSpikeEvents);
 
             // Spike-like event push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeEventLocation(),
@@ -1041,9 +1773,9 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
                 [&]()
                 {
                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
-                                                "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeLocation(), true, n.second.getNumDelaySlots());
+                                                "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeLocation(), true, numSpikeEventCounts);
                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
-                                                "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeLocation(), true, n.second.getNumNeurons() * n.second.getNumDelaySlots());
+                                                "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeLocation(), true, numSpikeEvents);
                 });
 
             // Current spike-like event push and pull functions
@@ -1062,13 +1794,16 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
         // If neuron group has axonal delays
         if (n.second.isDelayRequired()) {
             backend.genScalar(definitionsVar, definitionsInternalVar, runnerVarDecl, "unsigned int", "spkQuePtr" + n.first, VarLocation::HOST_DEVICE);
+            stateFileEntries.addScalar("unsigned int", "spkQuePtr" + n.first);
         }
 
         // If neuron group needs to record its spike times
         if (n.second.isSpikeTimeRequired()) {
+            const size_t numSpikeTimes = getNumDelayedNeurons(n.second) * batchSize;
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                     model.getTimePrecision(), "sT" + n.first, n.second.getSpikeTimeLocation(),
-                                    n.second.getNumNeurons() * n.second.getNumDelaySlots());
+                                    numSpikeTimes);
+            stateFileEntries.addArray(model.getTimePrecision(), "sT" + n.first, numSpikeTimes);
 
             // Generate push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeTimeLocation(),
@@ -1076,8 +1811,36 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
                 [&]()
                 {
                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, model.getTimePrecision(),
-                                                "sT" + n.first, n.second.getSpikeTimeLocation(), true, n.second.getNumNeurons() * n.second.getNumDelaySlots());
+                                                "sT" + n.first, n.second.getSpikeTimeLocation(), true, numSpikeTimes);
+                    if(latestSpikeTimestepRequired) {
+                        backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, model.getTimePrecision(),
+                                                    "sTLatest" + n.first, n.second.getSpikeTimeLocation(), true, numLatestSpikes);
+                    }
                 });
+
+            // If timesteps of latest spikes are stored separately from delay slots, so are their times
+            if(latestSpikeTimestepRequired) {
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        model.getTimePrecision(), "sTLatest" + n.first, n.second.getSpikeTimeLocation(),
+                                        numLatestSpikes);
+                stateFileEntries.addArray(model.getTimePrecision(), "sTLatest" + n.first, numLatestSpikes);
+            }
+        }
+
+        // If spike recording is enabled, define recording buffer
+        // **NOTE** this is allocated at runtime in allocateRecordingBuffers
+        if(n.second.isSpikeRecordingEnabled()) {
+            backend.genExtraGlobalParamDefinition(definitionsVar, "uint32_t*", "recordSpk" + n.first, n.second.getSpikeLocation());
+            backend.genExtraGlobalParamImplementation(runnerVarDecl, "uint32_t*", "recordSpk" + n.first, n.second.getSpikeLocation());
+            backend.genVariableFree(runnerVarFree, "recordSpk" + n.first, n.second.getSpikeLocation());
+
+            // Reset pointers so freed buffers can't be written to and allocateRecordingBuffers can be called again
+            if(backend.getArrayPrefix().empty() || (n.second.getSpikeLocation() & VarLocation::HOST)) {
+                runnerVarFree << "recordSpk" << n.first << " = nullptr;" << std::endl;
+            }
+            if(!backend.getArrayPrefix().empty() && (n.second.getSpikeLocation() & VarLocation::DEVICE)) {
+                runnerVarFree << backend.getArrayPrefix() << "recordSpk" << n.first << " = nullptr;" << std::endl;
+            }
         }
 
         // If neuron group needs per-neuron RNGs
@@ -1090,11 +1853,11 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
         const auto vars = neuronModel->getVars();
         std::vector<std::string> neuronStatePushPullFunctions;
         for(size_t i = 0; i < vars.size(); i++) {
-            const size_t count = n.second.isVarQueueRequired(i) ? n.second.getNumNeurons() * n.second.getNumDelaySlots() : n.second.getNumNeurons();
+            const size_t count = getNumNeuronVarElements(n.second, n.second.isVarQueueRequired(i)) * batchSize;
             const bool autoInitialized = !n.second.getVarInitialisers()[i].getSnippet()->getCode().empty();
             mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                runnerPushFunc, runnerPullFunc, vars[i].type, vars[i].name + n.first,
-                               n.second.getVarLocation(i), autoInitialized, count, neuronStatePushPullFunctions);
+                               n.second.getVarLocation(i), autoInitialized, count, neuronStatePushPullFunctions, stateFileEntries);
 
             // Current variable push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getVarLocation(i),
@@ -1111,8 +1874,9 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
                               "Current" + vars[i].name + n.first, vars[i].type + "*",
                 [&]()
                 {
+                    // **NOTE** each delay slot contains every batch's copy of each neuron's variable
                     if(delayRequired) {
-                        runnerGetterFunc << "return " << vars[i].name << n.first << " + (spkQuePtr" << n.first << " * " << n.second.getNumNeurons() << ");" << std::endl;
+                        runnerGetterFunc << "return " << vars[i].name << n.first << " + (spkQuePtr" << n.first << " * " << n.second.getNumNeurons() * batchSize << ");" << std::endl;
                     }
                     else {
                         runnerGetterFunc << "return " << vars[i].name << n.first << ";" << std::endl;
@@ -1143,7 +1907,7 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
                 const bool autoInitialized = !cs->getVarInitialisers()[i].getSnippet()->getCode().empty();
                 mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                    runnerPushFunc, runnerPullFunc, csVars[i].type, csVars[i].name + cs->getName(),
-                                   cs->getVarLocation(i), autoInitialized, n.second.getNumNeurons(), currentSourceStatePushPullFunctions);
+                                   cs->getVarLocation(i), autoInitialized, n.second.getNumNeurons() * batchSize, currentSourceStatePushPullFunctions, stateFileEntries);
             }
 
             // Add helper function to push and pull entire current source state
@@ -1171,20 +1935,27 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
 
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                     model.getPrecision(), "inSyn" + sg->getPSModelTargetName(), sg->getInSynLocation(),
-                                    sg->getTrgNeuronGroup()->getNumNeurons());
+                                    sg->getTrgNeuronGroup()->getNumNeurons() * batchSize);
+            stateFileEntries.addArray(model.getPrecision(), "inSyn" + sg->getPSModelTargetName(),
+                                      sg->getTrgNeuronGroup()->getNumNeurons() * batchSize);
 
             if (sg->isDendriticDelayRequired()) {
                 mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                         model.getPrecision(), "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayLocation(),
-                                        sg->getMaxDendriticDelayTimesteps() * sg->getTrgNeuronGroup()->getNumNeurons());
+                                        sg->getMaxDendriticDelayTimesteps() * sg->getTrgNeuronGroup()->getNumNeurons() * batchSize);
                 backend.genScalar(definitionsVar, definitionsInternalVar, runnerVarDecl, "unsigned int", "denDelayPtr" + sg->getPSModelTargetName(), VarLocation::HOST_DEVICE);
+                stateFileEntries.addArray(model.getPrecision(), "denDelay" + sg->getPSModelTargetName(),
+                                          sg->getMaxDendriticDelayTimesteps() * sg->getTrgNeuronGroup()->getNumNeurons() * batchSize);
+                stateFileEntries.addScalar("unsigned int", "denDelayPtr" + sg->getPSModelTargetName());
             }
 
             if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
                 for(const auto &v : sg->getPSModel()->getVars()) {
                     mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                             v.type, v.name + sg->getPSModelTargetName(), sg->getPSVarLocation(v.name),
-                                            sg->getTrgNeuronGroup()->getNumNeurons());
+                                            sg->getTrgNeuronGroup()->getNumNeurons() * batchSize);
+                    stateFileEntries.addArray(v.type, v.name + sg->getPSModelTargetName(),
+                                              sg->getTrgNeuronGroup()->getNumNeurons() * batchSize);
                 }
             }
         }
@@ -1202,7 +1973,7 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
             const size_t gpSize = ceilDivide((size_t)s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second), 32);
             mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                             runnerPushFunc, runnerPullFunc, "uint32_t", "gp" + s.second.getName(),
-                            s.second.getSparseConnectivityLocation(), autoInitialized, gpSize, connectivityPushPullFunctions);
+                            s.second.getSparseConnectivityLocation(), autoInitialized, gpSize, connectivityPushPullFunctions, stateFileEntries);
 
         }
         else if(s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
@@ -1213,13 +1984,35 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
             definitionsVar << "EXPORT_VAR const unsigned int maxRowLength" << s.second.getName() << ";" << std::endl;
             runnerVarDecl << "const unsigned int maxRowLength" << s.second.getName() << " = " << backend.getSynapticMatrixRowStride(s.second) << ";" << std::endl;
 
-            // Row lengths
-            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                    "unsigned int", "rowLength" + s.second.getName(), varLoc, s.second.getSrcNeuronGroup()->getNumNeurons());
+            // If connectivity is mapped from an external file
+            if(s.second.isExternalConnectivity()) {
+                // Define variable holding path, which can be overriden before calling allocateMem
+                definitionsVar << "EXPORT_VAR const char *externalConnectivityFile" << s.second.getName() << ";" << std::endl;
+                runnerVarDecl << "const char *externalConnectivityFile" << s.second.getName() << " = \"";
+                for(char c : s.second.getExternalConnectivityFile()) {
+                    runnerVarDecl << (((c == '\\') || (c == '"')) ? "\\" : "") << c;
+                }
+                runnerVarDecl << "\";" << std::endl;
+
+                // Map file and point row lengths and target indices into it
+                runnerVarAlloc << "externalConnectivity" << s.second.getName() << " = mapStateFile(externalConnectivityFile" << s.second.getName() << ", true);" << std::endl;
+                genExternalConnectivityArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, s.second,
+                                             "unsigned int", "rowLength", varLoc, s.second.getSrcNeuronGroup()->getNumNeurons());
+                genExternalConnectivityArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, s.second,
+                                             s.second.getSparseIndType(), "ind", varLoc, size);
+                runnerVarFree << "unmapStateFile(externalConnectivity" << s.second.getName() << ");" << std::endl;
+            }
+            else {
+                // Row lengths
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        "unsigned int", "rowLength" + s.second.getName(), varLoc, s.second.getSrcNeuronGroup()->getNumNeurons());
 
-            // Target indices
-            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                    s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc, size);
+                // Target indices
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc, size);
+            }
+            stateFileEntries.addArray("unsigned int", "rowLength" + s.second.getName(), s.second.getSrcNeuronGroup()->getNumNeurons());
+            stateFileEntries.addArray(s.second.getSparseIndType(), "ind" + s.second.getName(), size);
 
             // **TODO** remap is not always required
             if(backend.isSynRemapRequired() && !s.second.getWUModel()->getSynapseDynamicsCode().empty()) {
@@ -1227,6 +2020,7 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
                 // **THINK** this is over-allocating
                 mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                         "unsigned int", "synRemap" + s.second.getName(), VarLocation::DEVICE, size + 1);
+                stateFileEntries.addArray("unsigned int", "synRemap" + s.second.getName(), size + 1);
             }
 
             // **TODO** remap is not always required
@@ -1240,6 +2034,8 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
                 // Allocate remap
                 mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                         "unsigned int", "remap" + s.second.getName(), VarLocation::DEVICE, postSize);
+                stateFileEntries.addArray("unsigned int", "colLength" + s.second.getName(), s.second.getTrgNeuronGroup()->getNumNeurons());
+                stateFileEntries.addArray("unsigned int", "remap" + s.second.getName(), postSize);
             }
 
             // Generate push and pull functions for sparse connectivity
@@ -1256,6 +2052,69 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
                                                 "unsigned int", "ind" + s.second.getName(), s.second.getSparseConnectivityLocation(), autoInitialized, size);
                 });
         }
+        else if(s.second.getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            const VarLocation varLoc = s.second.getSparseConnectivityLocation();
+            const size_t size = s.second.getMaxNumSynapses();
+
+            // Maximum number of synapses constant
+            definitionsVar << "EXPORT_VAR const size_t maxNumSynapses" << s.second.getName() << ";" << std::endl;
+            runnerVarDecl << "const size_t maxNumSynapses" << s.second.getName() << " = " << size << ";" << std::endl;
+
+            // Row pointers i.e. index of first synapse in each row followed by total number of synapses
+            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                    "unsigned int", "rowPtr" + s.second.getName(), varLoc, s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
+            stateFileEntries.addArray("unsigned int", "rowPtr" + s.second.getName(), s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
+
+            // Target indices
+            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                    s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc, size);
+            stateFileEntries.addArray(s.second.getSparseIndType(), "ind" + s.second.getName(), size);
+
+            // **TODO** remap is not always required
+            if(backend.isPostsynapticRemapRequired() && !s.second.getWUModel()->getLearnPostCode().empty()) {
+                const size_t postSize = (size_t)s.second.getTrgNeuronGroup()->getNumNeurons() * (size_t)s.second.getMaxSourceConnections();
+
+                // Allocate column lengths
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        "unsigned int", "colLength" + s.second.getName(), VarLocation::DEVICE, s.second.getTrgNeuronGroup()->getNumNeurons());
+
+                // Allocate remap
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        "unsigned int", "remap" + s.second.getName(), VarLocation::DEVICE, postSize);
+
+                // Allocate presynaptic index of each remapped synapse
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        "unsigned int", "remapPre" + s.second.getName(), VarLocation::DEVICE, postSize);
+                stateFileEntries.addArray("unsigned int", "colLength" + s.second.getName(), s.second.getTrgNeuronGroup()->getNumNeurons());
+                stateFileEntries.addArray("unsigned int", "remap" + s.second.getName(), postSize);
+                stateFileEntries.addArray("unsigned int", "remapPre" + s.second.getName(), postSize);
+            }
+
+            // Generate push and pull functions for CSR connectivity
+            genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, s.second.getSparseConnectivityLocation(),
+                                backend.isAutomaticCopyEnabled(), s.second.getName() + "Connectivity", connectivityPushPullFunctions,
+                [&]()
+                {
+                    // Row pointers
+                    backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
+                                                "unsigned int", "rowPtr" + s.second.getName(), s.second.getSparseConnectivityLocation(), autoInitialized, s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
+
+                    // Target indices
+                    backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
+                                                s.second.getSparseIndType(), "ind" + s.second.getName(), s.second.getSparseConnectivityLocation(), autoInitialized, size);
+                });
+        }
+
+        // If sparse indices are compressed, allocate offset of each compressed row and define compressed rows
+        // **NOTE** the size of the compressed rows isn't known until they are built so they are allocated in compressSparseInd
+        if(s.second.isCompressedSparseIndEnabled()) {
+            mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                    "uint64_t", "indPackedRowPtr" + s.second.getName(), VarLocation::HOST_DEVICE, s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
+            backend.genExtraGlobalParamDefinition(definitionsInternalVar, "uint8_t*", "indPacked" + s.second.getName(), VarLocation::HOST_DEVICE);
+            backend.genExtraGlobalParamImplementation(runnerVarDecl, "uint8_t*", "indPacked" + s.second.getName(), VarLocation::HOST_DEVICE);
+            backend.genVariableFree(runnerVarFree, "indPacked" + s.second.getName(), VarLocation::HOST_DEVICE);
+            runnerVarFree << "indPacked" << s.second.getName() << " = nullptr;" << std::endl;
+        }
     }
     allVarStreams << std::endl;
 
@@ -1269,39 +2128,78 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
         // If weight update variables should be individual
         std::vector<std::string> synapseGroupStatePushPullFunctions;
         if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-            const size_t size = s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second);
+            const size_t size = getNumWUVarElements(backend, s.second) * batchSize;
 
             const auto wuVars = wu->getVars();
             for(size_t i = 0; i < wuVars.size(); i++) {
-                const bool autoInitialized = !s.second.getWUVarInitialisers()[i].getSnippet()->getCode().empty();
-                mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                runnerPushFunc, runnerPullFunc, wuVars[i].type, wuVars[i].name + s.second.getName(),
-                                s.second.getWUVarLocation(i), autoInitialized, size, synapseGroupStatePushPullFunctions);
+                // Variables are allocated, transferred and saved using the type they are stored as in memory
+                const std::string storageType = CodeGenerator::getVarStorageType(s.second.getWUVarStorage(i), wuVars[i].type);
+
+                // If variable is mapped from external connectivity file
+                if(s.second.isExternalConnectivity()) {
+                    const VarLocation loc = s.second.getWUVarLocation(i);
+                    genExternalConnectivityArray(backend, definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, s.second,
+                                                 storageType, wuVars[i].name, loc, size);
+                    stateFileEntries.addArray(storageType, wuVars[i].name + s.second.getName(), size);
+
+                    // Generate push and pull functions, treating variable as initialised
+                    genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, loc, backend.isAutomaticCopyEnabled(),
+                                        wuVars[i].name + s.second.getName(), synapseGroupStatePushPullFunctions,
+                        [&]()
+                        {
+                            backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, storageType, wuVars[i].name + s.second.getName(),
+                                                        loc, true, size);
+                        });
+                }
+                else {
+                    const bool autoInitialized = !s.second.getWUVarInitialisers()[i].getSnippet()->getCode().empty();
+                    mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                       runnerPushFunc, runnerPullFunc, storageType, wuVars[i].name + s.second.getName(),
+                                       s.second.getWUVarLocation(i), autoInitialized, size, synapseGroupStatePushPullFunctions, stateFileEntries);
+                }
             }
         }
 
         // Presynaptic W.U.M. variables
-        const size_t preSize = (s.second.getDelaySteps() == NO_DELAY)
-                ? s.second.getSrcNeuronGroup()->getNumNeurons()
-                : s.second.getSrcNeuronGroup()->getNumNeurons() * s.second.getSrcNeuronGroup()->getNumDelaySlots();
+        const size_t preSize = getNumWUPreVarElements(s.second) * batchSize;
         const auto wuPreVars = wu->getPreVars();
         for(size_t i = 0; i < wuPreVars.size(); i++) {
             const bool autoInitialized = !s.second.getWUPreVarInitialisers()[i].getSnippet()->getCode().empty();
             mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                             runnerPushFunc, runnerPullFunc, wuPreVars[i].type, wuPreVars[i].name + s.second.getName(),
-                            s.second.getWUPreVarLocation(i), autoInitialized, preSize, synapseGroupStatePushPullFunctions);
+                            s.second.getWUPreVarLocation(i), autoInitialized, preSize, synapseGroupStatePushPullFunctions, stateFileEntries);
+        }
+
+        // If presynaptic W.U.M. variables are only written to the delay slots of neurons which spike, their latest values are stored separately
+        if(backend.isLatestDelayedStateSupported() && s.second.isWUPreVarLatestRequired()) {
+            const size_t latestPreSize = s.second.getSrcNeuronGroup()->getNumNeurons() * batchSize;
+            for(size_t i = 0; i < wuPreVars.size(); i++) {
+                const bool autoInitialized = !s.second.getWUPreVarInitialisers()[i].getSnippet()->getCode().empty();
+                mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                   runnerPushFunc, runnerPullFunc, wuPreVars[i].type, wuPreVars[i].name + "Latest" + s.second.getName(),
+                                   s.second.getWUPreVarLocation(i), autoInitialized, latestPreSize, synapseGroupStatePushPullFunctions, stateFileEntries);
+            }
         }
 
         // Postsynaptic W.U.M. variables
-        const size_t postSize = (s.second.getBackPropDelaySteps() == NO_DELAY)
-                ? s.second.getTrgNeuronGroup()->getNumNeurons()
-                : s.second.getTrgNeuronGroup()->getNumNeurons() * s.second.getTrgNeuronGroup()->getNumDelaySlots();
+        const size_t postSize = getNumWUPostVarElements(s.second) * batchSize;
         const auto wuPostVars = wu->getPostVars();
         for(size_t i = 0; i < wuPostVars.size(); i++) {
             const bool autoInitialized = !s.second.getWUPostVarInitialisers()[i].getSnippet()->getCode().empty();
             mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                             runnerPushFunc, runnerPullFunc, wuPostVars[i].type, wuPostVars[i].name + s.second.getName(),
-                            s.second.getWUPostVarLocation(i), autoInitialized, postSize, synapseGroupStatePushPullFunctions);
+                            s.second.getWUPostVarLocation(i), autoInitialized, postSize, synapseGroupStatePushPullFunctions, stateFileEntries);
+        }
+
+        // If postsynaptic W.U.M. variables are only written to the delay slots of neurons which spike, their latest values are stored separately
+        if(backend.isLatestDelayedStateSupported() && s.second.isWUPostVarLatestRequired()) {
+            const size_t latestPostSize = s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize;
+            for(size_t i = 0; i < wuPostVars.size(); i++) {
+                const bool autoInitialized = !s.second.getWUPostVarInitialisers()[i].getSnippet()->getCode().empty();
+                mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                   runnerPushFunc, runnerPullFunc, wuPostVars[i].type, wuPostVars[i].name + "Latest" + s.second.getName(),
+                                   s.second.getWUPostVarLocation(i), autoInitialized, latestPostSize, synapseGroupStatePushPullFunctions, stateFileEntries);
+            }
         }
 
         // If this synapse group's postsynaptic models hasn't been merged (which makes pulling them somewhat ambiguous)
@@ -1313,7 +2211,7 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
                 [&]()
                 {
                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, model.getPrecision(), "inSyn" + s.second.getName(), s.second.getInSynLocation(),
-                                                true, s.second.getTrgNeuronGroup()->getNumNeurons());
+                                                true, s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize);
                 });
 
             // If this synapse group has individual postsynaptic model variables
@@ -1326,7 +2224,7 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
                         [&]()
                         {
                             backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, psmVars[i].type, psmVars[i].name + s.second.getName(), s.second.getPSVarLocation(i),
-                                                        autoInitialized, s.second.getTrgNeuronGroup()->getNumNeurons());
+                                                        autoInitialized, s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize);
                         });
                 }
             }
@@ -1465,6 +2363,52 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
         runner << std::endl;
     }
 
+    if(model.isRecordingInUse()) {
+        // ---------------------------------------------------------------------
+        // Function for allocating recording buffers
+        runner << "void allocateRecordingBuffers(unsigned int timesteps)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "numRecordingTimesteps = timesteps;" << std::endl;
+            for(const auto &n : model.getNeuronGroups()) {
+                if(n.second.isSpikeRecordingEnabled()) {
+                    CodeStream::Scope b(runner);
+                    const std::string name = "recordSpk" + n.first;
+
+                    // Free any previously allocated buffer and allocate one word per 32 neurons per timestep
+                    backend.genVariableFree(runner, name, n.second.getSpikeLocation());
+                    runner << "const unsigned int count = " << getNumRecordingWords(n.second) * batchSize << " * timesteps;" << std::endl;
+                    backend.genExtraGlobalParamAllocation(runner, "uint32_t*", name, n.second.getSpikeLocation());
+
+                    // Update pointers to buffer in merged structures
+                    for(const auto &v : mergedEGPs.at(backend.getArrayPrefix() + name)) {
+                        const std::string pushFuncName = "pushMerged" + v.first + std::to_string(v.second.mergedGroupIndex) + v.second.fieldName + std::to_string(v.second.groupIndex) + "ToDevice();";
+                        definitionsInternalFunc << "EXPORT_FUNC void " << pushFuncName << std::endl;
+                        runner << pushFuncName << std::endl;
+                    }
+                }
+            }
+        }
+        runner << std::endl;
+
+        // ---------------------------------------------------------------------
+        // Function for copying recording buffers from device
+        runner << "void pullRecordingBuffersFromDevice()";
+        {
+            CodeStream::Scope b(runner);
+            if(!backend.isAutomaticCopyEnabled()) {
+                for(const auto &n : model.getNeuronGroups()) {
+                    if(n.second.isSpikeRecordingEnabled() && canPushPullVar(n.second.getSpikeLocation())) {
+                        CodeStream::Scope b(runner);
+                        runner << "const unsigned int count = " << getNumRecordingWords(n.second) * batchSize << " * numRecordingTimesteps;" << std::endl;
+                        backend.genExtraGlobalParamPull(runner, "uint32_t*", "recordSpk" + n.first, n.second.getSpikeLocation());
+                    }
+                }
+            }
+        }
+        runner << std::endl;
+    }
+
     // ---------------------------------------------------------------------
     // Function for setting the CUDA device and the host's global variables.
     // Also estimates memory usage on device ...
@@ -1495,44 +2439,264 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
     }
     runner << std::endl;
 
+    // Generates code to check recording buffers have been allocated before simulating
+    // **NOTE** otherwise the recording timestep would be calculated modulo zero and spikes written through null pointers
+    const auto genRecordingBufferCheck =
+        [&model](CodeStream &os)
+        {
+            if(model.isRecordingInUse()) {
+                os << "if(numRecordingTimesteps == 0)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "throw std::runtime_error(\"Spike recording buffers have not been allocated - call allocateRecordingBuffers before simulating\");" << std::endl;
+                }
+            }
+        };
+
+    // Generates code to simulate a single timestep
+    // **NOTE** if internal is set, EGPs are assumed to have already been pushed and recordingTimestep to be maintained by the caller
+    const auto genStepTimeBody =
+        [&model, &runnerStepTimeFinaliseStream](CodeStream &os, bool internal)
+        {
+            const std::string suffix = internal ? "Internal" : "";
+
+            // Update synaptic state
+            os << "updateSynapses" << suffix << "(t);" << std::endl;
+
+            // Generate code to advance host-side spike queues
+            for(const auto &n : model.getNeuronGroups()) {
+                if (n.second.isDelayRequired()) {
+                    os << "spkQuePtr" << n.first << " = (spkQuePtr" << n.first << " + 1) % " << n.second.getNumDelaySlots() << ";" << std::endl;
+                }
+            }
+
+            // Update neuronal state, passing the slot in the recording buffers to write into
+            if(model.isRecordingInUse()) {
+                if(!internal) {
+                    os << "const unsigned int recordingTimestep = (unsigned int)(iT % numRecordingTimesteps);" << std::endl;
+                }
+                os << "updateNeurons" << suffix << "(t, recordingTimestep);" << std::endl;
+            }
+            else {
+                os << "updateNeurons" << suffix << "(t);" << std::endl;
+            }
+
+            // Generate code to advance host side dendritic delay buffers
+            for(const auto &n : model.getNeuronGroups()) {
+                // Loop through incoming synaptic populations
+                for(const auto &m : n.second.getMergedInSyn()) {
+                    const auto *sg = m.first;
+                    if(sg->isDendriticDelayRequired()) {
+                        os << "denDelayPtr" << sg->getPSModelTargetName() << " = (denDelayPtr" << sg->getPSModelTargetName() << " + 1) % " << sg->getMaxDendriticDelayTimesteps() << ";" << std::endl;
+                    }
+                }
+            }
+            // Advance time
+            os << "iT++;" << std::endl;
+            os << "t = iT*DT;" << std::endl;
+
+            // Write step time finalize logic to runner
+            os << runnerStepTimeFinaliseStream.str();
+        };
+
     // ------------------------------------------------------------------------
-    // Function to free all global memory structures
+    // Function to simulate a single timestep
     runner << "void stepTime()";
     {
         CodeStream::Scope b(runner);
+        genRecordingBufferCheck(runner);
+        genStepTimeBody(runner, false);
+    }
+    runner << std::endl;
+
+    // ------------------------------------------------------------------------
+    // Function to simulate n timesteps, calling callback every callbackInterval timesteps
+    runner << "void stepTimeN(unsigned int n, unsigned int callbackInterval, StepTimeCallback callback, void *context)";
+    {
+        CodeStream::Scope b(runner);
+        genRecordingBufferCheck(runner);
+
+        // Push scalar EGPs once rather than every timestep
+        runner << "pushSynapseUpdateEGPs();" << std::endl;
+        runner << "pushNeuronUpdateEGPs();" << std::endl;
+
+        // Count slot in recording buffers rather than using modulus every timestep
+        if(model.isRecordingInUse()) {
+            runner << "unsigned int recordingTimestep = (unsigned int)(iT % numRecordingTimesteps);" << std::endl;
+        }
+
+        // Hoist callback test out of loop and count down to next callback rather than using modulus
+        runner << "const bool callbackRequired = (callback != nullptr && callbackInterval > 0);" << std::endl;
+        runner << "unsigned int stepsToCallback = callbackInterval;" << std::endl;
+        runner << "for(unsigned int i = 0; i < n; i++)";
+        {
+            CodeStream::Scope b(runner);
+            genStepTimeBody(runner, true);
+
+            if(model.isRecordingInUse()) {
+                runner << "if(++recordingTimestep == numRecordingTimesteps)";
+                {
+                    CodeStream::Scope b(runner);
+                    runner << "recordingTimestep = 0;" << std::endl;
+                }
+            }
+
+            runner << "if(callbackRequired && --stepsToCallback == 0)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "callback(context);" << std::endl;
+                runner << "stepsToCallback = callbackInterval;" << std::endl;
+
+                // Callback may have changed scalar EGPs so push them again
+                runner << "pushSynapseUpdateEGPs();" << std::endl;
+                runner << "pushNeuronUpdateEGPs();" << std::endl;
+            }
+        }
+    }
+    runner << std::endl;
+
+    // ------------------------------------------------------------------------
+    // Functions to build compressed copies of sparse indices
+    for(const auto &s : model.getSynapseGroups()) {
+        if(s.second.isCompressedSparseIndEnabled()) {
+            const unsigned int numSrcNeurons = s.second.getSrcNeuronGroup()->getNumNeurons();
+            const bool csr = (s.second.getMatrixType() & SynapseMatrixConnectivity::CSR);
+            const std::string rowStart = csr ? ("rowPtr" + s.first + "[i]") : ("((size_t)i * maxRowLength" + s.first + ")");
+            const std::string rowLength = csr ? ("(rowPtr" + s.first + "[i + 1] - rowPtr" + s.first + "[i])") : ("rowLength" + s.first + "[i]");
+
+            runner << "void compressSparseInd" << s.first << "()";
+            {
+                CodeStream::Scope b(runner);
+
+                runner << "// Calculate offset of each compressed row" << std::endl;
+                runner << "indPackedRowPtr" << s.first << "[0] = 0;" << std::endl;
+                runner << "for(unsigned int i = 0; i < " << numSrcNeurons << "; i++)";
+                {
+                    CodeStream::Scope b(runner);
+                    runner << "indPackedRowPtr" << s.first << "[i + 1] = indPackedRowPtr" << s.first << "[i] + packSparseIndRow(&ind" << s.first << "[" << rowStart << "], " << rowLength << ", nullptr);" << std::endl;
+                }
+                runner << std::endl;
+
+                runner << "// Reallocate compressed rows" << std::endl;
+                backend.genVariableFree(runner, "indPacked" + s.first, VarLocation::HOST_DEVICE);
+                runner << "const size_t count = indPackedRowPtr" << s.first << "[" << numSrcNeurons << "];" << std::endl;
+                backend.genExtraGlobalParamAllocation(runner, "uint8_t*", "indPacked" + s.first, VarLocation::HOST_DEVICE);
+                runner << std::endl;
 
-        // Update synaptic state
-        runner << "updateSynapses(t);" << std::endl;
+                runner << "// Compress rows" << std::endl;
+                runner << "for(unsigned int i = 0; i < " << numSrcNeurons << "; i++)";
+                {
+                    CodeStream::Scope b(runner);
+                    runner << "packSparseIndRow(&ind" << s.first << "[" << rowStart << "], " << rowLength << ", &indPacked" << s.first << "[indPackedRowPtr" << s.first << "[i]]);" << std::endl;
+                }
 
-        // Generate code to advance host-side spike queues
-   
-        for(const auto &n : model.getNeuronGroups()) {
-            if (n.second.isDelayRequired()) {
-                runner << "spkQuePtr" << n.first << " = (spkQuePtr" << n.first << " + 1) % " << n.second.getNumDelaySlots() << ";" << std::endl;
+                // Update pointers to compressed rows in merged structures
+                const auto mergedDestinations = mergedEGPs.find(backend.getArrayPrefix() + "indPacked" + s.first);
+                if(mergedDestinations != mergedEGPs.cend()) {
+                    for(const auto &v : mergedDestinations->second) {
+                        const std::string pushFuncName = "pushMerged" + v.first + std::to_string(v.second.mergedGroupIndex) + v.second.fieldName + std::to_string(v.second.groupIndex) + "ToDevice();";
+                        definitionsInternalFunc << "EXPORT_FUNC void " << pushFuncName << std::endl;
+                        runner << pushFuncName << std::endl;
+                    }
+                }
             }
+            runner << std::endl;
+        }
+    }
+
+    if(backend.isCheckpointSupported()) {
+        // ------------------------------------------------------------------------
+        // Function to write complete simulation state to file
+        runner << "void saveState(const char *path)";
+        {
+            CodeStream::Scope b(runner);
+            stateFileEntries.gen(runner);
+            runner << "writeStateFile(path, entries, sizeof(entries) / sizeof(StateFileEntry));" << std::endl;
         }
+        runner << std::endl;
 
-        // Update neuronal state
-        runner << "updateNeurons(t);" << std::endl;
+        // ------------------------------------------------------------------------
+        // Function to restore complete simulation state from file into memory allocated by allocateMem
+        runner << "void loadState(const char *path)";
+        {
+            CodeStream::Scope b(runner);
+            stateFileEntries.gen(runner);
+            runner << "readStateFile(path, entries, sizeof(entries) / sizeof(StateFileEntry));" << std::endl;
 
-        // Generate code to advance host side dendritic delay buffers
-        for(const auto &n : model.getNeuronGroups()) {
-            // Loop through incoming synaptic populations
-            for(const auto &m : n.second.getMergedInSyn()) {
-                const auto *sg = m.first;
-                if(sg->isDendriticDelayRequired()) {
-                    runner << "denDelayPtr" << sg->getPSModelTargetName() << " = (denDelayPtr" << sg->getPSModelTargetName() << " + 1) % " << sg->getMaxDendriticDelayTimesteps() << ";" << std::endl;
+            // Rebuild compressed copies of any sparse indices which have been restored
+            for(const auto &s : model.getSynapseGroups()) {
+                if(s.second.isCompressedSparseIndEnabled()) {
+                    runner << "compressSparseInd" << s.first << "();" << std::endl;
                 }
             }
         }
-        // Advance time
-        runner << "iT++;" << std::endl;
-        runner << "t = iT*DT;" << std::endl;
+        runner << std::endl;
+    }
+
+    if(model.isProfilingEnabled()) {
+        // ------------------------------------------------------------------------
+        // Function to get profiles of all merged groups
+        runner << "const MergedGroupProfile *getProfile()";
+        {
+            CodeStream::Scope b(runner);
+            runner << "return mergedGroupProfile;" << std::endl;
+        }
+        runner << std::endl;
 
-        // Write step time finalize logic to runner
-        runner << runnerStepTimeFinaliseStream.str();
+        // ------------------------------------------------------------------------
+        // Function to zero wall time and event counts of all merged groups
+        runner << "void resetProfile()";
+        {
+            CodeStream::Scope b(runner);
+            runner << "profileStartTimestep = iT;" << std::endl;
+            runner << "for(unsigned int i = 0; i < NUM_MERGED_GROUP_PROFILES; i++)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "mergedGroupProfile[i].time = 0.0;" << std::endl;
+                runner << "mergedGroupProfile[i].numSpikes = 0;" << std::endl;
+                runner << "mergedGroupProfile[i].numSynapticEvents = 0;" << std::endl;
+                runner << "mergedGroupProfile[i].numRows = 0;" << std::endl;
+            }
+        }
+        runner << std::endl;
+
+        // ------------------------------------------------------------------------
+        // Function to write profiles of all merged groups to JSON file
+        runner << "void writeProfileJSON(const char *path)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "const char *const groups[] = {" << std::endl;
+            for(const auto &g : profileGroupsJSON) {
+                runner << "    \"" << g << "\"," << std::endl;
+            }
+            runner << "    nullptr};" << std::endl;
+            runner << "FILE *file = fopen(path, \"w\");" << std::endl;
+            runner << "if(file == nullptr)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(\"Unable to open '\" + std::string(path) + \"' for writing\");" << std::endl;
+            }
+            runner << "fprintf(file, \"{\\n  \\\"timesteps\\\": %llu,\\n  \\\"dt\\\": %g,\\n  \\\"groups\\\": [\", iT - profileStartTimestep, (double)DT);" << std::endl;
+            runner << "for(unsigned int i = 0; i < NUM_MERGED_GROUP_PROFILES; i++)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "const MergedGroupProfile &p = mergedGroupProfile[i];" << std::endl;
+                runner << "const double synapticEventsPerSecond = (p.time > 0.0) ? ((double)p.numSynapticEvents / p.time) : 0.0;" << std::endl;
+                runner << "fprintf(file, \"%s\\n    {\\\"kernel\\\": \\\"%s\\\", \\\"index\\\": %u, \\\"groups\\\": [%s], \\\"time\\\": %.9g, \\\"numSpikes\\\": %llu, \\\"numSynapticEvents\\\": %llu, \\\"numRows\\\": %llu, \\\"synapticEventsPerSecond\\\": %.9g}\"," << std::endl;
+                runner << "        (i == 0) ? \"\" : \",\", p.kernel, p.index, groups[i], p.time, (unsigned long long)p.numSpikes," << std::endl;
+                runner << "        (unsigned long long)p.numSynapticEvents, (unsigned long long)p.numRows, synapticEventsPerSecond);" << std::endl;
+            }
+            runner << "fprintf(file, \"\\n  ]\\n}\\n\");" << std::endl;
+            runner << "const bool failed = (ferror(file) != 0);" << std::endl;
+            runner << "fclose(file);" << std::endl;
+            runner << "if(failed)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(\"Unable to write '\" + std::string(path) + \"'\");" << std::endl;
+            }
+        }
+        runner << std::endl;
     }
-    runner << std::endl;
 
     // Write variable and function definitions to header
     definitions << definitionsVarStream.str();
@@ -1542,6 +2706,9 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
 
     // ---------------------------------------------------------------------
     // Function definitions
+    definitions << "// Callback called by stepTimeN every callbackInterval timesteps" << std::endl;
+    definitions << "typedef void (*StepTimeCallback)(void *context);" << std::endl;
+    definitions << std::endl;
     definitions << "// Runner functions" << std::endl;
     if(!backend.isAutomaticCopyEnabled()) {
         definitions << "EXPORT_FUNC void copyStateToDevice(bool uninitialisedOnly = false);" << std::endl;
@@ -1553,18 +2720,55 @@ CodeGenerator::MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, C
     definitions << "EXPORT_FUNC void allocateMem();" << std::endl;
     definitions << "EXPORT_FUNC void freeMem();" << std::endl;
     definitions << "EXPORT_FUNC void stepTime();" << std::endl;
+    definitions << "EXPORT_FUNC void stepTimeN(unsigned int n, unsigned int callbackInterval = 0, StepTimeCallback callback = nullptr, void *context = nullptr);" << std::endl;
+    if(model.isRecordingInUse()) {
+        definitions << "EXPORT_FUNC void allocateRecordingBuffers(unsigned int timesteps);" << std::endl;
+        definitions << "EXPORT_FUNC void pullRecordingBuffersFromDevice();" << std::endl;
+    }
+    if(backend.isCheckpointSupported()) {
+        definitions << "EXPORT_FUNC void saveState(const char *path);" << std::endl;
+        definitions << "EXPORT_FUNC void loadState(const char *path);" << std::endl;
+    }
+    if(model.isProfilingEnabled()) {
+        definitions << "EXPORT_FUNC const MergedGroupProfile *getProfile();" << std::endl;
+        definitions << "EXPORT_FUNC void resetProfile();" << std::endl;
+        definitions << "EXPORT_FUNC void writeProfileJSON(const char *path);" << std::endl;
+    }
     definitions << std::endl;
     definitions << "// Functions generated by backend" << std::endl;
-    definitions << "EXPORT_FUNC void updateNeurons(" << model.getTimePrecision() << " t);" << std::endl;
+    if(model.isRecordingInUse()) {
+        definitions << "EXPORT_FUNC void updateNeurons(" << model.getTimePrecision() << " t, unsigned int recordingTimestep);" << std::endl;
+    }
+    else {
+        definitions << "EXPORT_FUNC void updateNeurons(" << model.getTimePrecision() << " t);" << std::endl;
+    }
     definitions << "EXPORT_FUNC void updateSynapses(" << model.getTimePrecision() << " t);" << std::endl;
     definitions << "EXPORT_FUNC void initialize();" << std::endl;
     definitions << "EXPORT_FUNC void initializeSparse();" << std::endl;
+    for(const auto &s : model.getSynapseGroups()) {
+        if(s.second.isCompressedSparseIndEnabled()) {
+            definitions << "EXPORT_FUNC void compressSparseInd" << s.first << "();" << std::endl;
+        }
+    }
 
 #ifdef MPI_ENABLE
     definitions << "// MPI functions" << std::endl;
     definitions << "EXPORT_FUNC void generateMPI();" << std::endl;
 #endif
 
+    // Internal functions generated by backend which updateNeurons and updateSynapses are split into
+    // **NOTE** this lets stepTimeN push scalar EGPs once rather than every timestep
+    definitionsInternal << "// Functions generated by backend" << std::endl;
+    definitionsInternal << "EXPORT_FUNC void pushNeuronUpdateEGPs();" << std::endl;
+    definitionsInternal << "EXPORT_FUNC void pushSynapseUpdateEGPs();" << std::endl;
+    if(model.isRecordingInUse()) {
+        definitionsInternal << "EXPORT_FUNC void updateNeuronsInternal(" << model.getTimePrecision() << " t, unsigned int recordingTimestep);" << std::endl;
+    }
+    else {
+        definitionsInternal << "EXPORT_FUNC void updateNeuronsInternal(" << model.getTimePrecision() << " t);" << std::endl;
+    }
+    definitionsInternal << "EXPORT_FUNC void updateSynapsesInternal(" << model.getTimePrecision() << " t);" << std::endl;
+
     // End extern C block around definitions
     definitions << "}  // extern \"C\"" << std::endl;
     definitionsInternal << "}  // extern \"C\"" << std::endl;
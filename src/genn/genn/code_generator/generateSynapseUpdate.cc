@@ -2,6 +2,7 @@
 
 // Standard C++ includes
 #include <string>
+#include <vector>
 
 // GeNN code generator includes
 #include "code_generator/codeStream.h"
@@ -21,6 +22,7 @@ void applySynapseSubstitutions(CodeGenerator::CodeStream &os, std::string code,
                                const ModelSpecInternal &model, const CodeGenerator::BackendBase &backend)
 {
     const auto *wu = sg.getWUModel();
+    const unsigned int batchSize = model.getBatchSize();
 
     CodeGenerator::Substitutions synapseSubs(&baseSubs);
 
@@ -30,18 +32,57 @@ void applySynapseSubstitutions(CodeGenerator::CodeStream &os, std::string code,
     synapseSubs.addVarNameSubstitution(wu->getExtraGlobalParams(), "", "group.");
 
     // Substitute names of pre and postsynaptic weight update variables
-    const std::string delayedPreIdx = (sg.getDelaySteps() == NO_DELAY) ? synapseSubs["id_pre"] : "preReadDelayOffset + " + baseSubs["id_pre"];
-    synapseSubs.addVarNameSubstitution(wu->getPreVars(), "", "group.",
-                                       "[" + delayedPreIdx + "]");
+    // **NOTE** if variables are only written to the delay slots of neurons which spike, their latest values may be required
+    if(backend.isLatestDelayedStateSupported() && sg.isWUPreVarLatestRequired()) {
+        for(const auto &v : wu->getPreVars()) {
+            synapseSubs.addVarSubstitution(v.name, CodeGenerator::getLatestDelayedVar("group." + v.name, "group." + v.name + "Latest", "group.spkTimestepLatestPre",
+                                                                                      "preReadDelayOffset + ", synapseSubs["id_pre"], sg.getDelaySteps(),
+                                                                                      "", "", batchSize));
+        }
+    }
+    else {
+        const std::string delayedPreIdx = (sg.getDelaySteps() == NO_DELAY) ? synapseSubs["id_pre"] : "preReadDelayOffset + " + baseSubs["id_pre"];
+        synapseSubs.addVarNameSubstitution(wu->getPreVars(), "", "group.",
+                                           "[" + CodeGenerator::getBatchedVarIndex(batchSize, delayedPreIdx) + "]");
+    }
 
-    const std::string delayedPostIdx = (sg.getBackPropDelaySteps() == NO_DELAY) ? synapseSubs["id_post"] : "postReadDelayOffset + " + baseSubs["id_post"];
-    synapseSubs.addVarNameSubstitution(wu->getPostVars(), "", "group.",
-                                       "[" + delayedPostIdx + "]");
+    if(backend.isLatestDelayedStateSupported() && sg.isWUPostVarLatestRequired()) {
+        for(const auto &v : wu->getPostVars()) {
+            synapseSubs.addVarSubstitution(v.name, CodeGenerator::getLatestDelayedVar("group." + v.name, "group." + v.name + "Latest", "group.spkTimestepLatestPost",
+                                                                                      "postReadDelayOffset + ", synapseSubs["id_post"], sg.getBackPropDelaySteps(),
+                                                                                      "", "", batchSize));
+        }
+    }
+    else {
+        const std::string delayedPostIdx = (sg.getBackPropDelaySteps() == NO_DELAY) ? synapseSubs["id_post"] : "postReadDelayOffset + " + baseSubs["id_post"];
+        synapseSubs.addVarNameSubstitution(wu->getPostVars(), "", "group.",
+                                           "[" + CodeGenerator::getBatchedVarIndex(batchSize, delayedPostIdx) + "]");
+    }
 
     // If weights are individual, substitute variables for values stored in global memory
+    std::vector<std::string> storeCode;
     if (sg.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-        synapseSubs.addVarNameSubstitution(wu->getVars(), "", "group.",
-                                           "[" + synapseSubs["id_syn"] + "]");
+        const auto vars = wu->getVars();
+        for(size_t i = 0; i < vars.size(); i++) {
+            const std::string var = "group." + vars[i].name + "[" + CodeGenerator::getBatchedVarIndex(batchSize, synapseSubs["id_syn"]) + "]";
+            const VarStorage storage = sg.getWUVarStorage(i);
+            const double scale = sg.getWUVarStorageScale(i);
+
+            // If variable is stored natively, access it directly
+            if(storage == VarStorage::NATIVE) {
+                synapseSubs.addVarSubstitution(vars[i].name, var);
+            }
+            // Otherwise, if it's read-only, convert it from storage format wherever it is read
+            else if(vars[i].access == VarAccess::READ_ONLY) {
+                synapseSubs.addVarSubstitution(vars[i].name, CodeGenerator::getVarStorageLoad(storage, scale, vars[i].type, var));
+            }
+            // Otherwise, if it's referenced, convert it into a local variable and store it back after code
+            else if(code.find("$(" + vars[i].name + ")") != std::string::npos) {
+                os << vars[i].type << " l" << vars[i].name << " = " << CodeGenerator::getVarStorageLoad(storage, scale, vars[i].type, var) << ";" << std::endl;
+                storeCode.push_back(var + " = " + CodeGenerator::getVarStorageStore(storage, scale, "l" + vars[i].name) + ";");
+                synapseSubs.addVarSubstitution(vars[i].name, "l" + vars[i].name);
+            }
+        }
     }
     // Otherwise, if weights are procedual
     else if (sg.getMatrixType() & SynapseMatrixWeight::PROCEDURAL) {
@@ -80,12 +121,17 @@ void applySynapseSubstitutions(CodeGenerator::CodeStream &os, std::string code,
     }
 
     neuronSubstitutionsInSynapticCode(synapseSubs, sg, synapseSubs["id_pre"],
-                                      synapseSubs["id_post"], model.getDT());
+                                      synapseSubs["id_post"], model.getDT(), "", "", "", "", batchSize,
+                                      backend.isLatestDelayedStateSupported());
 
     synapseSubs.apply(code);
     //synapseSubs.applyCheckUnreplaced(code, errorContext + " : " + sg.getName());
     code = CodeGenerator::ensureFtype(code, model.getPrecision());
     os << code;
+
+    for(const auto &c : storeCode) {
+        os << c << std::endl;
+    }
 }
 }   // Anonymous namespace
 
@@ -125,7 +171,8 @@ void CodeGenerator::generateSynapseUpdate(CodeStream &os, const MergedEGPMap &me
 
             // Get read offset if required
             const std::string offset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
-            neuronSubstitutionsInSynapticCode(synapseSubs, sg.getArchetype().getSrcNeuronGroup(), offset, "", baseSubs["id_pre"], "_pre", "Pre");
+            neuronSubstitutionsInSynapticCode(synapseSubs, sg.getArchetype().getSrcNeuronGroup(), offset, "", baseSubs["id_pre"], "_pre", "Pre",
+                                              "", "", sg.getArchetype().getDelaySteps(), backend.isLatestDelayedStateSupported(), model.getBatchSize());
 
             // Get event threshold condition code
             std::string code = sg.getArchetype().getWUModel()->getEventThresholdConditionCode();
@@ -204,4 +251,14 @@ void CodeGenerator::generateSynapseUpdate(CodeStream &os, const MergedEGPMap &me
             genScalarEGPPush(os, mergedEGPs, "PostsynapticUpdate", backend);
             genScalarEGPPush(os, mergedEGPs, "SynapseDynamics", backend);
         });
+    os << std::endl;
+
+    // Update synapses after pushing EGPs
+    // **NOTE** stepTimeN only pushes EGPs once before simulating and then calls updateSynapsesInternal every timestep
+    os << "void updateSynapses(" << model.getTimePrecision() << " t)";
+    {
+        CodeStream::Scope b(os);
+        os << "pushSynapseUpdateEGPs();" << std::endl;
+        os << "updateSynapsesInternal(t);" << std::endl;
+    }
 }
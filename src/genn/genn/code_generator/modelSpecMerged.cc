@@ -119,7 +119,7 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
     createMergedGroups(model.getSynapseGroups(), m_MergedSynapseSparseInitGroups,
                        [&backend](const SynapseGroupInternal &sg)
                        {
-                           return ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && 
+                           return (((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (sg.getMatrixType() & SynapseMatrixConnectivity::CSR)) && 
                                    (sg.isWUVarInitRequired()
                                     || (backend.isSynRemapRequired() && !sg.getWUModel()->getSynapseDynamicsCode().empty())
                                     || (backend.isPostsynapticRemapRequired() && !sg.getWUModel()->getLearnPostCode().empty())));
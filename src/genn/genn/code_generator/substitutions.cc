@@ -0,0 +1,162 @@
+#include "code_generator/substitutions.h"
+
+// Standard C includes
+#include <cctype>
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+// Substitutions which expand to themselves would otherwise recurse forever
+const unsigned int maxSubstitutionDepth = 64;
+}
+
+//--------------------------------------------------------------------------
+// CodeGenerator::Substitutions
+//--------------------------------------------------------------------------
+void CodeGenerator::Substitutions::apply(std::string &code) const
+{
+    // If there is nothing to substitute, leave code alone
+    if(code.find("$(") == std::string::npos) {
+        return;
+    }
+
+    std::string output;
+    output.reserve(code.size());
+    applyInto(code, output, 0);
+    code.swap(output);
+}
+//--------------------------------------------------------------------------
+const std::pair<unsigned int, std::string> *CodeGenerator::Substitutions::findFuncSubstitution(const std::string &source, bool hasArguments) const
+{
+    // **NOTE** functions without arguments are referenced as $(name) and functions with as $(name, ...) so
+    // a function only matches if the form matches - otherwise search continues in parent
+    auto func = m_FuncSubstitutions.find(source);
+    if(func != m_FuncSubstitutions.end() && ((func->second.first > 0) == hasArguments)) {
+        return &func->second;
+    }
+    else if(m_Parent) {
+        return m_Parent->findFuncSubstitution(source, hasArguments);
+    }
+    else {
+        return nullptr;
+    }
+}
+//--------------------------------------------------------------------------
+const std::string *CodeGenerator::Substitutions::findVarSubstitution(const std::string &source) const
+{
+    auto var = m_VarSubstitutions.find(source);
+    if(var != m_VarSubstitutions.end()) {
+        return &var->second;
+    }
+    else if(m_Parent) {
+        return m_Parent->findVarSubstitution(source);
+    }
+    else {
+        return nullptr;
+    }
+}
+//--------------------------------------------------------------------------
+void CodeGenerator::Substitutions::applyInto(const std::string &code, std::string &output, unsigned int depth) const
+{
+    if(depth > maxSubstitutionDepth) {
+        throw std::runtime_error("Substitutions nested too deeply - is there a recursive substitution in '" + code + "'?");
+    }
+
+    size_t i = 0;
+    while(true) {
+        // Copy code up to start of next potential substitution to output
+        const size_t start = code.find("$(", i);
+        if(start == std::string::npos) {
+            output.append(code, i, std::string::npos);
+            return;
+        }
+        output.append(code, i, start - i);
+
+        // Name runs until closing bracket or, if function has arguments, the first comma
+        const size_t nameEnd = code.find_first_of("),", start + 2);
+        if(nameEnd == std::string::npos) {
+            output.append(code, start, std::string::npos);
+            return;
+        }
+        const std::string name = code.substr(start + 2, nameEnd - start - 2);
+
+        // If reference is of form $(name)
+        if(code[nameEnd] == ')') {
+            // If there is a function without arguments with this name, substitute its template
+            const auto *func = findFuncSubstitution(name, false);
+            if(func) {
+                applyInto(func->second, output, depth + 1);
+                i = nameEnd + 1;
+                continue;
+            }
+
+            // Otherwise, if there is a variable with this name, substitute its value
+            const auto *var = findVarSubstitution(name);
+            if(var) {
+                LOGD_CODE_GEN << "Substituting '$(" << name << ")' for '" << *var << "'";
+                applyInto(*var, output, depth + 1);
+                i = nameEnd + 1;
+                continue;
+            }
+        }
+        // Otherwise, if reference is of form $(name, args...) and there's a function with arguments with this name
+        else {
+            const auto *func = findFuncSubstitution(name, true);
+            if(func) {
+                // Loop through arguments, splitting at commas at function bracket depth
+                // **NOTE** whitespace at function bracket depth is dropped
+                std::vector<std::string> params;
+                std::string currentParam;
+                unsigned int bracketDepth = 0;
+                size_t j;
+                for(j = nameEnd + 1; j < code.size(); j++) {
+                    const char c = code[j];
+                    if(c == ',' && bracketDepth == 0) {
+                        params.push_back(currentParam);
+                        currentParam.clear();
+                    }
+                    else if(c == ')' && bracketDepth == 0) {
+                        params.push_back(currentParam);
+                        break;
+                    }
+                    else {
+                        if(c == '(') {
+                            bracketDepth++;
+                        }
+                        else if(c == ')') {
+                            bracketDepth--;
+                        }
+
+                        if(bracketDepth > 0 || !std::isspace(static_cast<unsigned char>(c))) {
+                            currentParam += c;
+                        }
+                    }
+                }
+
+                // If function call was closed
+                if(j < code.size()) {
+                    if(params.size() != func->first) {
+                        throw std::runtime_error("Function '" + name + "' takes " + std::to_string(func->first)
+                                                 + " arguments but " + std::to_string(params.size()) + " were provided");
+                    }
+
+                    // Substitute parameters into function template and substitute result
+                    std::string replaceFunc = func->second;
+                    for(unsigned int p = 0; p < func->first; p++) {
+                        substitute(replaceFunc, "$(" + std::to_string(p) + ")", params[p]);
+                    }
+                    applyInto(replaceFunc, output, depth + 1);
+                    i = j + 1;
+                    continue;
+                }
+            }
+        }
+
+        // No substitution applies so copy '$(' and continue scanning from the name
+        // **NOTE** name may itself contain substitutions e.g. $(x$(y))
+        output.append("$(");
+        i = start + 2;
+    }
+}
@@ -0,0 +1,180 @@
+#include "linearDynamics.h"
+
+// Standard C++ includes
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+// Standard C includes
+#include <cmath>
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Multiply square row-major matrices a and b of size n
+std::vector<double> multiply(const std::vector<double> &a, const std::vector<double> &b, size_t n)
+{
+    std::vector<double> c(n * n, 0.0);
+    for(size_t i = 0; i < n; i++) {
+        for(size_t k = 0; k < n; k++) {
+            const double aik = a[(i * n) + k];
+            for(size_t j = 0; j < n; j++) {
+                c[(i * n) + j] += aik * b[(k * n) + j];
+            }
+        }
+    }
+    return c;
+}
+
+// Calculate exponential of square row-major matrix m of size n by scaling and squaring a Taylor series
+std::vector<double> exponential(std::vector<double> m, size_t n)
+{
+    // Calculate infinity norm of matrix
+    double norm = 0.0;
+    for(size_t i = 0; i < n; i++) {
+        double rowSum = 0.0;
+        for(size_t j = 0; j < n; j++) {
+            rowSum += std::fabs(m[(i * n) + j]);
+        }
+        norm = std::max(norm, rowSum);
+    }
+
+    // Scale matrix so its norm is less than 0.5, where the Taylor series converges rapidly
+    const int numSquarings = (norm > 0.5) ? (int)std::ceil(std::log2(norm / 0.5)) : 0;
+    const double scale = std::ldexp(1.0, -numSquarings);
+    std::transform(m.begin(), m.end(), m.begin(), [scale](double v){ return v * scale; });
+
+    // Sum Taylor series
+    std::vector<double> result(n * n, 0.0);
+    std::vector<double> term(n * n, 0.0);
+    for(size_t i = 0; i < n; i++) {
+        result[(i * n) + i] = 1.0;
+        term[(i * n) + i] = 1.0;
+    }
+    for(int k = 1; k <= 20; k++) {
+        term = multiply(term, m, n);
+        std::transform(term.begin(), term.end(), term.begin(), [k](double v){ return v / k; });
+        std::transform(result.begin(), result.end(), term.begin(), result.begin(), std::plus<double>());
+    }
+
+    // Undo scaling by repeated squaring
+    for(int s = 0; s < numSquarings; s++) {
+        result = multiply(result, result, n);
+    }
+    return result;
+}
+}   // Anonymous namespace
+
+//----------------------------------------------------------------------------
+// Models::LinearDynamics
+//----------------------------------------------------------------------------
+Models::LinearDynamics::LinearDynamics(const std::vector<std::string> &vars, SystemMatrixFunc systemMatrix,
+                                       const std::vector<std::string> &inputs, const std::string &prefix)
+:   m_Vars(vars), m_SystemMatrix(systemMatrix), m_Inputs(inputs), m_Prefix(prefix)
+{
+    if(m_Vars.empty()) {
+        throw std::runtime_error("Linear dynamics require at least one variable");
+    }
+    if(m_Inputs.size() != m_Vars.size()) {
+        throw std::runtime_error("Linear dynamics require an input for each variable");
+    }
+}
+//----------------------------------------------------------------------------
+Snippet::Base::DerivedParamVec Models::LinearDynamics::getDerivedParams() const
+{
+    const size_t n = m_Vars.size();
+    const auto systemMatrix = m_SystemMatrix;
+
+    // Add derived parameter to calculate each element of P
+    Snippet::Base::DerivedParamVec derivedParams;
+    for(size_t i = 0; i < n; i++) {
+        for(size_t j = 0; j < n; j++) {
+            derivedParams.push_back({m_Prefix + "P" + std::to_string(i) + "_" + std::to_string(j),
+                                     [systemMatrix, n, i, j](const std::vector<double> &pars, double dt)
+                                     {
+                                         return calcPropagators(systemMatrix(pars), n, dt).first[(i * n) + j];
+                                     }});
+        }
+    }
+
+    // Add derived parameter to calculate each element of Q which is multiplied by a non-zero input
+    for(size_t i = 0; i < n; i++) {
+        for(size_t j = 0; j < n; j++) {
+            if(!m_Inputs[j].empty()) {
+                derivedParams.push_back({m_Prefix + "Q" + std::to_string(i) + "_" + std::to_string(j),
+                                         [systemMatrix, n, i, j](const std::vector<double> &pars, double dt)
+                                         {
+                                             return calcPropagators(systemMatrix(pars), n, dt).second[(i * n) + j];
+                                         }});
+            }
+        }
+    }
+    return derivedParams;
+}
+//----------------------------------------------------------------------------
+std::string Models::LinearDynamics::getUpdateCode() const
+{
+    const size_t n = m_Vars.size();
+
+    // Evaluate inputs once so they are held constant across timestep
+    std::ostringstream code;
+    code << "{" << std::endl;
+    for(size_t j = 0; j < n; j++) {
+        if(!m_Inputs[j].empty()) {
+            code << "    const scalar " << m_Prefix << "In" << j << " = " << m_Inputs[j] << ";" << std::endl;
+        }
+    }
+
+    // Calculate new value of each variable from the old values of all variables
+    for(size_t i = 0; i < n; i++) {
+        code << "    const scalar " << m_Prefix << "New" << i << " = ";
+        for(size_t j = 0; j < n; j++) {
+            code << ((j == 0) ? "" : " + ") << "($(" << m_Prefix << "P" << i << "_" << j << ") * $(" << m_Vars[j] << "))";
+        }
+        for(size_t j = 0; j < n; j++) {
+            if(!m_Inputs[j].empty()) {
+                code << " + ($(" << m_Prefix << "Q" << i << "_" << j << ") * " << m_Prefix << "In" << j << ")";
+            }
+        }
+        code << ";" << std::endl;
+    }
+
+    // Update variables
+    for(size_t i = 0; i < n; i++) {
+        code << "    $(" << m_Vars[i] << ") = " << m_Prefix << "New" << i << ";" << std::endl;
+    }
+    code << "}" << std::endl;
+    return code.str();
+}
+//----------------------------------------------------------------------------
+std::pair<std::vector<double>, std::vector<double>> Models::LinearDynamics::calcPropagators(const std::vector<double> &a, size_t n, double dt)
+{
+    if(a.size() != (n * n)) {
+        throw std::runtime_error("Linear dynamics system matrix should have " + std::to_string(n * n) + " elements");
+    }
+
+    // Build augmented matrix [A I; 0 0] * dt whose exponential is [P Q; 0 I]
+    // **NOTE** this avoids inverting A so systems with singular A e.g. pure integrators are supported
+    const size_t m = 2 * n;
+    std::vector<double> augmented(m * m, 0.0);
+    for(size_t i = 0; i < n; i++) {
+        for(size_t j = 0; j < n; j++) {
+            augmented[(i * m) + j] = a[(i * n) + j] * dt;
+        }
+        augmented[(i * m) + n + i] = dt;
+    }
+    const std::vector<double> exp = exponential(augmented, m);
+
+    // Extract blocks
+    std::vector<double> p(n * n);
+    std::vector<double> q(n * n);
+    for(size_t i = 0; i < n; i++) {
+        for(size_t j = 0; j < n; j++) {
+            p[(i * n) + j] = exp[(i * m) + j];
+            q[(i * n) + j] = exp[(i * m) + n + j];
+        }
+    }
+    return std::make_pair(p, q);
+}
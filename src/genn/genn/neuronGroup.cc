@@ -92,6 +92,29 @@ bool NeuronGroup::isSpikeTimeRequired() const
     return false;
 }
 //----------------------------------------------------------------------------
+bool NeuronGroup::isLatestSpikeTimestepRequired() const
+{
+    if(!isDelayRequired()) {
+        return false;
+    }
+
+    // If spike times are required, they are delayed so return true
+    if(isSpikeTimeRequired()) {
+        return true;
+    }
+
+    // If any OUTGOING synapse groups have delayed PRESYNAPTIC spike-triggered variables, return true
+    if(std::any_of(getOutSyn().cbegin(), getOutSyn().cend(),
+                   [](SynapseGroup *sg){ return sg->isWUPreVarLatestRequired(); }))
+    {
+        return true;
+    }
+
+    // If any INCOMING synapse groups have delayed POSTSYNAPTIC spike-triggered variables, return true
+    return std::any_of(getInSyn().cbegin(), getInSyn().cend(),
+                       [](SynapseGroup *sg){ return sg->isWUPostVarLatestRequired(); });
+}
+//----------------------------------------------------------------------------
 bool NeuronGroup::isTrueSpikeRequired() const
 {
     // If any OUTGOING synapse groups require true spikes, return true
@@ -324,10 +347,12 @@ bool NeuronGroup::canBeMerged(const NeuronGroup &other) const
        && (getParams() == other.getParams())
        && (getDerivedParams() == other.getDerivedParams())
        && (isSpikeTimeRequired() == other.isSpikeTimeRequired())
+       && (isLatestSpikeTimestepRequired() == other.isLatestSpikeTimestepRequired())
        && (getSpikeEventCondition() == other.getSpikeEventCondition())
        && (isSpikeEventRequired() == other.isSpikeEventRequired())
        && (getNumDelaySlots() == other.getNumDelaySlots())
-       && (m_VarQueueRequired == other.m_VarQueueRequired))
+       && (m_VarQueueRequired == other.m_VarQueueRequired)
+       && (isSpikeRecordingEnabled() == other.isSpikeRecordingEnabled()))
     {
 
         // Check if, by reshuffling, all current sources are compatible
@@ -384,6 +409,7 @@ bool NeuronGroup::canBeMerged(const NeuronGroup &other) const
 bool NeuronGroup::canInitBeMerged(const NeuronGroup &other) const
 {
     if((isSpikeTimeRequired() == other.isSpikeTimeRequired())
+       && (isLatestSpikeTimestepRequired() == other.isLatestSpikeTimestepRequired())
        && (isSpikeEventRequired() == other.isSpikeEventRequired())
        && (getNumDelaySlots() == other.getNumDelaySlots())
        && (m_VarQueueRequired == other.m_VarQueueRequired)
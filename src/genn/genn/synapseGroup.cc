@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
 
 // GeNN includes
 #include "neuronGroupInternal.h"
@@ -45,6 +46,25 @@ void SynapseGroup::setWUVarLocation(const std::string &varName, VarLocation loc)
     m_WUVarLocation[getWUModel()->getVarIndex(varName)] = loc;
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setWUVarStorage(const std::string &varName, VarStorage storage, double scale)
+{
+    if(!(getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
+        throw std::runtime_error("setWUVarStorage: This function can only be used on synapse groups with individual weights.");
+    }
+
+    const size_t varIndex = getWUModel()->getVarIndex(varName);
+    const std::string &type = getWUModel()->getVars()[varIndex].type;
+    if(storage != VarStorage::NATIVE && type != "scalar" && type != "float" && type != "double") {
+        throw std::runtime_error("setWUVarStorage: Variable '" + varName + "' does not have a floating point type.");
+    }
+    if((storage == VarStorage::INT8 || storage == VarStorage::INT16) && !(scale > 0.0)) {
+        throw std::runtime_error("setWUVarStorage: Variables stored as quantised integers require a positive scale.");
+    }
+
+    m_WUVarStorage[varIndex] = storage;
+    m_WUVarStorageScale[varIndex] = scale;
+}
+//----------------------------------------------------------------------------
 void SynapseGroup::setWUPreVarLocation(const std::string &varName, VarLocation loc)
 {
     m_WUPreVarLocation[getWUModel()->getPreVarIndex(varName)] = loc;
@@ -89,7 +109,7 @@ void SynapseGroup::setSparseConnectivityExtraGlobalParamLocation(const std::stri
 //----------------------------------------------------------------------------
 void SynapseGroup::setMaxConnections(unsigned int maxConnections)
 {
-    if (getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+    if ((getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (getMatrixType() & SynapseMatrixConnectivity::CSR)) {
         if(m_ConnectivityInitialiser.getSnippet()->getCalcMaxRowLengthFunc()) {
             throw std::runtime_error("setMaxConnections: Synapse group already has max connections defined by connectivity initialisation snippet.");
         }
@@ -103,7 +123,7 @@ void SynapseGroup::setMaxConnections(unsigned int maxConnections)
 //----------------------------------------------------------------------------
 void SynapseGroup::setMaxSourceConnections(unsigned int maxConnections)
 {
-    if (getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+    if ((getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (getMatrixType() & SynapseMatrixConnectivity::CSR)) {
         if(m_ConnectivityInitialiser.getSnippet()->getCalcMaxColLengthFunc()) {
             throw std::runtime_error("setMaxSourceConnections: Synapse group already has max source connections defined by connectivity initialisation snippet.");
         }
@@ -115,6 +135,20 @@ void SynapseGroup::setMaxSourceConnections(unsigned int maxConnections)
     }
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setMaxNumSynapses(size_t maxNumSynapses)
+{
+    if (getMatrixType() & SynapseMatrixConnectivity::CSR) {
+        if(m_ConnectivityInitialiser.getSnippet()->getCalcMaxNumSynapsesFunc()) {
+            throw std::runtime_error("setMaxNumSynapses: Synapse group already has max number of synapses defined by connectivity initialisation snippet.");
+        }
+
+        m_MaxNumSynapses = maxNumSynapses;
+    }
+    else {
+        throw std::runtime_error("setMaxNumSynapses: This function can only be used on synapse groups with CSR connectivity.");
+    }
+}
+//----------------------------------------------------------------------------
 void SynapseGroup::setMaxDendriticDelayTimesteps(unsigned int maxDendriticDelayTimesteps)
 {
     // **TODO** constraints on this
@@ -150,7 +184,7 @@ void SynapseGroup::setBackPropDelaySteps(unsigned int timesteps)
 //----------------------------------------------------------------------------
 void SynapseGroup::setNarrowSparseIndEnabled(bool enabled)
 {
-    if (getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+    if ((getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (getMatrixType() & SynapseMatrixConnectivity::CSR)) {
         m_NarrowSparseIndEnabled = enabled;
     }
     else {
@@ -158,6 +192,47 @@ void SynapseGroup::setNarrowSparseIndEnabled(bool enabled)
     }
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setCompressedSparseIndEnabled(bool enabled)
+{
+    if ((getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (getMatrixType() & SynapseMatrixConnectivity::CSR)) {
+        m_CompressedSparseIndEnabled = enabled;
+    }
+    else {
+        throw std::runtime_error("setCompressedSparseIndEnabled: This function can only be used on synapse groups with sparse connectivity.");
+    }
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setExternalConnectivityFile(const std::string &filename)
+{
+    if(!(getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+        throw std::runtime_error("setExternalConnectivityFile: This function can only be used on synapse groups with SPARSE connectivity.");
+    }
+
+    // Connectivity and variables come from the file so initialising them would overwrite it
+    if(!getConnectivityInitialiser().getSnippet()->getRowBuildCode().empty()) {
+        throw std::runtime_error("setExternalConnectivityFile: Synapse group '" + getName() + "' has connectivity initialisation.");
+    }
+    if(std::any_of(getWUVarInitialisers().cbegin(), getWUVarInitialisers().cend(),
+                   [](const Models::VarInit &v){ return !v.getSnippet()->getCode().empty(); }))
+    {
+        throw std::runtime_error("setExternalConnectivityFile: Synapse group '" + getName() + "' has variable initialisation.");
+    }
+
+    m_ExternalConnectivityFile = filename;
+}
+//----------------------------------------------------------------------------
+size_t SynapseGroup::getMaxNumSynapses() const
+{
+    // If maximum number of synapses has been set, return it
+    if(m_MaxNumSynapses > 0) {
+        return m_MaxNumSynapses;
+    }
+    // Otherwise, assume every row could be full
+    else {
+        return (size_t)getSrcNeuronGroup()->getNumNeurons() * (size_t)getMaxConnections();
+    }
+}
+//----------------------------------------------------------------------------
 bool SynapseGroup::isTrueSpikeRequired() const
 {
     return !getWUModel()->getSimCode().empty();
@@ -261,6 +336,20 @@ bool SynapseGroup::isDendriticDelayRequired() const
     return false;
 }
 //----------------------------------------------------------------------------
+bool SynapseGroup::isWUPreVarLatestRequired() const
+{
+    // Presynaptic variables are delayed and only updated by presynaptic spike code
+    return ((getDelaySteps() != 0) && !getWUModel()->getPreVars().empty()
+            && !getWUModel()->getPreSpikeCode().empty());
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isWUPostVarLatestRequired() const
+{
+    // Postsynaptic variables are delayed and only updated by postsynaptic spike code
+    return ((getBackPropDelaySteps() != 0) && !getWUModel()->getPostVars().empty()
+            && !getWUModel()->getPostSpikeCode().empty());
+}
+//----------------------------------------------------------------------------
 bool SynapseGroup::isProceduralConnectivityRNGRequired() const
 {
     return ((m_MatrixType & SynapseMatrixConnectivity::PROCEDURAL) &&
@@ -280,8 +369,9 @@ bool SynapseGroup::isWUInitRNGRequired() const
         return true;
     }
 
-    // Return true if matrix has sparse or bitmask connectivity and an RNG is required to initialise connectivity
-    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
+    // Return true if matrix has sparse, CSR or bitmask connectivity and an RNG is required to initialise connectivity
+    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR)
+             || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
             && Utils::isRNGRequired(m_ConnectivityInitialiser.getSnippet()->getRowBuildCode()));
 }
 //----------------------------------------------------------------------------
@@ -300,8 +390,9 @@ bool SynapseGroup::isWUVarInitRequired() const
 //----------------------------------------------------------------------------
 bool SynapseGroup::isSparseConnectivityInitRequired() const
 {
-    // Return true if the matrix type is sparse or bitmask and there is code to initialise sparse connectivity
-    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
+    // Return true if the matrix type is sparse, CSR or bitmask and there is code to initialise sparse connectivity
+    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR)
+             || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
             && !getConnectivityInitialiser().getSnippet()->getRowBuildCode().empty());
 }
 //----------------------------------------------------------------------------
@@ -315,10 +406,12 @@ SynapseGroup::SynapseGroup(const std::string name, SynapseMatrixType matrixType,
     :   m_Name(name), m_SpanType(SpanType::POSTSYNAPTIC), m_NumThreadsPerSpike(1), m_DelaySteps(delaySteps), m_BackPropDelaySteps(0),
         m_MaxDendriticDelayTimesteps(1), m_MatrixType(matrixType),  m_SrcNeuronGroup(srcNeuronGroup), m_TrgNeuronGroup(trgNeuronGroup),
         m_EventThresholdReTestRequired(false), m_NarrowSparseIndEnabled(defaultNarrowSparseIndEnabled),
+        m_CompressedSparseIndEnabled(false),
         m_InSynLocation(defaultVarLocation),  m_DendriticDelayLocation(defaultVarLocation),
         m_WUModel(wu), m_WUParams(wuParams), m_WUVarInitialisers(wuVarInitialisers), m_WUPreVarInitialisers(wuPreVarInitialisers), m_WUPostVarInitialisers(wuPostVarInitialisers),
         m_PSModel(ps), m_PSParams(psParams), m_PSVarInitialisers(psVarInitialisers),
-        m_WUVarLocation(wuVarInitialisers.size(), defaultVarLocation), m_WUPreVarLocation(wuPreVarInitialisers.size(), defaultVarLocation),
+        m_WUVarLocation(wuVarInitialisers.size(), defaultVarLocation), m_WUVarStorage(wuVarInitialisers.size(), VarStorage::NATIVE),
+        m_WUVarStorageScale(wuVarInitialisers.size(), 1.0), m_WUPreVarLocation(wuPreVarInitialisers.size(), defaultVarLocation),
         m_WUPostVarLocation(wuPostVarInitialisers.size(), defaultVarLocation), m_WUExtraGlobalParamLocation(wu->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
         m_PSVarLocation(psVarInitialisers.size(), defaultVarLocation), m_PSExtraGlobalParamLocation(ps->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
         m_ConnectivityInitialiser(connectivityInitialiser), m_SparseConnectivityLocation(defaultSparseConnectivityLocation),
@@ -344,9 +437,9 @@ SynapseGroup::SynapseGroup(const std::string name, SynapseMatrixType matrixType,
     }
 
     // If connectivitity initialisation snippet provides a function to calculate row length, call it
-    // **NOTE** only do this for sparse connectivity as this should not be set for bitmasks
+    // **NOTE** only do this for sparse and CSR connectivity as this should not be set for bitmasks
     auto calcMaxRowLengthFunc = m_ConnectivityInitialiser.getSnippet()->getCalcMaxRowLengthFunc();
-    if(calcMaxRowLengthFunc && (m_MatrixType & SynapseMatrixConnectivity::SPARSE)) {
+    if(calcMaxRowLengthFunc && ((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR))) {
         m_MaxConnections = calcMaxRowLengthFunc(srcNeuronGroup->getNumNeurons(), trgNeuronGroup->getNumNeurons(),
                                                 m_ConnectivityInitialiser.getParams());
     }
@@ -356,9 +449,9 @@ SynapseGroup::SynapseGroup(const std::string name, SynapseMatrixType matrixType,
     }
 
     // If connectivitity initialisation snippet provides a function to calculate row length, call it
-    // **NOTE** only do this for sparse connectivity as this should not be set for bitmasks
+    // **NOTE** only do this for sparse and CSR connectivity as this should not be set for bitmasks
     auto calcMaxColLengthFunc = m_ConnectivityInitialiser.getSnippet()->getCalcMaxColLengthFunc();
-    if(calcMaxColLengthFunc && (m_MatrixType & SynapseMatrixConnectivity::SPARSE)) {
+    if(calcMaxColLengthFunc && ((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR))) {
         m_MaxSourceConnections = calcMaxColLengthFunc(srcNeuronGroup->getNumNeurons(), trgNeuronGroup->getNumNeurons(),
                                                       m_ConnectivityInitialiser.getParams());
     }
@@ -367,6 +460,17 @@ SynapseGroup::SynapseGroup(const std::string name, SynapseMatrixType matrixType,
         m_MaxSourceConnections = srcNeuronGroup->getNumNeurons();
     }
 
+    // If connectivity initialisation snippet provides a function to calculate the total number of synapses, call it
+    // **NOTE** this is only used to size CSR connectivity so leave it unset (and calculated from max connections) otherwise
+    auto calcMaxNumSynapsesFunc = m_ConnectivityInitialiser.getSnippet()->getCalcMaxNumSynapsesFunc();
+    if(calcMaxNumSynapsesFunc && (m_MatrixType & SynapseMatrixConnectivity::CSR)) {
+        m_MaxNumSynapses = calcMaxNumSynapsesFunc(srcNeuronGroup->getNumNeurons(), trgNeuronGroup->getNumNeurons(),
+                                                  m_ConnectivityInitialiser.getParams());
+    }
+    else {
+        m_MaxNumSynapses = 0;
+    }
+
     // Check that the source neuron group supports the desired number of delay steps
     srcNeuronGroup->checkNumDelaySlots(delaySteps);
 }
@@ -443,6 +547,9 @@ bool SynapseGroup::canWUBeMerged(const SynapseGroup &other) const
        && (getBackPropDelaySteps() == other.getBackPropDelaySteps())
        && (getMaxDendriticDelayTimesteps() == other.getMaxDendriticDelayTimesteps())
        && (getSparseIndType() == other.getSparseIndType())
+       && (isCompressedSparseIndEnabled() == other.isCompressedSparseIndEnabled())
+       && (m_WUVarStorage == other.m_WUVarStorage)
+       && (m_WUVarStorageScale == other.m_WUVarStorageScale)
        && (getNumThreadsPerSpike() == other.getNumThreadsPerSpike())
        && (isEventThresholdReTestRequired() == other.isEventThresholdReTestRequired())
        && (getSpanType() == other.getSpanType())
@@ -484,7 +591,8 @@ bool SynapseGroup::canWUPreBeMerged(const SynapseGroup &other) const
     return (getWUModel()->canBeMerged(other.getWUModel())
             && (getWUParams() == other.getWUParams())
             && (getWUDerivedParams() == other.getWUDerivedParams())
-            && (delayed == otherDelayed));
+            && (delayed == otherDelayed)
+            && (isWUPreVarLatestRequired() == other.isWUPreVarLatestRequired()));
 }
 //----------------------------------------------------------------------------
 bool SynapseGroup::canWUPostBeMerged(const SynapseGroup &other) const
@@ -494,7 +602,8 @@ bool SynapseGroup::canWUPostBeMerged(const SynapseGroup &other) const
     return (getWUModel()->canBeMerged(other.getWUModel())
             && (getWUParams() == other.getWUParams())
             && (getWUDerivedParams() == other.getWUDerivedParams())
-            && (delayed == otherDelayed));
+            && (delayed == otherDelayed)
+            && (isWUPostVarLatestRequired() == other.isWUPostVarLatestRequired()));
 }
 //----------------------------------------------------------------------------
 bool SynapseGroup::canPSBeMerged(const SynapseGroup &other) const
@@ -534,7 +643,9 @@ bool SynapseGroup::canWUInitBeMerged(const SynapseGroup &other) const
 {
     if((getMatrixType() == other.getMatrixType())
        && (getSparseIndType() == other.getSparseIndType())
-       && (getWUModel()->getVars() == other.getWUModel()->getVars()))
+       && (getWUModel()->getVars() == other.getWUModel()->getVars())
+       && (m_WUVarStorage == other.m_WUVarStorage)
+       && (m_WUVarStorageScale == other.m_WUVarStorageScale))
     {
         // if any of the variable's initialisers can't be merged, return false
         for(size_t i = 0; i < getWUVarInitialisers().size(); i++) {
@@ -550,7 +661,9 @@ bool SynapseGroup::canWUInitBeMerged(const SynapseGroup &other) const
 //----------------------------------------------------------------------------
 bool SynapseGroup::canWUPreInitBeMerged(const SynapseGroup &other) const
 {
-    if(getWUModel()->getPreVars() == other.getWUModel()->getPreVars()) {
+    if((getWUModel()->getPreVars() == other.getWUModel()->getPreVars())
+       && (isWUPreVarLatestRequired() == other.isWUPreVarLatestRequired()))
+    {
         // if any of the presynaptic variable's initialisers can't be merged, return false
         for(size_t i = 0; i < getWUPreVarInitialisers().size(); i++) {
             if(!getWUPreVarInitialisers()[i].canBeMerged(other.getWUPreVarInitialisers()[i])) {
@@ -565,7 +678,9 @@ bool SynapseGroup::canWUPreInitBeMerged(const SynapseGroup &other) const
 //----------------------------------------------------------------------------
 bool SynapseGroup::canWUPostInitBeMerged(const SynapseGroup &other) const
 {
-    if(getWUModel()->getPostVars() == other.getWUModel()->getPostVars()) {
+    if((getWUModel()->getPostVars() == other.getWUModel()->getPostVars())
+       && (isWUPostVarLatestRequired() == other.isWUPostVarLatestRequired()))
+    {
         // if any of the postsynaptic variable's initialisers can't be merged, return false
         for(size_t i = 0; i < getWUPostVarInitialisers().size(); i++) {
             if(!getWUPostVarInitialisers()[i].canBeMerged(other.getWUPostVarInitialisers()[i])) {
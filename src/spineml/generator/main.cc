@@ -4,6 +4,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <string>
 #include <thread>
 
@@ -598,8 +599,11 @@ int main(int argc, char *argv[])
         // Create makefile to compile and link all generated modules
         // **NOTE** scope requiredso it gets closed before being built
         {
-            std::ofstream makefile((codePath / "Makefile").str());
-            CodeGenerator::generateMakefile(makefile, backend, moduleNames);
+            std::ostringstream makefile;
+            CodeGenerator::generateMakefile(makefile, backend, moduleNames,
+                                            CodeGenerator::getBuildCacheKey(backend, codePath, moduleNames),
+                                            preferences.buildCacheDirectory);
+            CodeGenerator::writeFileIfChanged(codePath / "Makefile", makefile.str());
         }
 
         // Generate command to build using make, using as many threads as possible
@@ -0,0 +1,91 @@
+#include "asyncWriter.h"
+
+// Standard C++ includes
+#include <stdexcept>
+
+//----------------------------------------------------------------------------
+// SpineMLSimulator::AsyncWriter
+//----------------------------------------------------------------------------
+SpineMLSimulator::AsyncWriter::AsyncWriter(const std::string &filename, std::ios::openmode mode, size_t bufferSize, unsigned int numBuffers,
+                                           WriteFunc writeFunc)
+:   m_File(filename, mode), m_BufferSize(bufferSize), m_WriteFunc(writeFunc),
+    m_Buffers(numBuffers, std::vector<char>(bufferSize)), m_SnapshotSizes(numBuffers, 0),
+    m_Head(0), m_NumFilled(0), m_Stop(false), m_Failed(false)
+{
+    if(!m_File.good()) {
+        throw std::runtime_error("Cannot open log file '" + filename + "'");
+    }
+
+    // Start writer thread
+    m_Thread = std::thread(&AsyncWriter::writerThread, this);
+}
+//----------------------------------------------------------------------------
+SpineMLSimulator::AsyncWriter::~AsyncWriter()
+{
+    // Ask writer thread to stop once it has written all filled buffers and wait for it
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_BufferFilled.notify_one();
+    m_Thread.join();
+}
+//----------------------------------------------------------------------------
+char *SpineMLSimulator::AsyncWriter::acquireBuffer()
+{
+    // Wait until head buffer is not waiting to be written
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_BufferWritten.wait(lock, [this](){ return (m_NumFilled < m_Buffers.size()) || m_Failed; });
+
+    if(m_Failed) {
+        throw std::runtime_error("Cannot write to log file");
+    }
+    return m_Buffers[m_Head].data();
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::AsyncWriter::commitBuffer(size_t size)
+{
+    // Record size of snapshot, advance head and count buffer as filled
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_SnapshotSizes[m_Head] = size;
+        m_Head = (m_Head + 1) % m_Buffers.size();
+        m_NumFilled++;
+    }
+    m_BufferFilled.notify_one();
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::AsyncWriter::writerThread()
+{
+    while(true) {
+        // Wait until there are buffers to write or we've been asked to stop
+        unsigned int tail;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_BufferFilled.wait(lock, [this](){ return (m_NumFilled > 0) || m_Stop; });
+
+            // If there's nothing left to write, stop
+            if(m_NumFilled == 0) {
+                break;
+            }
+
+            // Get oldest filled buffer
+            tail = (m_Head + m_Buffers.size() - m_NumFilled) % m_Buffers.size();
+        }
+
+        // Write buffer outside of lock
+        // **NOTE** buffer can't be reused until it's no longer counted as filled
+        m_WriteFunc(m_File, m_Buffers[tail].data(), m_SnapshotSizes[tail]);
+        const bool failed = !m_File.good();
+
+        // Free buffer
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_NumFilled--;
+            m_Failed = m_Failed || failed;
+        }
+        m_BufferWritten.notify_one();
+    }
+
+    m_File.flush();
+}
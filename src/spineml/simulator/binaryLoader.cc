@@ -0,0 +1,169 @@
+#include "binaryLoader.h"
+
+// Standard C++ includes
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Platform includes
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Minimum number of items worth giving to each loading thread
+const size_t minItemsPerThread = 1 << 16;
+}
+
+//----------------------------------------------------------------------------
+// SpineMLSimulator::BinaryLoader::MappedFile
+//----------------------------------------------------------------------------
+SpineMLSimulator::BinaryLoader::MappedFile::MappedFile(const std::string &filename)
+:   m_Filename(filename), m_Data(nullptr), m_Size(0)
+{
+#ifdef _WIN32
+    m_Mapping = NULL;
+    m_File = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                         OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if(m_File == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Cannot open binary file:" + filename);
+    }
+
+    LARGE_INTEGER size;
+    if(!GetFileSizeEx(m_File, &size)) {
+        CloseHandle(m_File);
+        throw std::runtime_error("Cannot get size of binary file:" + filename);
+    }
+    m_Size = (size_t)size.QuadPart;
+
+    // **NOTE** empty files cannot be mapped
+    if(m_Size > 0) {
+        m_Mapping = CreateFileMappingA(m_File, NULL, PAGE_READONLY, 0, 0, NULL);
+        if(m_Mapping == NULL) {
+            CloseHandle(m_File);
+            throw std::runtime_error("Cannot map binary file:" + filename);
+        }
+
+        m_Data = reinterpret_cast<const char*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+        if(m_Data == nullptr) {
+            CloseHandle(m_Mapping);
+            CloseHandle(m_File);
+            throw std::runtime_error("Cannot map binary file:" + filename);
+        }
+    }
+#else
+    const int file = open(filename.c_str(), O_RDONLY);
+    if(file == -1) {
+        throw std::runtime_error("Cannot open binary file:" + filename);
+    }
+
+    struct stat status;
+    if(fstat(file, &status) != 0) {
+        close(file);
+        throw std::runtime_error("Cannot get size of binary file:" + filename);
+    }
+    m_Size = (size_t)status.st_size;
+
+    // **NOTE** empty files cannot be mapped
+    if(m_Size > 0) {
+        void *data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+        if(data == MAP_FAILED) {
+            close(file);
+            throw std::runtime_error("Cannot map binary file:" + filename);
+        }
+
+        // Whole file is about to be read so ask kernel to start reading it in
+        madvise(data, m_Size, MADV_WILLNEED);
+        m_Data = reinterpret_cast<const char*>(data);
+    }
+
+    // **NOTE** mapping remains valid after descriptor is closed
+    close(file);
+#endif
+}
+//----------------------------------------------------------------------------
+SpineMLSimulator::BinaryLoader::MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    if(m_Data != nullptr) {
+        UnmapViewOfFile(m_Data);
+    }
+    if(m_Mapping != NULL) {
+        CloseHandle(m_Mapping);
+    }
+    CloseHandle(m_File);
+#else
+    if(m_Data != nullptr) {
+        munmap(const_cast<char*>(m_Data), m_Size);
+    }
+#endif
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::BinaryLoader::MappedFile::checkSize(size_t requiredSize, const std::string &description) const
+{
+    if(m_Size < requiredSize) {
+        throw std::runtime_error("Binary file:" + m_Filename + " is " + std::to_string(m_Size) + " bytes but "
+                                 + description + " require " + std::to_string(requiredSize) + " bytes");
+    }
+}
+
+//----------------------------------------------------------------------------
+// SpineMLSimulator::BinaryLoader
+//----------------------------------------------------------------------------
+unsigned int SpineMLSimulator::BinaryLoader::getNumThreads(size_t numItems)
+{
+    // **NOTE** hardware_concurrency may return 0 if it can't be determined
+    const size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    return (unsigned int)std::max<size_t>(1, std::min(maxThreads, numItems / minItemsPerThread));
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::BinaryLoader::parallelFor(unsigned int numThreads, size_t numItems,
+                                                 std::function<void(unsigned int, size_t, size_t)> func)
+{
+    // Wrap function so exceptions are captured rather than terminating the process
+    std::vector<std::exception_ptr> exceptions(numThreads);
+    auto chunkFunc =
+        [numThreads, numItems, &func, &exceptions](unsigned int t)
+        {
+            try {
+                func(t, (numItems * t) / numThreads, (numItems * (t + 1)) / numThreads);
+            }
+            catch(...) {
+                exceptions[t] = std::current_exception();
+            }
+        };
+
+    // Launch threads to process all but first chunk and process first chunk on this thread
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for(unsigned int t = 1; t < numThreads; t++) {
+        threads.emplace_back(chunkFunc, t);
+    }
+    chunkFunc(0);
+
+    // Wait for all threads
+    for(auto &t : threads) {
+        t.join();
+    }
+
+    // Rethrow first exception
+    for(const auto &e : exceptions) {
+        if(e) {
+            std::rethrow_exception(e);
+        }
+    }
+}
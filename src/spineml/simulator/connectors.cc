@@ -2,16 +2,20 @@
 
 // Standard C++ includes
 #include <algorithm>
-#include <fstream>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <random>
+#include <stdexcept>
+#include <string>
 #include <tuple>
 #include <vector>
 
 // Standard C includes
 #include <cassert>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 
 // Filesystem includes
 #include "path.h"
@@ -22,6 +26,9 @@
 // SpineML common includes
 #include "spineMLLogging.h"
 
+// SpineML simulator includes
+#include "binaryLoader.h"
+
 //------------------------------------------------------------------------
 // Anonymous namespace
 //------------------------------------------------------------------------
@@ -43,17 +50,11 @@ void createListSparse(const pugi::xml_node &node, double dt, unsigned int numPre
     std::fill_n(rowLength, numPre, 0);
 
     // Create array with matching dimensions to ind, initially filled with invalid value
-    std::vector<unsigned int> originalOrder(numPre * maxRowLength,
+    std::vector<unsigned int> originalOrder((size_t)numPre * maxRowLength,
                                             std::numeric_limits<unsigned int>::max());
 
     // If connectivity is specified using a binary file
     if(binaryFile) {
-        // Create approximately 1Mbyte buffer to hold pre and postsynaptic indices
-        // **NOTE** this is also a multiple of both 2 and 3 so
-        // will hold a whole number of either format of synapse
-        const unsigned int bufferSize = 2 * 3 * 43690;
-        std::vector<uint32_t> connectionBuffer(bufferSize);
-
         // If there are individual delays then each synapse is 3 words rather than 2
         const bool explicitDelay = (binaryFile.attribute("explicit_delay_flag").as_uint() != 0);
         const unsigned int wordsPerSynapse = explicitDelay ? 3 : 2;
@@ -66,51 +67,76 @@ void createListSparse(const pugi::xml_node &node, double dt, unsigned int numPre
         // Read binary connection filename from node
         std::string filename = (basePath / binaryFile.attribute("file_name").value()).str();
 
-        // Open file for binary IO
-        std::ifstream input(filename, std::ios::binary);
-        if(!input.good()) {
-            throw std::runtime_error("Cannot open binary connection file:" + filename);
-        }
-
-        // Loop through binary words
-        unsigned int i = 0;
-        for(size_t remainingWords = numConnections * wordsPerSynapse; remainingWords > 0;) {
-            // Read a block into buffer
-            const size_t blockWords = std::min<size_t>(bufferSize, remainingWords);
-            input.read(reinterpret_cast<char*>(connectionBuffer.data()), blockWords * sizeof(uint32_t));
-
-            // Check block was read succesfully
-            if((size_t)input.gcount() != (blockWords * sizeof(uint32_t))) {
-                throw std::runtime_error("Unexpected end of binary connection file");
-            }
-
-            // Loop through synapses in buffer
-            for(size_t w = 0; w < blockWords; w += wordsPerSynapse) {
-                const unsigned int pre = connectionBuffer[w];
-                const unsigned int post = connectionBuffer[w + 1];
-
-                // Add postsynaptic index to ragged data structure and record creation order
-                const size_t index = (pre * maxRowLength) + rowLength[pre];
-                ind[index] = post;
-                originalOrder[index] = i++;
-
-                // If this file contains explicit delays
-                if(explicitDelay) {
-                    // Cast delay word to float
-                    const float *synDelay = reinterpret_cast<float*>(&connectionBuffer[w + 2]);
-
-                    // Store in delay array
-                    (*delay)[index] = (uint8_t)std::round(*synDelay / dt);
+        // Map file and check it is large enough to contain all connections before reading any
+        SpineMLSimulator::BinaryLoader::MappedFile file(filename);
+        file.checkSize((size_t)numConnections * wordsPerSynapse * sizeof(uint32_t),
+                       std::to_string(numConnections) + " connections");
+        const uint32_t *connectionWords = reinterpret_cast<const uint32_t*>(file.getData());
+
+        // Each thread counts the synapses in each row within its chunk of the file
+        const unsigned int numThreads = SpineMLSimulator::BinaryLoader::getNumThreads(numConnections);
+        std::vector<std::vector<unsigned int>> threadRowOffsets(numThreads);
+        SpineMLSimulator::BinaryLoader::parallelFor(numThreads, numConnections,
+            [numPre, wordsPerSynapse, connectionWords, &threadRowOffsets](unsigned int t, size_t begin, size_t end)
+            {
+                std::vector<unsigned int> &rowCounts = threadRowOffsets[t];
+                rowCounts.assign(numPre, 0);
+                for(size_t s = begin; s < end; s++) {
+                    const unsigned int pre = connectionWords[s * wordsPerSynapse];
+                    if(pre >= numPre) {
+                        throw std::runtime_error("Binary connection file contains out of range presynaptic index " + std::to_string(pre));
+                    }
+                    rowCounts[pre]++;
                 }
-
-                // Increment row length
-                rowLength[pre]++;
-                assert(rowLength[pre] <= maxRowLength);
-            }
-
-            // Subtract words in block from totalConnectors
-            remainingWords -= blockWords;
-        }
+            });
+
+        // Turn counts into the offset within each row at which each thread's synapses start
+        // **NOTE** this keeps synapses in each row in file order, just as reading sequentially would
+        SpineMLSimulator::BinaryLoader::parallelFor(SpineMLSimulator::BinaryLoader::getNumThreads((size_t)numPre * numThreads), numPre,
+            [numThreads, maxRowLength, rowLength, &threadRowOffsets](unsigned int, size_t begin, size_t end)
+            {
+                for(size_t i = begin; i < end; i++) {
+                    unsigned int offset = 0;
+                    for(unsigned int t = 0; t < numThreads; t++) {
+                        const unsigned int count = threadRowOffsets[t][i];
+                        threadRowOffsets[t][i] = offset;
+                        offset += count;
+                    }
+
+                    if(offset > maxRowLength) {
+                        throw std::runtime_error("Binary connection file contains " + std::to_string(offset) + " synapses in row "
+                                                 + std::to_string(i) + " but maximum row length is " + std::to_string(maxRowLength));
+                    }
+                    rowLength[i] = offset;
+                }
+            });
+
+        // Each thread scatters its chunk of synapses directly into the ragged data structure
+        SpineMLSimulator::BinaryLoader::parallelFor(numThreads, numConnections,
+            [dt, ind, delay, maxRowLength, explicitDelay, wordsPerSynapse, connectionWords, &threadRowOffsets, &originalOrder]
+            (unsigned int t, size_t begin, size_t end)
+            {
+                std::vector<unsigned int> &rowOffsets = threadRowOffsets[t];
+                for(size_t s = begin; s < end; s++) {
+                    const uint32_t *synapseWords = &connectionWords[s * wordsPerSynapse];
+                    const unsigned int pre = synapseWords[0];
+
+                    // Add postsynaptic index to ragged data structure and record creation order
+                    const size_t index = ((size_t)pre * maxRowLength) + rowOffsets[pre]++;
+                    ind[index] = synapseWords[1];
+                    originalOrder[index] = (unsigned int)s;
+
+                    // If this file contains explicit delays
+                    if(explicitDelay) {
+                        // Copy delay word into float
+                        float synDelay;
+                        std::memcpy(&synDelay, &synapseWords[2], sizeof(float));
+
+                        // Store in delay array
+                        (*delay)[index] = (uint8_t)std::round(synDelay / dt);
+                    }
+                }
+            });
     }
     // Otherwise loop through connections and add to projection
     else {
@@ -149,58 +175,64 @@ void createListSparse(const pugi::xml_node &node, double dt, unsigned int numPre
     // Reserve remap indices array to match number of connections
     remapIndices.resize(numConnections);
 
-    // Create array of row indices to use for sorting each row
-    std::vector<unsigned int> rowOrder(maxRowLength);
-    std::vector<unsigned int> rowIndCopy(maxRowLength);
-    std::vector<uint8_t> rowDelayCopy(maxRowLength);
-
-    // Loop through rows
-    for(unsigned int i = 0; i < numPre; i++) {
-        // Get pointer to start of row indices
-        unsigned int *rowIndBegin = &ind[i * maxRowLength];
-
-        // Copy row indices into vector
-        // **NOTE** reordering in place is non-trivial
-        std::copy_n(rowIndBegin, rowLength[i], rowIndCopy.begin());
-
-        // Get iterator to end of section of row order to use for this row
-        auto rowOrderEnd = rowOrder.begin();
-        std::advance(rowOrderEnd, rowLength[i]);
-
-        // Fill section with 0, 1, ..., N
-        std::iota(rowOrder.begin(), rowOrderEnd, 0);
-
-        // Sort row order based on postsynaptic indices
-        std::sort(rowOrder.begin(), rowOrderEnd,
-                  [&rowIndCopy](unsigned int a, unsigned int b)
-                  {
-                      return (rowIndCopy[a] < rowIndCopy[b]);
-                  });
-
-        // Use row order to re-order row indices back into original data structure
-        std::transform(rowOrder.cbegin(), rowOrder.cend(), rowIndBegin,
-                       [&rowIndCopy](unsigned int ord){ return rowIndCopy[ord]; });
-
-        // If a delay array is present
-        if(delay) {
-            // Get pointer to start of row delays
-            uint8_t *rowDelayBegin = &(*delay)[i * maxRowLength];
-
-            // Copy row indices into vector
-            // **NOTE** reordering in place is non-trivial
-            std::copy_n(rowDelayBegin, rowLength[i], rowDelayCopy.begin());
-
-            // Use row order to re-order row delays back into original data structure
-            std::transform(rowOrder.cbegin(), rowOrder.cend(), rowDelayBegin,
-                           [&rowDelayCopy](unsigned int ord){ return rowDelayCopy[ord]; });
-        }
+    // Sort rows in parallel, splitting them between threads
+    SpineMLSimulator::BinaryLoader::parallelFor(SpineMLSimulator::BinaryLoader::getNumThreads(numConnections), numPre,
+        [rowLength, ind, delay, maxRowLength, &originalOrder, &remapIndices](unsigned int, size_t begin, size_t end)
+        {
+            // Create array of row indices to use for sorting each row
+            std::vector<unsigned int> rowOrder(maxRowLength);
+            std::vector<unsigned int> rowIndCopy(maxRowLength);
+            std::vector<uint8_t> rowDelayCopy(maxRowLength);
+
+            // Loop through rows
+            for(size_t i = begin; i < end; i++) {
+                // Get pointer to start of row indices
+                const size_t rowStart = i * maxRowLength;
+                unsigned int *rowIndBegin = &ind[rowStart];
+
+                // Copy row indices into vector
+                // **NOTE** reordering in place is non-trivial
+                std::copy_n(rowIndBegin, rowLength[i], rowIndCopy.begin());
+
+                // Get iterator to end of section of row order to use for this row
+                auto rowOrderEnd = rowOrder.begin();
+                std::advance(rowOrderEnd, rowLength[i]);
+
+                // Fill section with 0, 1, ..., N
+                std::iota(rowOrder.begin(), rowOrderEnd, 0);
+
+                // Sort row order based on postsynaptic indices
+                std::sort(rowOrder.begin(), rowOrderEnd,
+                          [&rowIndCopy](unsigned int a, unsigned int b)
+                          {
+                              return (rowIndCopy[a] < rowIndCopy[b]);
+                          });
+
+                // Use row order to re-order row indices back into original data structure
+                std::transform(rowOrder.begin(), rowOrderEnd, rowIndBegin,
+                               [&rowIndCopy](unsigned int ord){ return rowIndCopy[ord]; });
+
+                // If a delay array is present
+                if(delay) {
+                    // Get pointer to start of row delays
+                    uint8_t *rowDelayBegin = &(*delay)[rowStart];
+
+                    // Copy row indices into vector
+                    // **NOTE** reordering in place is non-trivial
+                    std::copy_n(rowDelayBegin, rowLength[i], rowDelayCopy.begin());
+
+                    // Use row order to re-order row delays back into original data structure
+                    std::transform(rowOrder.begin(), rowOrderEnd, rowDelayBegin,
+                                   [&rowDelayCopy](unsigned int ord){ return rowDelayCopy[ord]; });
+                }
 
-        // Loop through synapses in newly reorderd row and set the remap index in the 
-        // synapse's ORIGINAL location to its new index in the ragged array
-        for(unsigned int j = 0; j < rowLength[i]; j++) {
-            remapIndices[originalOrder[(i * maxRowLength) + rowOrder[j]]] = (i * maxRowLength) + j;
-        }
-    }
+                // Loop through synapses in newly reorderd row and set the remap index in the
+                // synapse's ORIGINAL location to its new index in the ragged array
+                for(unsigned int j = 0; j < rowLength[i]; j++) {
+                    remapIndices[originalOrder[rowStart + rowOrder[j]]] = (unsigned int)(rowStart + j);
+                }
+            }
+        });
 }
 }   // anonymous namespace
 
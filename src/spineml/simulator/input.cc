@@ -1,6 +1,7 @@
 #include "input.h"
 
 // Standard C++ includes
+#include <algorithm>
 #include <limits>
 #include <iostream>
 
@@ -17,6 +18,15 @@
 #include "inputValue.h"
 #include "modelProperty.h"
 
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Number of buckets in timing wheel used to schedule interspike interval inputs
+const unsigned int timingWheelSize = 1024;
+}
+
 //----------------------------------------------------------------------------
 // SpineMLSimulator::Input::Base
 //----------------------------------------------------------------------------
@@ -87,7 +97,9 @@ void SpineMLSimulator::Input::SpikeBase::uploadSpikes()
 SpineMLSimulator::Input::InterSpikeIntervalBase::InterSpikeIntervalBase(double dt, const pugi::xml_node &node, std::unique_ptr<InputValue::Base> value,
                                                                         unsigned int popSize, unsigned int *spikeQueuePtr, unsigned int *hostSpikeCount, unsigned int *hostSpikes,
                                                                         PushCurrentSpikesFunc pushCurrentSpikes)
-: SpikeBase(dt, node, std::move(value), popSize, spikeQueuePtr, hostSpikeCount, hostSpikes, pushCurrentSpikes)
+: SpikeBase(dt, node, std::move(value), popSize, spikeQueuePtr, hostSpikeCount, hostSpikes, pushCurrentSpikes),
+  m_CurrentTimestep(0), m_ISI(popSize, 0.0), m_DueTimestep(popSize, 0.0), m_SpikeTimestep(popSize, 0),
+  m_Sequence(popSize, 0), m_TimingWheel(timingWheelSize)
 {
 }
 //----------------------------------------------------------------------------
@@ -98,52 +110,72 @@ void SpineMLSimulator::Input::InterSpikeIntervalBase::apply(double dt, unsigned
     updateValues(dt, timestep,
         [this, dt](unsigned int neuronID, double rate)
         {
-            // If we're turning off spike source, remove it from map
+            // Convert rate into interspike interval
+            const double isiMs = (rate == 0.0) ? 0.0 : (1000.0 / rate);
+
+            // If rate hasn't changed, leave neuron's scheduled spike alone
+            if(isiMs == m_ISI[neuronID]) {
+                return;
+            }
+            m_ISI[neuronID] = isiMs;
+
+            // If we're turning off spike source, make any scheduled spike stale
             if(rate == 0.0) {
-                m_TimeToSpike.erase(neuronID);
+                m_Sequence[neuronID]++;
             }
-            // Otherwise
+            // Otherwise, reschedule neuron's spike at time to first spike with new interspike interval
             else {
-                // Convert rate into interspike interval and calculate time to first spike
-                const double isiMs = 1000.0 / rate;
-                const double tts = getTimeToSpike(isiMs);
-
-                // If this neuron has not had a rate set before, add it to map
-                auto neuronTTS = m_TimeToSpike.find(neuronID);
-                if(neuronTTS == m_TimeToSpike.end()) {
-                    m_TimeToSpike.insert(std::make_pair(neuronID, std::make_pair(isiMs, tts)));
-                }
-                // Otherwise, update it's ISI to the new one and also reset it's time to spike
-                else {
-                    neuronTTS->second.first = isiMs;
-                    neuronTTS->second.second = tts;
-                }
+                scheduleSpike(neuronID, (double)m_CurrentTimestep + (getTimeToSpike(isiMs) / dt), m_CurrentTimestep);
             }
         });
 
     // If we should be applying input during this timestep
     if(shouldApply(timestep)) {
-        // Loop through all times to spike
-        for(auto &tts : m_TimeToSpike) {
-            // If this neuron should spike this timestep
-            if(tts.second.second <= 0.0) {
-                // Add on time until next spike
-                // **NOTE** this means sub-timestep remainders don't get ignored
-                tts.second.second += getTimeToSpike(tts.second.first);
+        // Swap bucket of timing wheel for this timestep with (empty) current bucket
+        // **NOTE** this means neurons can be rescheduled into this bucket while we're processing it
+        m_CurrentBucket.clear();
+        std::swap(m_CurrentBucket, m_TimingWheel[m_CurrentTimestep % timingWheelSize]);
 
-                // Inject spike
-                injectSpike(tts.first);
+        // Loop through neurons scheduled in bucket
+        for(const auto &n : m_CurrentBucket) {
+            // Skip stale entries left behind by rate changes
+            if(n.second != m_Sequence[n.first]) {
+                continue;
             }
 
-            // Decrement time-to-spike
-            tts.second.second -= dt;
+            // If neuron is scheduled to spike during a later rotation of the wheel, put it back
+            if(m_SpikeTimestep[n.first] != m_CurrentTimestep) {
+                m_TimingWheel[m_CurrentTimestep % timingWheelSize].push_back(n);
+            }
+            // Otherwise
+            else {
+                // Inject spike
+                injectSpike(n.first);
+
+                // Schedule next spike relative to when this one was due
+                // **NOTE** this means sub-timestep remainders don't get ignored
+                scheduleSpike(n.first, m_DueTimestep[n.first] + (getTimeToSpike(m_ISI[n.first]) / dt), m_CurrentTimestep + 1);
+            }
         }
 
+        // Advance time
+        m_CurrentTimestep++;
+
         // Upload spikes to GPU if required
         uploadSpikes();
     }
 }
+//----------------------------------------------------------------------------
+void SpineMLSimulator::Input::InterSpikeIntervalBase::scheduleSpike(unsigned int neuronID, double dueTimestep, unsigned long long earliestTimestep)
+{
+    // Update when spike is due and hence which timestep it should be emitted in
+    m_DueTimestep[neuronID] = dueTimestep;
+    m_SpikeTimestep[neuronID] = std::max(earliestTimestep, (unsigned long long)std::ceil(dueTimestep));
 
+    // Update sequence number, making any existing entry stale, and add neuron to bucket
+    m_Sequence[neuronID]++;
+    m_TimingWheel[m_SpikeTimestep[neuronID] % timingWheelSize].emplace_back(neuronID, m_Sequence[neuronID]);
+}
 
 //----------------------------------------------------------------------------
 // SpineMLSimulator::Input::RegularSpikeRate
@@ -8,6 +8,7 @@
 // Standard C includes
 #include <cassert>
 #include <cmath>
+#include <cstring>
 
 // Filesystem includes
 #include "path.h"
@@ -46,6 +47,9 @@ struct SpineMLTypeName<double>
 // **YUCK** Visual C++ doesn't support constexpr so need to do this the old way
 const char *SpineMLTypeName<float>::name = "float";
 //const char *SpineMLTypeName<double>::name = "double";
+
+// How many timesteps of snapshots can be waiting to be written to each log file
+const unsigned int numLogBuffers = 16;
 }
 
 //----------------------------------------------------------------------------
@@ -103,8 +107,16 @@ SpineMLSimulator::LogOutput::AnalogueFile::AnalogueFile(const pugi::xml_node &no
                                                         const ModelProperty::Base *modelProperty)
     : AnalogueBase(node, dt, modelProperty)
 {
-    // If indices are specified, allocate output buffer to match indices
-    if(!getIndices().empty()) {
+    // If no indices are specified, snapshot entire model property
+    if(getIndices().empty()) {
+        m_WindowStart = 0;
+        m_WindowSize = getModelPropertySize();
+    }
+    // Otherwise, snapshot window between minimum and maximum index and allocate output buffer to match indices
+    else {
+        const auto minMaxIndex = std::minmax_element(getIndices().cbegin(), getIndices().cend());
+        m_WindowStart = *minMaxIndex.first;
+        m_WindowSize = *minMaxIndex.second - *minMaxIndex.first + 1;
         m_OutputBuffer.resize(getIndices().size());
     }
 
@@ -150,8 +162,28 @@ SpineMLSimulator::LogOutput::AnalogueFile::AnalogueFile(const pugi::xml_node &no
 
     LOGD_SPINEML << "\tAnalogue file log:" << absoluteFileTitle << "_log.bin";
 
-    // Open file for binary writing
-    m_File.open(absoluteFileTitle + "_log.bin", std::ios::binary);
+    // Open file for binary writing in background
+    m_Writer.reset(new AsyncWriter(absoluteFileTitle + "_log.bin", std::ios::binary, sizeof(scalar) * m_WindowSize, numLogBuffers,
+        [this](std::ofstream &file, const char *snapshot, size_t size)
+        {
+            // If no indices are specified, directly write out snapshot of model property
+            if(getIndices().empty()) {
+                file.write(snapshot, size);
+            }
+            // Otherwise
+            else {
+                // Transform indexed variables from snapshot into output buffer so they can be written in one call
+                const scalar *window = reinterpret_cast<const scalar*>(snapshot);
+                std::transform(getIndices().begin(), getIndices().end(), m_OutputBuffer.begin(),
+                               [this, window](unsigned int i)
+                               {
+                                   return window[i - m_WindowStart];
+                               });
+
+                // Write output buffer to file
+                file.write(reinterpret_cast<char*>(m_OutputBuffer.data()), sizeof(scalar) * m_OutputBuffer.size());
+            }
+        }));
 }
 //----------------------------------------------------------------------------
 void SpineMLSimulator::LogOutput::AnalogueFile::record(double, unsigned long long timestep)
@@ -159,25 +191,13 @@ void SpineMLSimulator::LogOutput::AnalogueFile::record(double, unsigned long lon
     // If we should be recording this timestep
     if(shouldRecord(timestep)) {
         // Pull state variable from device
-        // **TODO** simple min/max index optimisation
         pullModelPropertyFromDevice();
 
-        // If no indices are specified, directly write out data from model property
-        if(getIndices().empty()) {
-            m_File.write(reinterpret_cast<const char*>(getStateVarBegin()), sizeof(scalar) * getModelPropertySize());
-        }
-        // Otherwise
-        else {
-            // Transform indexed variables into output buffer so they can be written in one call
-            std::transform(getIndices().begin(), getIndices().end(), m_OutputBuffer.begin(),
-                           [this](unsigned int i)
-                           {
-                               return getStateVarBegin()[i];
-                           });
-
-            // Write output buffer to file
-            m_File.write(reinterpret_cast<char*>(m_OutputBuffer.data()), sizeof(scalar) * m_OutputBuffer.size());
-        }
+        // Snapshot window of state variable and pass it to writer thread
+        // **NOTE** this blocks if writer thread has fallen too far behind
+        char *snapshot = m_Writer->acquireBuffer();
+        std::memcpy(snapshot, getStateVarBegin() + m_WindowStart, m_Writer->getBufferSize());
+        m_Writer->commitBuffer(m_Writer->getBufferSize());
     }
 }
 
@@ -250,12 +270,15 @@ SpineMLSimulator::LogOutput::AnalogueNetwork::AnalogueNetwork(const pugi::xml_no
     const std::string connectionName = node.attribute("name").value();
     const std::string hostname = node.attribute("host").value();
     const unsigned int tcpPort = node.attribute("tcp_port").as_uint();
+    const unsigned int batchTimesteps = node.attribute("batch_timesteps").as_uint(1);
+    const bool sharedMemory = node.attribute("shared_memory").as_bool();
 
     LOGD_SPINEML << "\tAnalogue network log '" << connectionName << "' (" << hostname << ":" << tcpPort << ")";
+    LOGD_SPINEML << "\t\tBatch timesteps:" << batchTimesteps << ", shared memory:" << sharedMemory;
 
     // Attempt to connect network client
     if(!m_Client.connect(hostname, tcpPort, size, NetworkClient::DataType::Analogue,
-        NetworkClient::Mode::Source, connectionName))
+        NetworkClient::Mode::Source, connectionName, batchTimesteps, sharedMemory))
     {
         throw std::runtime_error("Cannot connect network client");
     }
@@ -359,8 +382,22 @@ SpineMLSimulator::LogOutput::Event::Event(const pugi::xml_node &node, double dt,
 
     LOGD_SPINEML << "\tEvent log:" << absoluteFileTitle << ".csv";
 
-    // Open CSV file
-    m_File.open(absoluteFileTitle + "_log.csv");
+    // Open CSV file for writing in background
+    // **NOTE** snapshots consist of the time followed by the IDs of the neurons which spiked
+    m_Writer.reset(new AsyncWriter(absoluteFileTitle + "_log.csv", std::ios::out, sizeof(double) + (sizeof(unsigned int) * popSize), numLogBuffers,
+        [this](std::ofstream &file, const char *snapshot, size_t size)
+        {
+            double t;
+            std::memcpy(&t, snapshot, sizeof(double));
+            const unsigned int *spikes = reinterpret_cast<const unsigned int*>(snapshot + sizeof(double));
+            const size_t numSpikes = (size - sizeof(double)) / sizeof(unsigned int);
+
+            for(size_t i = 0; i < numSpikes; i++) {
+                if(m_Indices.empty() || m_Indices.find(spikes[i]) != m_Indices.end()) {
+                    file << t << "," << spikes[i] << "\n";
+                }
+            }
+        }));
 }
 //----------------------------------------------------------------------------
 void SpineMLSimulator::LogOutput::Event::record(double dt, unsigned long long timestep)
@@ -374,22 +411,13 @@ void SpineMLSimulator::LogOutput::Event::record(double dt, unsigned long long ti
         // Pull current spikes from device
         m_PullCurrentSpikesFunc();
 
+        // Snapshot time and current spikes and pass them to writer thread
+        // **NOTE** this blocks if writer thread has fallen too far behind
         const double t = dt * (double)timestep;
-
-        if(m_Indices.empty()) {
-            for(unsigned int i = 0; i < m_HostSpikeCount[spikeQueueIndex]; i++)
-            {
-                m_File << t << "," << m_HostSpikes[spikeOffset + i] << std::endl;
-            }
-        }
-        else {
-            for(unsigned int i = 0; i < m_HostSpikeCount[spikeQueueIndex]; i++)
-            {
-                const unsigned int spikeID = m_HostSpikes[spikeOffset + i];
-                if(m_Indices.find(spikeID) != m_Indices.end()) {
-                    m_File << t << "," << spikeID << std::endl;
-                }
-            }
-        }
+        const size_t spikeBytes = sizeof(unsigned int) * m_HostSpikeCount[spikeQueueIndex];
+        char *snapshot = m_Writer->acquireBuffer();
+        std::memcpy(snapshot, &t, sizeof(double));
+        std::memcpy(snapshot + sizeof(double), &m_HostSpikes[spikeOffset], spikeBytes);
+        m_Writer->commitBuffer(sizeof(double) + spikeBytes);
     }
 }
@@ -2,11 +2,13 @@
 
 // Standard C++ includes
 #include <algorithm>
-#include <fstream>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
 // Standard C includes
 #include <cassert>
+#include <cstdint>
 #include <cstring>
 
 // Filesystem includes
@@ -18,6 +20,9 @@
 // SpineML common includes
 #include "spineMLLogging.h"
 
+// SpineML simulator includes
+#include "binaryLoader.h"
+
 //------------------------------------------------------------------------
 // SpineMLSimulator::ModelProperty::Fixed
 //------------------------------------------------------------------------
@@ -52,39 +57,50 @@ SpineMLSimulator::ModelProperty::ValueList::ValueList(const pugi::xml_node &node
                                                       const std::vector<unsigned int> *remapIndices, const StateVar<scalar> &stateVar, unsigned int size)
     : Base(stateVar, size)
 {
-    // Allocate vector to hold values
-    // **NOTE** If we're remapping to a padded sparse matrix we want the size of
-    // our values to match the number of connections rather than the padded size
-    const size_t valueSize =  (remapIndices == nullptr) ? size : remapIndices->size();
-    std::vector<scalar> values(valueSize);
-
     // If there's a binary file
     auto binaryFile = node.child("BinaryFile");
     if(binaryFile) {
-        // Check number of elements matches
         const unsigned int numElements =  binaryFile.attribute("num_elements").as_uint();
         const std::string filename = (basePath / binaryFile.attribute("file_name").value()).str();
 
-        // Open file for binary IO
-        // **TODO** basepath here
-        std::ifstream input(filename, std::ios::binary);
-        if(!input.good()) {
-            throw std::runtime_error("Cannot open binary model property file:" + filename);
-        }
+        // Map file and check it is large enough to contain all elements before reading any
+        // **NOTE** each element is a packed 32-bit index followed by a 64-bit value
+        const size_t elementBytes = sizeof(uint32_t) + sizeof(double);
+        BinaryLoader::MappedFile file(filename);
+        file.checkSize((size_t)numElements * elementBytes, std::to_string(numElements) + " model property values");
+        const char *elements = file.getData();
 
-        // Loop through elements in file
-        for(unsigned int i = 0; i < numElements; i++) {
-            // Read index and value
-            // **TODO** this is probably a very sub-optimal way of doing this
-            uint32_t index;
-            input.read(reinterpret_cast<char*>(&index), sizeof(uint32_t));
-            double value;
-            input.read(reinterpret_cast<char*>(&value), sizeof(double));
-
-            // Check index is safe and set value
-            assert(index < valueSize);
-            values[index] = value;
-        }
+        // Underlying values should be the size of the property
+        m_Values.resize(getSize());
+
+        // Scatter elements in parallel directly to their (remapped) location
+        // **NOTE** If we're remapping to a padded sparse matrix, indices in the file
+        // refer to connections rather than locations in the padded matrix
+        const size_t numIndices =  (remapIndices == nullptr) ? getSize() : remapIndices->size();
+        BinaryLoader::parallelFor(BinaryLoader::getNumThreads(numElements), numElements,
+            [elements, elementBytes, numIndices, remapIndices, this](unsigned int, size_t begin, size_t end)
+            {
+                for(size_t i = begin; i < end; i++) {
+                    // Copy unaligned index and value out of file
+                    uint32_t index;
+                    double value;
+                    std::memcpy(&index, &elements[i * elementBytes], sizeof(uint32_t));
+                    std::memcpy(&value, &elements[(i * elementBytes) + sizeof(uint32_t)], sizeof(double));
+
+                    // Check index is safe and set value
+                    if(index >= numIndices) {
+                        throw std::runtime_error("Binary model property file contains out of range index " + std::to_string(index));
+                    }
+                    m_Values[(remapIndices == nullptr) ? index : (*remapIndices)[index]] = (scalar)value;
+                }
+            });
+
+        // Copy vector of values into state variable
+        std::copy(m_Values.begin(), m_Values.end(),
+                  getHostStateVar());
+
+        // Push to device
+        pushToDevice();
 
         LOGD_SPINEML << "\t\t\tValue list (from file)";
     }
@@ -92,13 +108,19 @@ SpineMLSimulator::ModelProperty::ValueList::ValueList(const pugi::xml_node &node
     else {
         LOGD_SPINEML << "\t\t\tValue list (inline)";
 
+        // Allocate vector to hold values
+        // **NOTE** If we're remapping to a padded sparse matrix we want the size of
+        // our values to match the number of connections rather than the padded size
+        const size_t valueSize =  (remapIndices == nullptr) ? size : remapIndices->size();
+        std::vector<scalar> values(valueSize);
+
         // Loop through inline values
         for(const auto v : node.children("Value")) {
             values[v.attribute("index").as_uint()] = v.attribute("value").as_double();
         }
-    }
 
-    setValue(values, remapIndices);
+        setValue(values, remapIndices);
+    }
 }
 //------------------------------------------------------------------------
 void SpineMLSimulator::ModelProperty::ValueList::setValue(const std::vector<scalar> &values, const std::vector<unsigned int> *remapIndices)
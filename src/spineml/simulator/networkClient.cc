@@ -1,30 +1,54 @@
 #include "networkClient.h"
 
 // Standard C++ includes
+#include <algorithm>
+#include <new>
 #include <stdexcept>
 
 // Standard C includes
+#include <cerrno>
 #include <cstring>
 
+// POSIX includes
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+#endif
+
 // SpineML common includes
 #include "spineMLLogging.h"
 
 //----------------------------------------------------------------------------
 // SpineMLSimulator::NetworkClient
 //----------------------------------------------------------------------------
-SpineMLSimulator::NetworkClient::NetworkClient() : m_Socket(-1)
+SpineMLSimulator::NetworkClient::NetworkClient()
+:   m_Socket(-1), m_Mode(Mode::Source), m_Size(0), m_BatchTimesteps(1), m_BatchNumTimesteps(0), m_BatchPosition(0),
+    m_NumUnacknowledgedBatches(0), m_SharedRing(nullptr), m_SharedRingBytes(0)
 {
 }
 //----------------------------------------------------------------------------
-SpineMLSimulator::NetworkClient::NetworkClient(const std::string &hostname, unsigned int port, unsigned int size, DataType dataType, Mode mode, const std::string &connectionName)
+SpineMLSimulator::NetworkClient::NetworkClient(const std::string &hostname, unsigned int port, unsigned int size, DataType dataType, Mode mode, const std::string &connectionName,
+                                               unsigned int batchTimesteps, bool sharedMemory)
+:   NetworkClient()
 {
-    if(!connect(hostname, port, size, dataType, mode, connectionName)) {
+    if(!connect(hostname, port, size, dataType, mode, connectionName, batchTimesteps, sharedMemory)) {
         throw std::runtime_error("Cannot connect network client");
     }
 }
 //----------------------------------------------------------------------------
 SpineMLSimulator::NetworkClient::~NetworkClient()
 {
+    // Send any remaining data
+    if(!flush()) {
+        LOGE_SPINEML << "Unable to flush network client";
+    }
+
+    // Let remote host know we're finished with shared ring and unmap it
+    if(m_SharedRing != nullptr) {
+        m_SharedRing->state.store(RingState::Finished, std::memory_order_release);
+        destroySharedRing();
+    }
+
     // Close socket
     if(m_Socket >= 0) {
 #ifdef _WIN32
@@ -35,8 +59,16 @@ SpineMLSimulator::NetworkClient::~NetworkClient()
     }
 }
 //----------------------------------------------------------------------------
-bool SpineMLSimulator::NetworkClient::connect(const std::string &hostname, unsigned int port, unsigned int size, DataType dataType, Mode mode, const std::string &connectionName)
+bool SpineMLSimulator::NetworkClient::connect(const std::string &hostname, unsigned int port, unsigned int size, DataType dataType, Mode mode, const std::string &connectionName,
+                                              unsigned int batchTimesteps, bool sharedMemory)
 {
+    m_Mode = mode;
+    m_Size = size;
+    m_BatchTimesteps = std::max(1u, batchTimesteps);
+
+    // Batched protocol is required to batch timesteps or use shared memory
+    const bool batched = (m_BatchTimesteps > 1 || sharedMemory);
+
     // Create socket
     m_Socket = socket(AF_INET, SOCK_STREAM, 0);
     if(m_Socket < 0) {
@@ -65,6 +97,18 @@ bool SpineMLSimulator::NetworkClient::connect(const std::string &hostname, unsig
         return false;
     }
 
+    // If batched protocol is required, check remote host supports it
+    if(batched) {
+        Response extensionResponse;
+        if(!sendRequestReadResponse(Extension::Batched, extensionResponse)) {
+            return false;
+        }
+        if(extensionResponse != Response::Hello) {
+            LOGE_SPINEML << "Remote host does not support batched protocol";
+            return false;
+        }
+    }
+
     // Handshake
     Response handshakeResponse;
     if(!sendRequestReadResponse(mode, handshakeResponse)) {
@@ -109,12 +153,66 @@ bool SpineMLSimulator::NetworkClient::connect(const std::string &hostname, unsig
         return false;
     }
 
+    // If batched protocol is in use
+    if(batched) {
+        // Send number of timesteps per batch
+        Response batchResponse;
+        if(!sendRequestReadResponse(m_BatchTimesteps, batchResponse)) {
+            return false;
+        }
+        // Check it's not an abort
+        if(batchResponse == Response::Abort) {
+            LOGE_SPINEML << "Remote host aborted";
+            return false;
+        }
+
+        // Create shared ring if required and send its name
+        // **NOTE** empty name requests batches are sent over TCP
+        std::string ringName;
+        if(sharedMemory && !createSharedRing(ringName)) {
+            return false;
+        }
+        Response ringResponse;
+        const bool ringSent = sendRequestReadResponse(ringName, ringResponse);
+
+#ifndef _WIN32
+        // Remote host will have mapped the ring by now so remove its name
+        if(sharedMemory) {
+            shm_unlink(ringName.c_str());
+        }
+#endif
+        if(!ringSent) {
+            return false;
+        }
+        // Check it's not an abort
+        if(ringResponse == Response::Abort) {
+            LOGE_SPINEML << "Remote host aborted";
+            return false;
+        }
+
+        // Allocate batch
+        m_Batch.resize((size_t)m_Size * m_BatchTimesteps);
+    }
+
     // Success!
     return true;
 }
 //----------------------------------------------------------------------------
 bool SpineMLSimulator::NetworkClient::receive(std::vector<double> &buffer)
 {
+    // If batched protocol is in use
+    if(!m_Batch.empty()) {
+        // If all timesteps in current batch have been used, receive next batch
+        if(m_BatchPosition == m_BatchNumTimesteps && !receiveBatch()) {
+            return false;
+        }
+
+        // Copy next timestep out of batch
+        std::copy_n(&m_Batch[(size_t)m_BatchPosition * m_Size], m_Size, buffer.begin());
+        m_BatchPosition++;
+        return true;
+    }
+
     // Get buffer size and write pointer as bytes
     const int bufferSizeBytes = buffer.size() * sizeof(double);
     char *bufferBytes = reinterpret_cast<char*>(buffer.data());
@@ -149,6 +247,16 @@ bool SpineMLSimulator::NetworkClient::receive(std::vector<double> &buffer)
 //----------------------------------------------------------------------------
 bool SpineMLSimulator::NetworkClient::send(const std::vector<double> &buffer)
 {
+    // If batched protocol is in use
+    if(!m_Batch.empty()) {
+        // Copy timestep into batch
+        std::copy_n(buffer.cbegin(), m_Size, &m_Batch[(size_t)m_BatchNumTimesteps * m_Size]);
+        m_BatchNumTimesteps++;
+
+        // Send batch if it's full
+        return (m_BatchNumTimesteps == m_BatchTimesteps) ? sendBatch() : true;
+    }
+
     // Start non-blocking send mode and get flags for send (if any)
     const int sendFlags = startNonBlockingSend();
 
@@ -218,3 +326,236 @@ bool SpineMLSimulator::NetworkClient::sendRequestReadResponse(const std::string
 
     return true;
 }
+//----------------------------------------------------------------------------
+bool SpineMLSimulator::NetworkClient::flush()
+{
+    // Only sources using the batched protocol have anything to flush
+    if(m_Batch.empty() || m_Mode != Mode::Source) {
+        return true;
+    }
+
+    // Send partially-filled batch
+    if(m_BatchNumTimesteps > 0 && !sendBatch()) {
+        return false;
+    }
+
+    // Wait for remote host to empty shared ring
+    if(m_SharedRing != nullptr) {
+        const uint32_t head = m_SharedRing->head.load(std::memory_order_relaxed);
+        if(!waitForSharedRing([this, head](){ return (m_SharedRing->tail.load(std::memory_order_acquire) == head); }, false)) {
+            return false;
+        }
+    }
+    // Otherwise, wait for all batches sent over TCP to be acknowledged
+    else {
+        while(m_NumUnacknowledgedBatches > 0) {
+            if(!receiveResponse()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+//----------------------------------------------------------------------------
+bool SpineMLSimulator::NetworkClient::sendAll(const char *data, size_t size)
+{
+    for(size_t totalSentBytes = 0; totalSentBytes < size;) {
+        const int sentBytes = ::send(m_Socket, data + totalSentBytes, (int)(size - totalSentBytes), 0);
+        if(sentBytes < 1) {
+            LOGE_SPINEML << "Error writing to socket";
+            return false;
+        }
+        totalSentBytes += sentBytes;
+    }
+    return true;
+}
+//----------------------------------------------------------------------------
+bool SpineMLSimulator::NetworkClient::receiveAll(char *data, size_t size)
+{
+    for(size_t totalReceivedBytes = 0; totalReceivedBytes < size;) {
+        const int receivedBytes = ::recv(m_Socket, data + totalReceivedBytes, (int)(size - totalReceivedBytes), MSG_WAITALL);
+        if(receivedBytes < 1) {
+            LOGE_SPINEML << "Error reading from socket";
+            return false;
+        }
+        totalReceivedBytes += receivedBytes;
+    }
+    return true;
+}
+//----------------------------------------------------------------------------
+bool SpineMLSimulator::NetworkClient::receiveResponse()
+{
+    // Read acknowledgement of oldest unacknowledged batch
+    Response response;
+    if(!receiveAll(reinterpret_cast<char*>(&response), sizeof(Response))) {
+        return false;
+    }
+    m_NumUnacknowledgedBatches--;
+
+    // If response is an abort - error
+    if(response == Response::Abort) {
+        LOGE_SPINEML << "Remote host aborted";
+        return false;
+    }
+    else {
+        return true;
+    }
+}
+//----------------------------------------------------------------------------
+bool SpineMLSimulator::NetworkClient::createSharedRing(std::string &name)
+{
+#ifdef _WIN32
+    LOGE_SPINEML << "Shared memory transport is not supported on Windows";
+    return false;
+#else
+    // Build unique name
+    static std::atomic<unsigned int> numRings{0};
+    name = "/spineml_" + std::to_string(getpid()) + "_" + std::to_string(numRings++);
+
+    // Create shared memory object
+    const int file = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if(file == -1) {
+        LOGE_SPINEML << "Unable to create shared memory " << name;
+        return false;
+    }
+
+    // Size it to hold header and slots and map it
+    const size_t slotBytes = getSharedRingSlotBytes(m_Size, m_BatchTimesteps);
+    m_SharedRingBytes = sizeof(SharedRingHeader) + (slotBytes * numBatchesInFlight);
+    void *ring = MAP_FAILED;
+    if(ftruncate(file, m_SharedRingBytes) == 0) {
+        ring = mmap(nullptr, m_SharedRingBytes, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    }
+    close(file);
+    if(ring == MAP_FAILED) {
+        LOGE_SPINEML << "Unable to map shared memory " << name;
+        shm_unlink(name.c_str());
+        return false;
+    }
+
+    // Initialise header
+    m_SharedRing = new (ring) SharedRingHeader;
+    m_SharedRing->head.store(0, std::memory_order_relaxed);
+    m_SharedRing->tail.store(0, std::memory_order_relaxed);
+    m_SharedRing->state.store(RingState::Running, std::memory_order_relaxed);
+    m_SharedRing->slotBytes = (uint32_t)slotBytes;
+    return true;
+#endif
+}
+//----------------------------------------------------------------------------
+void SpineMLSimulator::NetworkClient::destroySharedRing()
+{
+#ifndef _WIN32
+    munmap(m_SharedRing, m_SharedRingBytes);
+#endif
+    m_SharedRing = nullptr;
+}
+//----------------------------------------------------------------------------
+bool SpineMLSimulator::NetworkClient::isRemoteHostConnected()
+{
+#ifdef _WIN32
+    // Shared memory transport, the only user of this check, isn't supported on Windows
+    return true;
+#else
+    // Peek at socket without blocking - if remote host has disconnected, this will return 0 or fail
+    // **NOTE** remote host doesn't send anything over the socket while the shared ring is in use
+    char data;
+    const ssize_t receivedBytes = ::recv(m_Socket, &data, sizeof(char), MSG_PEEK | MSG_DONTWAIT);
+    return (receivedBytes > 0 || (receivedBytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)));
+#endif
+}
+//----------------------------------------------------------------------------
+bool SpineMLSimulator::NetworkClient::sendBatch()
+{
+    const size_t batchBytes = sizeof(double) * m_Size * m_BatchNumTimesteps;
+
+    // If shared ring is in use
+    if(m_SharedRing != nullptr) {
+        // Wait for a free slot
+        const uint32_t head = m_SharedRing->head.load(std::memory_order_relaxed);
+        if(!waitForSharedRing([this, head](){ return ((head - m_SharedRing->tail.load(std::memory_order_acquire)) < numBatchesInFlight); }, false)) {
+            return false;
+        }
+
+        // Copy number of timesteps and batch into slot and pass it to remote host
+        char *slot = getSharedRingSlot(m_SharedRing, head);
+        const uint64_t numTimesteps = m_BatchNumTimesteps;
+        std::memcpy(slot, &numTimesteps, sizeof(uint64_t));
+        std::memcpy(slot + sizeof(uint64_t), m_Batch.data(), batchBytes);
+        m_SharedRing->head.store(head + 1, std::memory_order_release);
+    }
+    // Otherwise
+    else {
+        // If the maximum number of batches are in flight, wait for the oldest to be acknowledged
+        if(m_NumUnacknowledgedBatches == numBatchesInFlight && !receiveResponse()) {
+            return false;
+        }
+
+        // Send number of timesteps followed by batch
+        const uint32_t numTimesteps = m_BatchNumTimesteps;
+        if(!sendAll(reinterpret_cast<const char*>(&numTimesteps), sizeof(uint32_t))
+            || !sendAll(reinterpret_cast<const char*>(m_Batch.data()), batchBytes))
+        {
+            return false;
+        }
+        m_NumUnacknowledgedBatches++;
+    }
+
+    // Start filling next batch
+    m_BatchNumTimesteps = 0;
+    return true;
+}
+//----------------------------------------------------------------------------
+bool SpineMLSimulator::NetworkClient::receiveBatch()
+{
+    // If shared ring is in use
+    uint64_t numTimesteps;
+    if(m_SharedRing != nullptr) {
+        // Wait for a filled slot
+        const uint32_t tail = m_SharedRing->tail.load(std::memory_order_relaxed);
+        if(!waitForSharedRing([this, tail](){ return (m_SharedRing->head.load(std::memory_order_acquire) != tail); }, true)) {
+            return false;
+        }
+
+        // Copy number of timesteps out of slot and check it's valid
+        const char *slot = getSharedRingSlot(m_SharedRing, tail);
+        std::memcpy(&numTimesteps, slot, sizeof(uint64_t));
+        if(numTimesteps == 0 || numTimesteps > m_BatchTimesteps) {
+            LOGE_SPINEML << "Invalid number of timesteps in batch:" << numTimesteps;
+            return false;
+        }
+
+        // Copy batch out of slot and pass it back to remote host
+        std::memcpy(m_Batch.data(), slot + sizeof(uint64_t), sizeof(double) * m_Size * numTimesteps);
+        m_SharedRing->tail.store(tail + 1, std::memory_order_release);
+    }
+    // Otherwise
+    else {
+        // Receive number of timesteps and check it's valid
+        uint32_t numTCPTimesteps;
+        if(!receiveAll(reinterpret_cast<char*>(&numTCPTimesteps), sizeof(uint32_t))) {
+            return false;
+        }
+        if(numTCPTimesteps == 0 || numTCPTimesteps > m_BatchTimesteps) {
+            LOGE_SPINEML << "Invalid number of timesteps in batch:" << numTCPTimesteps;
+            return false;
+        }
+        numTimesteps = numTCPTimesteps;
+
+        // Receive batch
+        if(!receiveAll(reinterpret_cast<char*>(m_Batch.data()), sizeof(double) * m_Size * numTimesteps)) {
+            return false;
+        }
+
+        // Acknowledge batch straight away so remote host can send the next one while this is used
+        const Response response = Response::Received;
+        if(!sendAll(reinterpret_cast<const char*>(&response), sizeof(Response))) {
+            return false;
+        }
+    }
+
+    // Start using batch from first timestep
+    m_BatchNumTimesteps = (unsigned int)numTimesteps;
+    m_BatchPosition = 0;
+    return true;
+}
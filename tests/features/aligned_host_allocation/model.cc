@@ -0,0 +1,41 @@
+//--------------------------------------------------------------------------
+/*! \file aligned_host_allocation/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE("$(x) = (scalar)$(id);\n");
+
+    SET_VARS({{"x", "scalar"}, {"y", "uint8_t"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+void modelDefinition(ModelSpec &model)
+{
+    GENN_PREFERENCES.enableAlignedHostAllocation = true;
+    GENN_PREFERENCES.enableHugePages = true;
+
+    model.setDT(0.1);
+    model.setName("aligned_host_allocation");
+
+    // **NOTE** x is over 2MB in Large population so should be aligned to a huge page boundary
+    // whereas the rest of the arrays, which aren't a multiple of 64 bytes in size, should only be 64-byte aligned
+    model.addNeuronPopulation<Neuron>("Small", 3, {}, Neuron::VarValues(0.0, 1));
+    model.addNeuronPopulation<Neuron>("Large", 600000, {}, Neuron::VarValues(0.0, 1));
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,85 @@
+//--------------------------------------------------------------------------
+/*! \file aligned_host_allocation/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C includes
+#include <cstdint>
+
+// Platform includes
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+// **NOTE** internal definitions provide the allocator used by the generated code
+#include "aligned_host_allocation_CODE/definitions.h"
+#include "aligned_host_allocation_CODE/definitionsInternal.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+template<typename T>
+size_t getAlignmentOffset(const T *ptr, size_t alignment)
+{
+    return reinterpret_cast<uintptr_t>(ptr) % alignment;
+}
+}   // Anonymous namespace
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, AlignedHostAllocation)
+{
+    // Arrays allocated by generated code should be aligned to 64 bytes
+    EXPECT_EQ(getAlignmentOffset(xSmall, 64), 0);
+    EXPECT_EQ(getAlignmentOffset(ySmall, 64), 0);
+    EXPECT_EQ(getAlignmentOffset(glbSpkSmall, 64), 0);
+    EXPECT_EQ(getAlignmentOffset(glbSpkCntSmall, 64), 0);
+    EXPECT_EQ(getAlignmentOffset(yLarge, 64), 0);
+
+    // Arrays spanning a huge page should be aligned to a huge page boundary
+    EXPECT_EQ(getAlignmentOffset(xLarge, 2 * 1024 * 1024), 0);
+
+    // Arrays should be usable
+    StepGeNN();
+    for(unsigned int i = 0; i < 600000; i++) {
+        ASSERT_EQ(xLarge[i], (scalar)i);
+    }
+}
+
+TEST_F(SimTest, AllocationSize)
+{
+    // Check allocations of a range of sizes
+    for(size_t count : {1, 15, 16, 17, 1000, (2 * 1024 * 1024) - 1, 2 * 1024 * 1024, (2 * 1024 * 1024) + 1}) {
+        uint8_t *ptr = gennAllocateHost<uint8_t>(count);
+        ASSERT_NE(ptr, nullptr);
+
+        // Arrays should be aligned to 64 bytes or, if they span a huge page, to a huge page boundary
+        const size_t alignment = (count >= (2 * 1024 * 1024)) ? (2 * 1024 * 1024) : 64;
+        EXPECT_EQ(getAlignmentOffset(ptr, alignment), 0);
+
+        // Arrays should be padded to a multiple of their alignment
+        // **NOTE** malloc may round allocations up further so this can only check a lower bound
+#ifdef __GLIBC__
+        const size_t paddedBytes = ((count + alignment - 1) / alignment) * alignment;
+        EXPECT_GE(malloc_usable_size(ptr), paddedBytes);
+#endif
+        gennFreeHost(ptr);
+    }
+}
@@ -0,0 +1,102 @@
+//--------------------------------------------------------------------------
+/*! \file batch_decode_matrix_individualg_ragged/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// AlwaysSpike
+//----------------------------------------------------------------------------
+class AlwaysSpike : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(AlwaysSpike, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(AlwaysSpike);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"w", "scalar"}});
+
+    SET_LEARN_POST_CODE("$(w) += 1.0;");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+//----------------------------------------------------------------------------
+// DynamicsWeightUpdateModel
+//----------------------------------------------------------------------------
+class DynamicsWeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(DynamicsWeightUpdateModel, 0, 1);
+
+    SET_VARS({{"d", "scalar"}});
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(d) += 1.0;");
+};
+
+IMPLEMENT_MODEL(DynamicsWeightUpdateModel);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("batch_decode_matrix_individualg_ragged");
+    model.setBatchSize(2);
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);    // 0 - Wij (nA)
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 4, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<AlwaysSpike>("PostLearn", 4, {}, {});
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {});
+
+    // Synapses with the same connectivity which are updated every time their postsynaptic neuron spikes
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "SynLearn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "PostLearn",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+
+    // Synapses with the same connectivity which are updated every timestep
+    model.addSynapsePopulation<DynamicsWeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "SynDyn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, DynamicsWeightUpdateModel::VarValues(0.0),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+}
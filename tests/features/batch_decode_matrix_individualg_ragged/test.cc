@@ -0,0 +1,122 @@
+//--------------------------------------------------------------------------
+/*! \file batch_decode_matrix_individualg_ragged/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "batch_decode_matrix_individualg_ragged_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Loop through presynaptic neurons
+        // **NOTE** connectivity is shared between batches
+        for(unsigned int i = 0; i < 10; i++)
+        {
+            // Initially zero row length
+            rowLengthSyn[i] = 0;
+            rowLengthSynLearn[i] = 0;
+            rowLengthSynDyn[i] = 0;
+            for(unsigned int j = 0; j < 4; j++)
+            {
+                // Get value this post synaptic neuron represents
+                const unsigned int j_value = (1 << j);
+
+                // If this postsynaptic neuron should be connected, add index
+                if(((i + 1) & j_value) != 0)
+                {
+                    indSyn[(i * maxRowLengthSyn) + rowLengthSyn[i]++] = j;
+                    indSynLearn[(i * maxRowLengthSynLearn) + rowLengthSynLearn[i]++] = j;
+                    indSynDyn[(i * maxRowLengthSynDyn) + rowLengthSynDyn[i]++] = j;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(SimTest, BatchDecodeMatrixIndividualgRagged)
+{
+    // Give the second batch stronger weights and offset its learnt and dynamic weights
+    // **NOTE** the batch is the innermost dimension of synapse variables
+    const unsigned int numSynapses = 10 * maxRowLengthSyn;
+    for(unsigned int i = 0; i < numSynapses; i++) {
+        gSyn[(i * BATCH_SIZE) + 1] = 2.0f;
+        wSynLearn[(i * BATCH_SIZE) + 1] = 100.0f;
+        dSynDyn[(i * BATCH_SIZE) + 1] = 50.0f;
+    }
+    pushSynStateToDevice();
+    pushSynLearnStateToDevice();
+    pushSynDynStateToDevice();
+
+    const int numTimesteps = (int)(10.0f / DT);
+    for (int i = 0; i < numTimesteps; i++) {
+        // Each batch decodes a different value
+        const unsigned int inValue[BATCH_SIZE] = {(unsigned int)(i / 10) + 1, 10 - (unsigned int)(i / 10)};
+
+        // Input spike representing value in each batch
+        // **NOTE** neurons start from zero
+        for(unsigned int b = 0; b < BATCH_SIZE; b++) {
+            glbSpkCntPre[b] = 1;
+            glbSpkPre[b * 10] = (inValue[b] - 1);
+        }
+
+        // Push spikes to device
+        pushPreSpikesToDevice();
+
+        // Step GeNN
+        StepGeNN();
+
+        for(unsigned int b = 0; b < BATCH_SIZE; b++) {
+            // Loop through output neurons
+            unsigned int outValue = 0;
+            for(unsigned int j = 0; j < 4; j++) {
+                // If this neuron is representing the weight of this batch, add value it represents to output
+                if(std::fabs(xPost[(j * BATCH_SIZE) + b] - (float)(b + 1)) < 1E-5) {
+                    outValue += (1 << j);
+                }
+            }
+
+            // Input value should be correctly decoded in each batch
+            ASSERT_EQ(outValue, inValue[b]);
+        }
+    }
+
+    // Every postsynaptic neuron spikes every timestep so, as postsynaptic learning processes
+    // the previous timestep's spikes, every synapse should have been updated once per timestep but the first
+    for(unsigned int b = 0; b < BATCH_SIZE; b++) {
+        for(unsigned int i = 0; i < 10; i++) {
+            for(unsigned int j = 0; j < rowLengthSynLearn[i]; j++) {
+                ASSERT_FLOAT_EQ(wSynLearn[(((i * maxRowLengthSynLearn) + j) * BATCH_SIZE) + b], (float)((b * 100) + numTimesteps - 1));
+            }
+        }
+    }
+
+    // Synapse dynamics should have updated every synapse in every batch once per timestep
+    for(unsigned int b = 0; b < BATCH_SIZE; b++) {
+        for(unsigned int i = 0; i < 10; i++) {
+            for(unsigned int j = 0; j < rowLengthSynDyn[i]; j++) {
+                ASSERT_FLOAT_EQ(dSynDyn[(((i * maxRowLengthSynDyn) + j) * BATCH_SIZE) + b], (float)((b * 50) + numTimesteps));
+            }
+        }
+    }
+}
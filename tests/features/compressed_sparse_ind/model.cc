@@ -0,0 +1,76 @@
+//--------------------------------------------------------------------------
+/*! \file compressed_sparse_ind/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// ContinuousPulse
+//----------------------------------------------------------------------------
+class ContinuousPulse : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(ContinuousPulse, 0, 1);
+
+    SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}});
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(addToInSyn, $(g));\n");
+};
+
+IMPLEMENT_MODEL(ContinuousPulse);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("compressed_sparse_ind");
+
+    // Target populations are large enough that postsynaptic indices require 32-bits
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 100000, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PostCSR", 100000, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PostCont", 100000, {}, Neuron::VarValues(0.0));
+
+    auto *syn = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(uninitialisedVar()),
+        {}, {});
+    syn->setMaxConnections(64);
+    syn->setCompressedSparseIndEnabled(true);
+
+    auto *synCSR = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynCSR", SynapseMatrixType::CSR_INDIVIDUALG, NO_DELAY, "Pre", "PostCSR",
+        {}, WeightUpdateModels::StaticPulse::VarValues(uninitialisedVar()),
+        {}, {});
+    synCSR->setMaxConnections(64);
+    synCSR->setCompressedSparseIndEnabled(true);
+
+    auto *synCont = model.addSynapsePopulation<ContinuousPulse, PostsynapticModels::DeltaCurr>(
+        "SynCont", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "PostCont",
+        {}, ContinuousPulse::VarValues(uninitialisedVar()),
+        {}, {});
+    synCont->setMaxConnections(64);
+    synCont->setCompressedSparseIndEnabled(true);
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,123 @@
+//--------------------------------------------------------------------------
+/*! \file compressed_sparse_ind/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "compressed_sparse_ind_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Gaps between targets which straddle the boundaries between 1, 2 and 4-byte differences
+        const unsigned int gaps[6] = {1, 17, 255, 256, 300, 3};
+
+        m_Rows.resize(10);
+        rowPtrSynCSR[0] = 0;
+        for(unsigned int i = 0; i < 10; i++) {
+            // Build rows of varying length, including an empty and a full row
+            const unsigned int rowLength = (i == 9) ? 0 : ((i == 8) ? 64 : ((5 * i) + 1));
+            unsigned int j = ((i % 2) == 0) ? (70000 + i) : (i * 7);
+            for(unsigned int k = 0; k < rowLength; k++) {
+                m_Rows[i].push_back(j);
+                j += gaps[(i + k) % 6] + (((k == 2) && (i % 2) == 1) ? 65536 : 0);
+            }
+
+            // Unsort start of odd rows
+            if((i % 2) == 1 && rowLength > 1) {
+                std::swap(m_Rows[i][0], m_Rows[i][1]);
+            }
+
+            // Copy row into connectivity and weights of each synapse group
+            rowLengthSyn[i] = rowLength;
+            rowLengthSynCont[i] = rowLength;
+            rowPtrSynCSR[i + 1] = rowPtrSynCSR[i] + rowLength;
+            for(unsigned int k = 0; k < rowLength; k++) {
+                const unsigned int sparseIdx = (i * maxRowLengthSyn) + k;
+                const unsigned int csrIdx = rowPtrSynCSR[i] + k;
+                indSyn[sparseIdx] = m_Rows[i][k];
+                indSynCont[sparseIdx] = m_Rows[i][k];
+                indSynCSR[csrIdx] = m_Rows[i][k];
+                gSyn[sparseIdx] = getWeight(i, k);
+                gSynCont[sparseIdx] = getWeight(i, k);
+                gSynCSR[csrIdx] = getWeight(i, k);
+            }
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    unsigned int countErrors(const scalar *x, const std::vector<scalar> &correct) const
+    {
+        unsigned int numErrors = 0;
+        for(unsigned int j = 0; j < 100000; j++) {
+            if(x[j] != correct[j]) {
+                numErrors++;
+            }
+        }
+        return numErrors;
+    }
+
+    static scalar getWeight(unsigned int i, unsigned int k)
+    {
+        return (scalar)((i * 100) + k + 1);
+    }
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::vector<std::vector<unsigned int>> m_Rows;
+};
+
+TEST_F(SimTest, CompressedSparseInd)
+{
+    // Synapse dynamics continuously apply all weights
+    std::vector<scalar> correctCont(100000, 0.0f);
+    for(unsigned int i = 0; i < 10; i++) {
+        for(unsigned int k = 0; k < m_Rows[i].size(); k++) {
+            correctCont[m_Rows[i][k]] += getWeight(i, k);
+        }
+    }
+
+    for(unsigned int t = 0; t < 20; t++) {
+        // Spike one presynaptic neuron each timestep
+        const unsigned int pre = t % 10;
+        glbSpkCntPre[0] = 1;
+        glbSpkPre[0] = pre;
+        pushPreSpikesToDevice();
+
+        StepGeNN();
+
+        // Presynaptic update should only apply weights from spiking neuron's row
+        std::vector<scalar> correct(100000, 0.0f);
+        for(unsigned int k = 0; k < m_Rows[pre].size(); k++) {
+            correct[m_Rows[pre][k]] = getWeight(pre, k);
+        }
+
+        ASSERT_EQ(countErrors(xPost, correct), 0);
+        ASSERT_EQ(countErrors(xPostCSR, correct), 0);
+        ASSERT_EQ(countErrors(xPostCont, correctCont), 0);
+    }
+}
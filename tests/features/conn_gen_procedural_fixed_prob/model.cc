@@ -0,0 +1,64 @@
+//--------------------------------------------------------------------------
+/*! \file conn_gen_procedural_fixed_prob/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// AlwaysSpike
+//----------------------------------------------------------------------------
+class AlwaysSpike : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(AlwaysSpike, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(AlwaysSpike);
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("conn_gen_procedural_fixed_prob");
+    model.setSeed(1234);
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);    // 0 - Wij (nA)
+
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProbParams(0.1);  // 0 - prob
+
+    model.addNeuronPopulation<AlwaysSpike>("Pre", 1000, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 1000, {}, Neuron::VarValues(0.0));
+
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::PROCEDURAL_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+
+    model.setPrecision(GENN_FLOAT);
+}
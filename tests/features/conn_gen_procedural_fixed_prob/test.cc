@@ -0,0 +1,51 @@
+//--------------------------------------------------------------------------
+/*! \file conn_gen_procedural_fixed_prob/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "conn_gen_procedural_fixed_prob_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, ConnGenProceduralFixedProb)
+{
+    // Every presynaptic neuron spikes every timestep so, after spikes from first timestep
+    // have been delivered, x contains the number of synapses targetting each neuron
+    StepGeNN();
+    StepGeNN();
+    const std::vector<scalar> firstInDegree(&xPost[0], &xPost[1000]);
+
+    // Check mean in-degree matches connection probability
+    const double meanInDegree = std::accumulate(firstInDegree.cbegin(), firstInDegree.cend(), 0.0) / 1000.0;
+    EXPECT_NEAR(meanInDegree, 100.0, 2.0);
+
+    // Check connectivity is actually random
+    const auto minMax = std::minmax_element(firstInDegree.cbegin(), firstInDegree.cend());
+    EXPECT_LT(*minMax.first, *minMax.second);
+
+    // Check that, when rows are regenerated on subsequent timesteps, connectivity is identical
+    for(unsigned int t = 0; t < 10; t++) {
+        StepGeNN();
+        EXPECT_TRUE(std::equal(firstInDegree.cbegin(), firstInDegree.cend(), &xPost[0]));
+    }
+}
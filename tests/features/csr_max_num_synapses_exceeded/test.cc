@@ -0,0 +1,25 @@
+//--------------------------------------------------------------------------
+/*! \file csr_max_num_synapses_exceeded/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <stdexcept>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "csr_max_num_synapses_exceeded_CODE/definitions.h"
+
+TEST(SimTest, CSRMaxNumSynapsesExceeded)
+{
+    allocateMem();
+
+    // Initialising connectivity should fail rather than writing synapses past the end of the ind array
+    EXPECT_THROW(initialize(), std::runtime_error);
+
+    freeMem();
+}
@@ -30,6 +30,7 @@ void modelDefinition(ModelSpec &model)
         0.0,        // 2 - mean
         1.0);       // 3 - standard deviation
 
+    model.setSeed(1234);
     model.setDT(0.1);
     model.setName("current_source_rng_normal");
 
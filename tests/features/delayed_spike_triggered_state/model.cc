@@ -0,0 +1,119 @@
+//--------------------------------------------------------------------------
+/*! \file delayed_spike_triggered_state/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+//! Neuron which spikes with irregular intervals, some longer than the number of delay slots
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("((((unsigned int)rint($(t))) * (5 + (3 * $(id)))) % 31) < 4");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("((((unsigned int)rint($(t))) * (7 + (2 * $(id)))) % 29) < 3");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+//----------------------------------------------------------------------------
+// PreWeightUpdateModel
+//----------------------------------------------------------------------------
+class PreWeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(PreWeightUpdateModel, 0, 3, 2, 0);
+
+    SET_VARS({{"s", "scalar"}, {"c", "scalar"}, {"st", "scalar"}});
+    SET_PRE_VARS({{"sPre", "scalar"}, {"cPre", "scalar"}});
+
+    SET_SYNAPSE_DYNAMICS_CODE(
+        "$(s) = $(sPre);\n"
+        "$(c) = $(cPre);\n"
+        "$(st) = $(sT_pre);\n");
+    SET_PRE_SPIKE_CODE(
+        "$(sPre) = $(t);\n"
+        "$(cPre) += 1.0;\n");
+
+    SET_NEEDS_PRE_SPIKE_TIME(true);
+};
+
+IMPLEMENT_MODEL(PreWeightUpdateModel);
+
+//----------------------------------------------------------------------------
+// PostWeightUpdateModel
+//----------------------------------------------------------------------------
+class PostWeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(PostWeightUpdateModel, 0, 3, 0, 2);
+
+    SET_VARS({{"s", "scalar"}, {"c", "scalar"}, {"st", "scalar"}});
+    SET_POST_VARS({{"sPost", "scalar"}, {"cPost", "scalar"}});
+
+    SET_SYNAPSE_DYNAMICS_CODE(
+        "$(s) = $(sPost);\n"
+        "$(c) = $(cPost);\n"
+        "$(st) = $(sT_post);\n");
+    SET_POST_SPIKE_CODE(
+        "$(sPost) = $(t);\n"
+        "$(cPost) += 1.0;\n");
+
+    SET_NEEDS_POST_SPIKE_TIME(true);
+};
+
+IMPLEMENT_MODEL(PostWeightUpdateModel);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("delayed_spike_triggered_state");
+
+    model.addNeuronPopulation<PreNeuron>("pre", 10, {}, {});
+    model.addNeuronPopulation<PostNeuron>("post", 10, {}, {});
+
+    // Presynaptic variables and spike times read through axonal delays which share the presynaptic population's delay slots
+    PreWeightUpdateModel::VarValues preVarVals(0.0, 0.0, 0.0);
+    PreWeightUpdateModel::PreVarValues preVarPreVals(-1.0, 0.0);
+    for(unsigned int d : {1, 3, 7}) {
+        model.addSynapsePopulation<PreWeightUpdateModel, PostsynapticModels::DeltaCurr>(
+            "pre" + std::to_string(d), SynapseMatrixType::SPARSE_INDIVIDUALG, d, "pre", "post",
+            {}, preVarVals, preVarPreVals, {},
+            {}, {},
+            initConnectivity<InitSparseConnectivitySnippet::OneToOne>({}));
+    }
+
+    // Postsynaptic variables and spike times read through back-propagation delay
+    PostWeightUpdateModel::VarValues postVarVals(0.0, 0.0, 0.0);
+    PostWeightUpdateModel::PostVarValues postVarPostVals(-1.0, 0.0);
+    auto *post = model.addSynapsePopulation<PostWeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "post5", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "pre", "post",
+        {}, postVarVals, {}, postVarPostVals,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>({}));
+    post->setBackPropDelaySteps(5);
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,81 @@
+//--------------------------------------------------------------------------
+/*! \file delayed_spike_triggered_state/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include "delayed_spike_triggered_state_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Does neuron spike in timestep, following threshold condition code in model
+bool preSpikes(unsigned int i, int timestep)
+{
+    return (((unsigned int)timestep * (5 + (3 * i))) % 31) < 4;
+}
+
+bool postSpikes(unsigned int i, int timestep)
+{
+    return (((unsigned int)timestep * (7 + (2 * i))) % 29) < 3;
+}
+
+// Check the spike-triggered state read through a delay matches that which would have been
+// copied between delay slots every timestep i.e. the state as of the timestep the slot was written
+template<typename S>
+void checkDelayedState(S spikes, unsigned int delay, const scalar *s, const scalar *c, const scalar *st)
+{
+    // **NOTE** state is read one timestep AFTER being written and iT is incremented at the end of StepGeNN
+    const int timestep = (int)iT - 2 - (int)delay;
+    for(unsigned int i = 0; i < 10; i++) {
+        // Find timestep of latest spike and count spikes up until timestep being read
+        int latestSpike = -1;
+        unsigned int numSpikes = 0;
+        for(int j = 0; j <= timestep; j++) {
+            if(spikes(i, j)) {
+                latestSpike = j;
+                numSpikes++;
+            }
+        }
+
+        // If neuron hasn't spiked, state should be in initial state
+        if(latestSpike == -1) {
+            ASSERT_FLOAT_EQ(s[i], -1.0f);
+            ASSERT_LT(st[i], -1.0E6);
+        }
+        // Otherwise, state should have been set by latest spike and spike time should include delay
+        else {
+            ASSERT_FLOAT_EQ(s[i], (scalar)latestSpike);
+            ASSERT_FLOAT_EQ(st[i], (scalar)(latestSpike + delay + 1));
+        }
+        ASSERT_FLOAT_EQ(c[i], (scalar)numSpikes);
+    }
+}
+}   // Anonymous namespace
+
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, DelayedSpikeTriggeredState)
+{
+    while(t < 200.0f) {
+        StepGeNN();
+
+        checkDelayedState(preSpikes, 1, spre1, cpre1, stpre1);
+        checkDelayedState(preSpikes, 3, spre3, cpre3, stpre3);
+        checkDelayedState(preSpikes, 7, spre7, cpre7, stpre7);
+        checkDelayedState(postSpikes, 5, spost5, cpost5, stpost5);
+    }
+}
@@ -0,0 +1,79 @@
+//--------------------------------------------------------------------------
+/*! \file external_connectivity/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// AlwaysSpike
+//----------------------------------------------------------------------------
+class AlwaysSpike : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(AlwaysSpike, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(AlwaysSpike);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"w", "scalar"}});
+
+    SET_LEARN_POST_CODE("$(w) += 1.0;");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("external_connectivity");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 4, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<AlwaysSpike>("PostLearn", 4, {}, {});
+
+    // Connectivity and weights are both mapped from files written by the test
+    auto *syn = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(uninitialisedVar()),
+        {}, {});
+    syn->setExternalConnectivityFile("external_connectivity.bin");
+
+    auto *synLearn = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "SynLearn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "PostLearn",
+        {}, WeightUpdateModel::VarValues(uninitialisedVar()),
+        {}, {});
+    synLearn->setExternalConnectivityFile("external_connectivity_learn.bin");
+
+    model.setPrecision(GENN_FLOAT);
+}
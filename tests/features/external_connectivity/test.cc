@@ -0,0 +1,102 @@
+//--------------------------------------------------------------------------
+/*! \file external_connectivity/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "external_connectivity_CODE/definitions.h"
+
+// GeNN userproject includes
+#include "../../../userproject/include/sparseConnectivityFile.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test_decoder_matrix.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestDecoderMatrix
+{
+protected:
+    //--------------------------------------------------------------------------
+    // test virtuals
+    //--------------------------------------------------------------------------
+    virtual void SetUp()
+    {
+        // Build decoder connectivity with unit weights for both synapse groups
+        SparseConnectivityFile connectivity(10, 4);
+        const size_t w = connectivity.addVar<float>("w");
+        const size_t g = connectivity.addVar<float>("g");
+        for(unsigned int i = 0; i < 10; i++) {
+            for(unsigned int j = 0; j < 4; j++) {
+                // If this postsynaptic neuron should be connected, add synapse
+                if(((i + 1) & (1 << j)) != 0) {
+                    const size_t synapse = connectivity.addSynapse(i, j);
+                    connectivity.setVarValue(g, synapse, 1.0f);
+                    connectivity.setVarValue(w, synapse, 0.0f);
+                }
+            }
+        }
+        connectivity.write("external_connectivity.bin");
+        connectivity.write("external_connectivity_learn.bin");
+
+        // Allocate memory, mapping connectivity, and initialise
+        SimulationTest::SetUp();
+    }
+};
+
+//----------------------------------------------------------------------------
+// Helpers
+//----------------------------------------------------------------------------
+std::string readFile(const std::string &filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+}
+
+TEST_F(SimTest, ExternalConnectivity)
+{
+    ASSERT_STREQ(externalConnectivityFileSyn, "external_connectivity.bin");
+
+    // Check connectivity was mapped
+    ASSERT_EQ(rowLengthSyn[2], 2);
+    ASSERT_EQ(indSyn[(2 * maxRowLengthSyn) + 1], 1);
+    ASSERT_EQ(gSyn[(2 * maxRowLengthSyn) + 1], 1.0f);
+
+    // Check total error is less than some tolerance
+    const std::string learnFile = readFile("external_connectivity_learn.bin");
+    EXPECT_TRUE(Simulate());
+
+    // Every postsynaptic neuron spikes every timestep so, as postsynaptic learning processes
+    // the previous timestep's spikes, every synapse should have been updated once per timestep but the first
+    const int numTimesteps = (int)(10.0f / DT);
+    for(unsigned int i = 0; i < 10; i++) {
+        for(unsigned int j = 0; j < rowLengthSynLearn[i]; j++) {
+            ASSERT_FLOAT_EQ(wSynLearn[(i * maxRowLengthSynLearn) + j], (float)(numTimesteps - 1));
+        }
+    }
+
+    // Mapping is private so learning should not have modified file
+    ASSERT_EQ(readFile("external_connectivity_learn.bin"), learnFile);
+}
+
+TEST_F(SimTest, ExternalConnectivityMissing)
+{
+    // Mapping missing file should throw
+    freeMem();
+    externalConnectivityFileSyn = "missing_connectivity.bin";
+    EXPECT_THROW(allocateMem(), std::runtime_error);
+    externalConnectivityFileSyn = "external_connectivity.bin";
+    allocateMem();
+}
@@ -0,0 +1,97 @@
+//--------------------------------------------------------------------------
+/*! \file fast_divisor/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <limits>
+#include <random>
+#include <vector>
+
+// Standard C includes
+#include <cstdint>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+// **NOTE** internal definitions provide the fast divisor used by the generated code
+#include "fast_divisor_CODE/definitions.h"
+#include "fast_divisor_CODE/definitionsInternal.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Check fast division of a range of numerators by divisor matches / and %
+void checkDivisor(uint32_t divisor)
+{
+    constexpr uint32_t maxValue = std::numeric_limits<uint32_t>::max();
+
+    // Numerators at the extremes of the range and either side of multiples of the divisor
+    std::vector<uint32_t> numerators{0, 1, 2, maxValue - 1, maxValue,
+                                     divisor - 1, divisor, divisor + 1,
+                                     (maxValue / divisor) * divisor, ((maxValue / divisor) * divisor) - 1};
+    if(divisor < (maxValue / 2)) {
+        numerators.push_back((2 * divisor) - 1);
+        numerators.push_back(2 * divisor);
+        numerators.push_back((2 * divisor) + 1);
+    }
+
+    // Random numerators
+    std::mt19937 rng(divisor);
+    std::uniform_int_distribution<uint32_t> dist;
+    for(unsigned int i = 0; i < 10000; i++) {
+        numerators.push_back(dist(rng));
+    }
+
+    const FastDivisor fastDivisor(divisor);
+    for(uint32_t n : numerators) {
+        const uint32_t quotient = fastDivisor.divide(n);
+        ASSERT_EQ(quotient, n / divisor) << n << " / " << divisor;
+        ASSERT_EQ(n - (quotient * divisor), n % divisor) << n << " % " << divisor;
+    }
+}
+}   // Anonymous namespace
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, One)
+{
+    checkDivisor(1);
+}
+
+TEST_F(SimTest, PowersOfTwo)
+{
+    for(unsigned int i = 1; i < 32; i++) {
+        checkDivisor(1u << i);
+    }
+}
+
+TEST_F(SimTest, NearMax)
+{
+    constexpr uint32_t maxValue = std::numeric_limits<uint32_t>::max();
+    for(uint32_t d : {maxValue, maxValue - 1, maxValue - 2, (maxValue / 2) + 2, (maxValue / 2) + 1, maxValue / 2}) {
+        checkDivisor(d);
+    }
+}
+
+TEST_F(SimTest, Other)
+{
+    // Small divisors, either side of powers of two and typical row strides
+    for(uint32_t d : {3u, 5u, 6u, 7u, 9u, 10u, 31u, 33u, 100u, 641u, 1000u, 1023u, 1025u, 65535u, 65537u, 1000000u}) {
+        checkDivisor(d);
+    }
+}
@@ -0,0 +1,50 @@
+//--------------------------------------------------------------------------
+/*! \file linear_dynamics/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+#include "linearDynamics.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+// Leaky integrator driven by a constant current and inhibited by a decaying adaptation variable
+const Models::LinearDynamics dynamics(
+    {"V", "A"},
+    [](const std::vector<double> &pars)
+    {
+        return std::vector<double>{-1.0 / pars[1], -1.0 / pars[1],
+                                   0.0, -1.0 / pars[2]};
+    },
+    {"$(I) / $(C)", ""});
+
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 4, 2);
+
+    SET_SIM_CODE(dynamics.getUpdateCode());
+
+    SET_PARAM_NAMES({"C", "TauM", "TauA", "I"});
+    SET_DERIVED_PARAMS(dynamics.getDerivedParams());
+
+    SET_VARS({{"V", "scalar"}, {"A", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+void modelDefinition(ModelSpec &model)
+{
+    // **NOTE** timestep is deliberately large compared to membrane time constant
+    model.setDT(5.0);
+    model.setName("linear_dynamics");
+
+    model.addNeuronPopulation<Neuron>("Pop", 1, Neuron::ParamValues(1.0, 20.0, 100.0, 0.5), Neuron::VarValues(0.0, 10.0));
+
+    model.setPrecision(GENN_DOUBLE);
+}
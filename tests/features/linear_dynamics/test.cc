@@ -0,0 +1,43 @@
+//--------------------------------------------------------------------------
+/*! \file linear_dynamics/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "linear_dynamics_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, LinearDynamics)
+{
+    const double tauM = 20.0;
+    const double tauA = 100.0;
+    const double vInf = 0.5 * tauM;
+    const double a0 = 10.0;
+    const double k = -a0 * tauA / (tauA - tauM);
+
+    for(int i = 0; i < 50; i++) {
+        StepGeNN();
+
+        // State should match analytic solution despite large timestep
+        ASSERT_NEAR(APop[0], a0 * std::exp(-t / tauA), 1E-9);
+        ASSERT_NEAR(VPop[0], vInf + ((-vInf - k) * std::exp(-t / tauM)) + (k * std::exp(-t / tauA)), 1E-9);
+    }
+}
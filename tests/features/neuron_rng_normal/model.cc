@@ -27,6 +27,7 @@ IMPLEMENT_MODEL(Neuron);
 
 void modelDefinition(ModelSpec &model)
 {
+    model.setSeed(1234);
     model.setDT(0.1);
     model.setName("neuron_rng_normal");
 
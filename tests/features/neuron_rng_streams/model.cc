@@ -0,0 +1,40 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_rng_streams/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE("$(x)= $(gennrand_uniform);\n");
+
+    SET_VARS({{"x", "scalar"}, {"y", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setSeed(1234);
+    model.setDT(0.1);
+    model.setName("neuron_rng_streams");
+
+    // **NOTE** population size isn't a multiple of any likely number of threads so work is split unevenly
+    InitVarSnippet::Uniform::ParamValues uniformParams(0.0, 1.0);
+    Neuron::VarValues varInit(0.0, initVar<InitVarSnippet::Uniform>(uniformParams));
+    model.addNeuronPopulation<Neuron>("Pop", 1001, {}, varInit);
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,135 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_rng_streams/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <set>
+#include <vector>
+
+// Standard C includes
+#include <cmath>
+#include <cstdint>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+// **NOTE** internal definitions provide the counter-based RNG used by the generated code
+#include "neuron_rng_streams_CODE/definitions.h"
+#include "neuron_rng_streams_CODE/definitionsInternal.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test_rng_streams.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Calculate correlation coefficient between uniform samples drawn from two RNGs
+double getCorrelation(Philox4x32 a, Philox4x32 b)
+{
+    constexpr unsigned int numSamples = 100000;
+    double sumA = 0.0;
+    double sumB = 0.0;
+    double sumAA = 0.0;
+    double sumBB = 0.0;
+    double sumAB = 0.0;
+    for(unsigned int i = 0; i < numSamples; i++) {
+        const double sampleA = gennUniform(a);
+        const double sampleB = gennUniform(b);
+        sumA += sampleA;
+        sumB += sampleB;
+        sumAA += sampleA * sampleA;
+        sumBB += sampleB * sampleB;
+        sumAB += sampleA * sampleB;
+    }
+    const double covariance = (sumAB / numSamples) - ((sumA / numSamples) * (sumB / numSamples));
+    const double varianceA = (sumAA / numSamples) - ((sumA / numSamples) * (sumA / numSamples));
+    const double varianceB = (sumBB / numSamples) - ((sumB / numSamples) * (sumB / numSamples));
+    return covariance / std::sqrt(varianceA * varianceB);
+}
+
+// Count raw words drawn from first RNG which also appear in those drawn from second
+unsigned int countSharedWords(Philox4x32 a, Philox4x32 b)
+{
+    constexpr unsigned int numWords = 4096;
+    std::set<uint32_t> wordsA;
+    for(unsigned int i = 0; i < numWords; i++) {
+        wordsA.insert(a());
+    }
+
+    unsigned int numShared = 0;
+    for(unsigned int i = 0; i < numWords; i++) {
+        numShared += wordsA.count(b());
+    }
+    return numShared;
+}
+
+// Check streams are uncorrelated and don't overlap
+void checkIndependent(const Philox4x32 &a, const Philox4x32 &b)
+{
+    // **NOTE** 6 standard deviations of the correlation coefficient of 100000 independent samples
+    EXPECT_LT(std::fabs(getCorrelation(a, b)), 0.02);
+    EXPECT_EQ(countSharedWords(a, b), 0);
+}
+}   // Anonymous namespace
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestRNGStreams
+{
+};
+
+TEST_F(SimTest, PhiloxKnownAnswer)
+{
+    // Zero key and counter test vector from Random123's philox4x32-10 known answer tests
+    Philox4x32 rng(0, 0, 0);
+    EXPECT_EQ(rng(), 0x6627E8D5u);
+    EXPECT_EQ(rng(), 0xE169C58Du);
+    EXPECT_EQ(rng(), 0xBC57AC4Cu);
+    EXPECT_EQ(rng(), 0x9B00DBD8u);
+
+    // First blocks generated for a range of ids should match those generated by individual RNGs
+    std::vector<uint32_t> blocks(4 * 16);
+    gennPhiloxFirstBlocks(rngSeed, 7, 0, 16, blocks.data(), 16);
+    for(unsigned int i = 0; i < 16; i++) {
+        Philox4x32 rngID(rngSeed, i, 7);
+        for(unsigned int w = 0; w < 4; w++) {
+            EXPECT_EQ(rngID(), blocks[(w * 16) + i]);
+        }
+    }
+}
+
+TEST_F(SimTest, StreamIndependence)
+{
+    // Keys of every stream domain, merged group and group should be distinct
+    std::set<uint64_t> keys;
+    for(uint64_t d = 1; d <= 6; d++) {
+        for(uint64_t m = 0; m < 8; m++) {
+            for(uint64_t g = 0; g < 256; g++) {
+                keys.insert(gennRNGKey(rngSeed, getStreamID(d, m, g)));
+            }
+        }
+    }
+    EXPECT_EQ(keys.size(), 6 * 8 * 256);
+
+    // Streams with neighbouring ids, timesteps, groups, merged groups, domains and seeds should be independent
+    const uint64_t key = gennRNGKey(rngSeed, getStreamID(2, 0, 0));
+    checkIndependent(Philox4x32(key, 0, 0), Philox4x32(key, 1, 0));
+    checkIndependent(Philox4x32(key, 0, 0), Philox4x32(key, 0, 1));
+    checkIndependent(Philox4x32(key, 0, 0), Philox4x32(gennRNGKey(rngSeed, getStreamID(2, 0, 1)), 0, 0));
+    checkIndependent(Philox4x32(key, 0, 0), Philox4x32(gennRNGKey(rngSeed, getStreamID(2, 1, 0)), 0, 0));
+    checkIndependent(Philox4x32(key, 0, 0), Philox4x32(gennRNGKey(rngSeed, getStreamID(3, 0, 0)), 0, 0));
+    checkIndependent(Philox4x32(key, 0, 0), Philox4x32(gennRNGKey(rngSeed + 1, getStreamID(2, 0, 0)), 0, 0));
+}
+
+TEST_F(SimTest, MatchesSequential)
+{
+    CheckMatchesSequential();
+}
@@ -0,0 +1,30 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_rng_streams_threads/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+// **NOTE** internal definitions provide the counter-based RNG used by the generated code
+#include "neuron_rng_streams_threads_CODE/definitions.h"
+#include "neuron_rng_streams_threads_CODE/definitionsInternal.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test_rng_streams.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestRNGStreams
+{
+};
+
+TEST_F(SimTest, MatchesSequential)
+{
+    CheckMatchesSequential();
+}
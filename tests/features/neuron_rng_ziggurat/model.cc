@@ -0,0 +1,39 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_rng_ziggurat/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE(
+        "$(n)= $(gennrand_normal);\n"
+        "$(e)= $(gennrand_exponential);\n");
+
+    SET_VARS({{"n", "scalar"}, {"e", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setSeed(1234);
+    model.setDT(0.1);
+    model.setName("neuron_rng_ziggurat");
+
+    model.addNeuronPopulation<Neuron>("Pop", 10000, {}, Neuron::VarValues(0.0, 0.0));
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,134 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_rng_ziggurat/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "neuron_rng_ziggurat_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+#include "../../utils/stats.h"
+
+// Start of the tail of the normal and exponential Ziggurats which are sampled separately
+const double normalTailStart = 3.442619855899;
+const double exponentialTailStart = 7.697117470131487;
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    //--------------------------------------------------------------------------
+    // Protected methods
+    //--------------------------------------------------------------------------
+    void Simulate()
+    {
+        m_NormalSamples.reserve(200 * 10000);
+        m_ExponentialSamples.reserve(200 * 10000);
+
+        // Simulate to gather 2 million samples from each distribution
+        for (unsigned int i = 0; i < 200; i++) {
+            // Step GeNN
+            StepGeNN();
+
+            // Copy this timestep's samples into vectors
+            std::copy_n(nPop, 10000, std::back_inserter(m_NormalSamples));
+            std::copy_n(ePop, 10000, std::back_inserter(m_ExponentialSamples));
+        }
+    }
+
+    // Check number of samples above threshold is within 5 standard deviations of that expected from tail probability
+    static void checkTail(const std::vector<double> &samples, double threshold, double tailProb)
+    {
+        const double expected = tailProb * samples.size();
+        const double stdDev = std::sqrt(expected * (1.0 - tailProb));
+        const auto count = std::count_if(samples.cbegin(), samples.cend(),
+                                         [threshold](double x){ return (x > threshold); });
+        EXPECT_NEAR((double)count, expected, 5.0 * stdDev);
+    }
+
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    std::vector<double> m_NormalSamples;
+    std::vector<double> m_ExponentialSamples;
+};
+
+TEST_F(SimTest, Normal)
+{
+    Simulate();
+
+    // With 2 million samples, KS test is sensitive to errors in individual Ziggurat layers
+    double d;
+    double prob;
+    std::tie(d, prob) = Stats::kolmogorovSmirnovTest(m_NormalSamples, Stats::normalCDF);
+    EXPECT_GT(prob, 0.01);
+
+    // Check both tails, which are sampled using a separate algorithm, are sampled at the correct rate
+    const double tailProb = 0.5 * std::erfc(normalTailStart / std::sqrt(2.0));
+    checkTail(m_NormalSamples, normalTailStart, tailProb);
+    std::vector<double> negatedSamples;
+    negatedSamples.reserve(m_NormalSamples.size());
+    std::transform(m_NormalSamples.cbegin(), m_NormalSamples.cend(), std::back_inserter(negatedSamples),
+                   [](double x){ return -x; });
+    checkTail(negatedSamples, normalTailStart, tailProb);
+
+    // Check the first four moments
+    double mean = 0.0;
+    double variance = 0.0;
+    double skew = 0.0;
+    double kurtosis = 0.0;
+    for(double x : m_NormalSamples) {
+        mean += x;
+        variance += x * x;
+        skew += x * x * x;
+        kurtosis += x * x * x * x;
+    }
+    const double n = (double)m_NormalSamples.size();
+    EXPECT_NEAR(mean / n, 0.0, 5.0 * std::sqrt(1.0 / n));
+    EXPECT_NEAR(variance / n, 1.0, 5.0 * std::sqrt(2.0 / n));
+    EXPECT_NEAR(skew / n, 0.0, 5.0 * std::sqrt(15.0 / n));
+    EXPECT_NEAR(kurtosis / n, 3.0, 5.0 * std::sqrt(96.0 / n));
+}
+
+TEST_F(SimTest, Exponential)
+{
+    Simulate();
+
+    // With 2 million samples, KS test is sensitive to errors in individual Ziggurat layers
+    double d;
+    double prob;
+    std::tie(d, prob) = Stats::kolmogorovSmirnovTest(m_ExponentialSamples, Stats::exponentialCDF);
+    EXPECT_GT(prob, 0.01);
+
+    // All samples should be positive and tail, which is sampled using a separate algorithm, should be sampled at the correct rate
+    EXPECT_TRUE(std::all_of(m_ExponentialSamples.cbegin(), m_ExponentialSamples.cend(), [](double x){ return (x >= 0.0); }));
+    checkTail(m_ExponentialSamples, exponentialTailStart, std::exp(-exponentialTailStart));
+
+    // Check mean and variance
+    double mean = 0.0;
+    double variance = 0.0;
+    for(double x : m_ExponentialSamples) {
+        mean += x;
+        variance += (x - 1.0) * (x - 1.0);
+    }
+    const double n = (double)m_ExponentialSamples.size();
+    EXPECT_NEAR(mean / n, 1.0, 5.0 * std::sqrt(1.0 / n));
+    EXPECT_NEAR(variance / n, 1.0, 5.0 * std::sqrt(8.0 / n));
+}
@@ -0,0 +1,106 @@
+//--------------------------------------------------------------------------
+/*! \file profiling/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// AlwaysSpike
+//----------------------------------------------------------------------------
+class AlwaysSpike : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(AlwaysSpike, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(AlwaysSpike);
+
+//----------------------------------------------------------------------------
+// LearnPost
+//----------------------------------------------------------------------------
+class LearnPost : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(LearnPost, 0, 1);
+
+    SET_VARS({{"w", "scalar"}});
+
+    SET_LEARN_POST_CODE("$(w) += 1.0;");
+};
+
+IMPLEMENT_MODEL(LearnPost);
+
+//----------------------------------------------------------------------------
+// Continuous
+//----------------------------------------------------------------------------
+class Continuous : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(Continuous, 0, 1);
+
+    SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}});
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(addToInSyn, $(g));\n");
+};
+
+IMPLEMENT_MODEL(Continuous);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("profiling");
+    model.setProfiling(true);
+
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);
+
+    model.addNeuronPopulation<AlwaysSpike>("Pre", 10, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 10, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<AlwaysSpike>("PostLearn", 10, {}, {});
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynDense", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {});
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynSparse", SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    model.addSynapsePopulation<LearnPost, PostsynapticModels::DeltaCurr>(
+        "SynLearn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "PostLearn",
+        {}, LearnPost::VarValues(0.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    model.addSynapsePopulation<Continuous, PostsynapticModels::DeltaCurr>(
+        "SynDynamics", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, Continuous::VarValues(1.0),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+}
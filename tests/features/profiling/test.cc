@@ -0,0 +1,121 @@
+//--------------------------------------------------------------------------
+/*! \file profiling/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Standard C includes
+#include <cstring>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "profiling_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+namespace
+{
+// Find profile of merged group containing group name updated by kernel
+const MergedGroupProfile *findProfile(const char *kernel, const std::string &name)
+{
+    const MergedGroupProfile *profile = getProfile();
+    for(unsigned int i = 0; i < NUM_MERGED_GROUP_PROFILES; i++) {
+        if(strcmp(profile[i].kernel, kernel) == 0) {
+            std::istringstream groups(profile[i].groups);
+            std::string group;
+            while(std::getline(groups, group, ',')) {
+                if(group == name) {
+                    return &profile[i];
+                }
+            }
+        }
+    }
+    return nullptr;
+}
+}
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, Profiling)
+{
+    const MergedGroupProfile *preProfile = findProfile("neuronUpdate", "Pre");
+    const MergedGroupProfile *postProfile = findProfile("neuronUpdate", "Post");
+    const MergedGroupProfile *postLearnProfile = findProfile("neuronUpdate", "PostLearn");
+    ASSERT_NE(preProfile, nullptr);
+    ASSERT_NE(postProfile, nullptr);
+    ASSERT_NE(postLearnProfile, nullptr);
+
+    const MergedGroupProfile *denseProfile = findProfile("presynapticUpdate", "SynDense");
+    const MergedGroupProfile *sparseProfile = findProfile("presynapticUpdate", "SynSparse");
+    const MergedGroupProfile *learnProfile = findProfile("postsynapticUpdate", "SynLearn");
+    const MergedGroupProfile *dynamicsProfile = findProfile("synapseDynamics", "SynDynamics");
+    ASSERT_NE(denseProfile, nullptr);
+    ASSERT_NE(sparseProfile, nullptr);
+    ASSERT_NE(learnProfile, nullptr);
+    ASSERT_NE(dynamicsProfile, nullptr);
+
+    // Profiling should start from zero
+    resetProfile();
+    ASSERT_EQ(preProfile->numSpikes, 0);
+    ASSERT_EQ(preProfile->time, 0.0);
+
+    const unsigned int numTimesteps = 100;
+    for(unsigned int i = 0; i < numTimesteps; i++) {
+        StepGeNN();
+    }
+
+    // Every neuron in Pre and PostLearn spikes every timestep
+    ASSERT_EQ(preProfile->numSpikes, 10 * numTimesteps);
+    ASSERT_EQ(postLearnProfile->numSpikes, 10 * numTimesteps);
+    ASSERT_EQ(postProfile->numSpikes, 0);
+    ASSERT_GT(preProfile->time, 0.0);
+
+    // Synaptic updates process the previous timestep's spikes so nothing happens in the first timestep
+    // but, after that, every presynaptic spike traverses a row with 10 synapses of dense and 1 synapse of one-to-one connectivity
+    ASSERT_EQ(denseProfile->numRows, 10 * (numTimesteps - 1));
+    ASSERT_EQ(denseProfile->numSynapticEvents, 10 * 10 * (numTimesteps - 1));
+    ASSERT_EQ(sparseProfile->numRows, 10 * (numTimesteps - 1));
+    ASSERT_EQ(sparseProfile->numSynapticEvents, 10 * (numTimesteps - 1));
+    ASSERT_GT(denseProfile->time, 0.0);
+
+    // Similarly, every postsynaptic spike traverses a column with 1 synapse
+    ASSERT_EQ(learnProfile->numRows, 10 * (numTimesteps - 1));
+    ASSERT_EQ(learnProfile->numSynapticEvents, 10 * (numTimesteps - 1));
+
+    // Synapse dynamics traverses every row of dense connectivity every timestep
+    ASSERT_EQ(dynamicsProfile->numRows, 10 * numTimesteps);
+    ASSERT_EQ(dynamicsProfile->numSynapticEvents, 10 * 10 * numTimesteps);
+
+    // Write profile to JSON and check it contains the expected groups and counts
+    writeProfileJSON("profiling.json");
+    std::ifstream json("profiling.json");
+    ASSERT_TRUE(json.good());
+    std::stringstream jsonStream;
+    jsonStream << json.rdbuf();
+    const std::string jsonString = jsonStream.str();
+    ASSERT_NE(jsonString.find("\"timesteps\": 100,"), std::string::npos);
+    ASSERT_NE(jsonString.find("\"kernel\": \"synapseDynamics\", \"index\": 0, \"groups\": [\"SynDynamics\"]"), std::string::npos);
+    ASSERT_NE(jsonString.find("\"numSynapticEvents\": 10000"), std::string::npos);
+    ASSERT_EQ(jsonString.back(), '\n');
+
+    // Resetting profile should zero counters
+    resetProfile();
+    ASSERT_EQ(dynamicsProfile->numRows, 0);
+    ASSERT_EQ(dynamicsProfile->numSynapticEvents, 0);
+    ASSERT_EQ(dynamicsProfile->time, 0.0);
+}
@@ -0,0 +1,101 @@
+//--------------------------------------------------------------------------
+/*! \file reduced_precision_weights/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// Sine
+//----------------------------------------------------------------------------
+class Sine : public InitVarSnippet::Base
+{
+public:
+    DECLARE_SNIPPET(Sine, 0);
+
+    SET_CODE("$(value) = 0.6 * sin((double)(($(id_pre) * 10) + $(id_post)));");
+};
+IMPLEMENT_SNIPPET(Sine);
+
+//----------------------------------------------------------------------------
+// PlasticPulse
+//----------------------------------------------------------------------------
+class PlasticPulse : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(PlasticPulse, 0, 1, 0, 0);
+
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE(
+        "$(addToInSyn, $(g));\n"
+        "$(g) += 0.01;\n");
+};
+IMPLEMENT_MODEL(PlasticPulse);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("reduced_precision_weights");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    model.addNeuronPopulation<Neuron>("PostInt8", 10, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PostInt16", 10, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PostHalf", 10, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PostBFloat16", 10, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PostPlastic", 10, {}, Neuron::VarValues(0.0));
+
+    // Static weights initialised on device and stored in each reduced-precision format
+    WeightUpdateModels::StaticPulse::VarValues staticPulseInit(initVar<Sine>());
+    auto *synInt8 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynInt8", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostInt8",
+        {}, staticPulseInit,
+        {}, {});
+    synInt8->setWUVarStorage("g", VarStorage::INT8, 0.01);
+
+    auto *synInt16 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynInt16", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostInt16",
+        {}, staticPulseInit,
+        {}, {});
+    synInt16->setWUVarStorage("g", VarStorage::INT16, 0.0001);
+
+    auto *synHalf = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynHalf", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostHalf",
+        {}, staticPulseInit,
+        {}, {});
+    synHalf->setWUVarStorage("g", VarStorage::HALF);
+
+    auto *synBFloat16 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynBFloat16", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostBFloat16",
+        {}, staticPulseInit,
+        {}, {});
+    synBFloat16->setWUVarStorage("g", VarStorage::BFLOAT16);
+
+    // Plastic weights written by host and updated every spike
+    auto *synPlastic = model.addSynapsePopulation<PlasticPulse, PostsynapticModels::DeltaCurr>(
+        "SynPlastic", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostPlastic",
+        {}, PlasticPulse::VarValues(uninitialisedVar()),
+        {}, {});
+    synPlastic->setWUVarStorage("g", VarStorage::HALF);
+
+    model.setPrecision(GENN_FLOAT);
+}
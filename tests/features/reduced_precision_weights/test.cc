@@ -0,0 +1,97 @@
+//--------------------------------------------------------------------------
+/*! \file reduced_precision_weights/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "reduced_precision_weights_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Write initial plastic weights in storage format
+        for(unsigned int i = 0; i < 100; i++) {
+            gSynPlastic[i] = gennFloatToHalf((float)getWeight(i));
+            m_Plastic[i] = roundSignificand(getWeight(i), 11);
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    // Static API
+    //----------------------------------------------------------------------------
+    static double getWeight(unsigned int i)
+    {
+        return 0.6 * std::sin((double)i);
+    }
+
+    // Round value to nearest even with specified number of significant bits
+    static double roundSignificand(double x, int bits)
+    {
+        int exponent;
+        const double mantissa = std::frexp(x, &exponent);
+        return std::ldexp(std::nearbyint(std::ldexp(mantissa, bits)), exponent - bits);
+    }
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    double m_Plastic[100];
+};
+
+TEST_F(SimTest, ReducedPrecisionWeights)
+{
+    for(unsigned int t = 0; t < 20; t++) {
+        // Spike one presynaptic neuron each timestep
+        const unsigned int pre = t % 10;
+        glbSpkCntPre[0] = 1;
+        glbSpkPre[0] = pre;
+        pushPreSpikesToDevice();
+
+        StepGeNN();
+
+        // Check each postsynaptic neuron receives spiking neuron's weight, decoded from storage format
+        pullPostInt8StateFromDevice();
+        pullPostInt16StateFromDevice();
+        pullPostHalfStateFromDevice();
+        pullPostBFloat16StateFromDevice();
+        pullPostPlasticStateFromDevice();
+        for(unsigned int j = 0; j < 10; j++) {
+            const unsigned int i = (pre * 10) + j;
+            const double weight = getWeight(i);
+            ASSERT_NEAR(xPostInt8[j], std::round(weight / 0.01) * 0.01, 1E-6);
+            ASSERT_NEAR(xPostInt16[j], std::round(weight / 0.0001) * 0.0001, 1E-6);
+            ASSERT_NEAR(xPostHalf[j], roundSignificand(weight, 11), 1E-6);
+            ASSERT_NEAR(xPostBFloat16[j], roundSignificand(weight, 8), 1E-6);
+
+            // Check plastic weight was read before being incremented and written back
+            ASSERT_NEAR(xPostPlastic[j], m_Plastic[i], 1E-6);
+            m_Plastic[i] = roundSignificand(m_Plastic[i] + 0.01, 11);
+        }
+    }
+
+    // Check updated plastic weights can be read back by host
+    pullSynPlasticStateFromDevice();
+    for(unsigned int i = 0; i < 100; i++) {
+        ASSERT_NEAR(gennHalfToFloat(gSynPlastic[i]), m_Plastic[i], 1E-6);
+    }
+}
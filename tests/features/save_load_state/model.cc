@@ -0,0 +1,89 @@
+//--------------------------------------------------------------------------
+/*! \file save_load_state/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// RandomSpiker
+//----------------------------------------------------------------------------
+class RandomSpiker : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(RandomSpiker, 0, 1);
+
+    SET_SIM_CODE("$(x) = $(gennrand_uniform);\n");
+    SET_THRESHOLD_CONDITION_CODE("$(x) < 0.2");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(RandomSpiker);
+
+//----------------------------------------------------------------------------
+// Integrator
+//----------------------------------------------------------------------------
+class Integrator : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Integrator, 0, 1);
+
+    SET_SIM_CODE("$(V) = ($(V) * 0.9) + $(Isyn);\n");
+    SET_THRESHOLD_CONDITION_CODE("$(V) > 1.0");
+    SET_RESET_CODE("$(V) = 0.0;\n");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+
+    SET_VARS({{"V", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Integrator);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"w", "scalar"}});
+
+    SET_SIM_CODE("$(addToInSyn, $(w));\n");
+    SET_LEARN_POST_CODE("$(w) += 0.01;\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("save_load_state");
+
+    InitVarSnippet::Uniform::ParamValues uniform(0.0, 0.5);
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProb(0.1);
+
+    model.addNeuronPopulation<RandomSpiker>("Pre", 100, {}, RandomSpiker::VarValues(initVar<InitVarSnippet::Uniform>({0.0, 1.0})));
+    model.addNeuronPopulation<Integrator>("Post", 20, {}, Integrator::VarValues(0.0));
+
+    // Plastic sparse synapses with an axonal delay so presynaptic spikes are queued
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, 5, "Pre", "Post",
+        {}, WeightUpdateModel::VarValues(initVar<InitVarSnippet::Uniform>(uniform)),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProb));
+
+    // Dense synapses with a dendritic delay so input is queued postsynaptically
+    auto *synDen = model.addSynapsePopulation<WeightUpdateModels::StaticPulseDendriticDelay, PostsynapticModels::DeltaCurr>(
+        "SynDen", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModels::StaticPulseDendriticDelay::VarValues(initVar<InitVarSnippet::Uniform>(uniform), 3.0),
+        {}, {});
+    synDen->setMaxDendriticDelayTimesteps(4);
+
+    model.setPrecision(GENN_FLOAT);
+}
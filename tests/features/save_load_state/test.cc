@@ -0,0 +1,70 @@
+//--------------------------------------------------------------------------
+/*! \file save_load_state/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "save_load_state_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, SaveLoadState)
+{
+    // Simulate for a while before saving state
+    while(iT < 50) {
+        StepGeNN();
+    }
+    saveState("save_load_state.bin");
+    const float savedT = t;
+
+    // Continue simulation, recording membrane voltages
+    std::vector<float> recordedV;
+    unsigned int numPostSpikes = 0;
+    for(unsigned int i = 0; i < 100; i++) {
+        StepGeNN();
+        recordedV.insert(recordedV.end(), VPost, VPost + 20);
+        numPostSpikes += spikeCount_Post;
+    }
+    const std::vector<float> recordedW(wSyn, wSyn + (100 * maxRowLengthSyn));
+
+    // Check postsynaptic neurons actually spiked so learning occured
+    ASSERT_GT(numPostSpikes, 0);
+
+    // Reallocate memory and restore state from file rather than initialising
+    freeMem();
+    allocateMem();
+    loadState("save_load_state.bin");
+    ASSERT_EQ(iT, 50);
+    ASSERT_EQ(t, savedT);
+
+    // Simulation should continue identically
+    for(unsigned int i = 0; i < 100; i++) {
+        StepGeNN();
+        ASSERT_TRUE(std::equal(VPost, VPost + 20, recordedV.cbegin() + (i * 20)));
+    }
+    ASSERT_TRUE(std::equal(recordedW.cbegin(), recordedW.cend(), wSyn));
+}
+
+TEST_F(SimTest, LoadMissingState)
+{
+    EXPECT_THROW(loadState("missing_state.bin"), std::runtime_error);
+}
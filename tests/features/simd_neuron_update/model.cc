@@ -0,0 +1,108 @@
+//--------------------------------------------------------------------------
+/*! \file simd_neuron_update/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Counter
+//----------------------------------------------------------------------------
+//! Neuron which counts timesteps and spikes every 3-7 timesteps depending on its id
+class Counter : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Counter, 0, 1);
+
+    SET_SIM_CODE("$(V) += 1.0;\n");
+    SET_THRESHOLD_CONDITION_CODE("$(V) >= (scalar)(3 + ($(id) % 5))");
+    SET_RESET_CODE("$(V) = 0.0;\n");
+    SET_VARS({{"V", "scalar"}});
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(Counter);
+
+//----------------------------------------------------------------------------
+// PreVUpdate
+//----------------------------------------------------------------------------
+//! Weight update model whose presynaptic spike code reads presynaptic neuron state
+class PreVUpdate : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(PreVUpdate, 0, 0, 1, 0);
+
+    SET_PRE_VARS({{"preV", "scalar"}});
+    SET_PRE_SPIKE_CODE("$(preV) = $(V_pre);\n");
+};
+
+IMPLEMENT_MODEL(PreVUpdate);
+
+//----------------------------------------------------------------------------
+// PostVUpdate
+//----------------------------------------------------------------------------
+//! Weight update model whose postsynaptic spike code reads postsynaptic neuron state
+class PostVUpdate : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(PostVUpdate, 0, 0, 0, 1);
+
+    SET_POST_VARS({{"postV", "scalar"}});
+    SET_POST_SPIKE_CODE("$(postV) = $(V_post);\n");
+};
+
+IMPLEMENT_MODEL(PostVUpdate);
+
+//----------------------------------------------------------------------------
+// CountUpdate
+//----------------------------------------------------------------------------
+//! Weight update model which counts presynaptic spikes and has spike-like events
+class CountUpdate : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(CountUpdate, 0, 0, 1, 0);
+
+    SET_PRE_VARS({{"count", "scalar"}});
+    SET_PRE_SPIKE_CODE("$(count) += 1.0;\n");
+    SET_EVENT_CODE("$(addToInSyn, $(V_pre));\n");
+    SET_EVENT_THRESHOLD_CONDITION_CODE("$(V_pre) >= 2.0");
+};
+
+IMPLEMENT_MODEL(CountUpdate);
+
+void modelDefinition(ModelSpec &model)
+{
+    GENN_PREFERENCES.enableSIMDNeuronUpdate = true;
+
+    model.setDT(1.0);
+    model.setName("simd_neuron_update");
+
+    model.addNeuronPopulation<Counter>("Pre", 10, {}, Counter::VarValues(0.0));
+    model.addNeuronPopulation<Counter>("Post", 10, {}, Counter::VarValues(0.0));
+    model.addNeuronPopulation<Counter>("Events", 10, {}, Counter::VarValues(0.0));
+
+    // Spike code of these synapse populations reads the state of Pre and Post neurons respectively
+    model.addSynapsePopulation<PreVUpdate, PostsynapticModels::DeltaCurr>(
+        "PreV", SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY, "Pre", "Events",
+        {}, {}, PreVUpdate::PreVarValues(-1.0), {},
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>({}));
+    model.addSynapsePopulation<PostVUpdate, PostsynapticModels::DeltaCurr>(
+        "PostV", SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY, "Events", "Post",
+        {}, {}, {}, PostVUpdate::PostVarValues(-1.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>({}));
+
+    // Spike code of this synapse population doesn't read neuron state so Events neurons can be updated in two passes
+    model.addSynapsePopulation<CountUpdate, PostsynapticModels::DeltaCurr>(
+        "Count", SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY, "Events", "Post",
+        {}, {}, CountUpdate::PreVarValues(0.0), {},
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>({}));
+
+    model.setPrecision(GENN_FLOAT);
+}
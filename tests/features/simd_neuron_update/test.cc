@@ -0,0 +1,85 @@
+//--------------------------------------------------------------------------
+/*! \file simd_neuron_update/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Autogenerated simulation code includess
+#include "simd_neuron_update_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Check spikes emitted by population in timestep match those of the single-pass neuron update
+// **NOTE** the multi-threaded backend doesn't emit spikes in order
+void checkSpikes(unsigned int timestep, unsigned int spikeCount, const unsigned int *spikes)
+{
+    std::vector<unsigned int> correctSpikes;
+    for(unsigned int i = 0; i < 10; i++) {
+        if(((timestep + 1) % (3 + (i % 5))) == 0) {
+            correctSpikes.push_back(i);
+        }
+    }
+    std::vector<unsigned int> sortedSpikes(spikes, spikes + spikeCount);
+    std::sort(sortedSpikes.begin(), sortedSpikes.end());
+    ASSERT_EQ(sortedSpikes, correctSpikes);
+}
+}   // Anonymous namespace
+
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, SIMDNeuronUpdate)
+{
+    while(iT < 100) {
+        const unsigned int timestep = (unsigned int)iT;
+        StepGeNN();
+
+        // Check spikes
+        checkSpikes(timestep, glbSpkCntPre[0], glbSpkPre);
+        checkSpikes(timestep, glbSpkCntPost[0], glbSpkPost);
+        checkSpikes(timestep, glbSpkCntEvents[0], glbSpkEvents);
+
+        unsigned int numSpikeEvents = 0;
+        for(unsigned int i = 0; i < 10; i++) {
+            const unsigned int period = 3 + (i % 5);
+            const unsigned int numSpikes = (timestep + 1) / period;
+
+            // Check neuron state has been updated and reset
+            const scalar v = (scalar)((timestep + 1) % period);
+            ASSERT_EQ(VPre[i], v);
+            ASSERT_EQ(VPost[i], v);
+            ASSERT_EQ(VEvents[i], v);
+
+            // As in the single-pass neuron update, pre and postsynaptic spike code
+            // should read the neuron state from before it was updated and reset
+            const scalar spikeV = (numSpikes == 0) ? -1.0f : (scalar)(period - 1);
+            ASSERT_EQ(preVPreV[i], spikeV);
+            ASSERT_EQ(postVPostV[i], spikeV);
+
+            // Check presynaptic spike code has been run for every spike
+            ASSERT_EQ(countCount[i], (scalar)numSpikes);
+
+            // Spike-like events are emitted if state, before being reset, is at least 2
+            if((v >= 2.0f) || (v == 0.0f)) {
+                numSpikeEvents++;
+            }
+        }
+        ASSERT_EQ(glbSpkCntEvntEvents[0], numSpikeEvents);
+    }
+}
@@ -0,0 +1,41 @@
+//--------------------------------------------------------------------------
+/*! \file spike_recording/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+//! Neuron which spikes every 10 timesteps, offset by its id
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("($(id) % 10) == ((unsigned int)rint($(t)) % 10)");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("spike_recording");
+
+    // **NOTE** population sizes are chosen so the last word of each timestep's recording is only partially used
+    NeuronGroup *pop = model.addNeuronPopulation<Neuron>("Pop", 100, {}, {});
+    NeuronGroup *pop2 = model.addNeuronPopulation<Neuron>("Pop2", 40, {}, {});
+    pop->setSpikeRecordingEnabled(true);
+    pop2->setSpikeRecordingEnabled(true);
+
+    model.setPrecision(GENN_FLOAT);
+    model.setTimePrecision(TimePrecision::DOUBLE);
+}
@@ -0,0 +1,92 @@
+//--------------------------------------------------------------------------
+/*! \file spike_recording/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <stdexcept>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "spike_recording_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    //--------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //--------------------------------------------------------------------------
+    virtual void Init()
+    {
+        allocateRecordingBuffers(25);
+    }
+
+    //--------------------------------------------------------------------------
+    // Protected methods
+    //--------------------------------------------------------------------------
+    void checkRecording(const uint32_t *recordSpk, unsigned int numNeurons, unsigned int numTimesteps) const
+    {
+        const unsigned int numWords = (numNeurons + 31) / 32;
+
+        // Loop through recording slots
+        for(unsigned int s = 0; s < 25; s++) {
+            // Buffer is circular so, once it has wrapped, early slots contain later timesteps
+            const unsigned int timestep = (s < (numTimesteps - 25)) ? (s + 25) : s;
+
+            // Check each neuron's bit is set only if it spiked in this timestep
+            for(unsigned int i = 0; i < (numWords * 32); i++) {
+                const bool spiked = ((recordSpk[(s * numWords) + (i / 32)] & (1u << (i % 32))) != 0);
+                const bool shouldSpike = (i < numNeurons) && ((i % 10) == (timestep % 10));
+                EXPECT_EQ(spiked, shouldSpike) << "slot " << s << ", neuron " << i;
+            }
+        }
+    }
+};
+
+TEST_F(SimTest, SpikeRecording)
+{
+    // Simulate for longer than the recording buffers so they wrap around
+    for(unsigned int t = 0; t < 30; t++) {
+        StepGeNN();
+    }
+
+    // Download recording buffers and check contents
+    pullRecordingBuffersFromDevice();
+    checkRecording(recordSpkPop, 100, 30);
+    checkRecording(recordSpkPop2, 40, 30);
+}
+
+TEST_F(SimTest, SpikeRecordingNotAllocated)
+{
+    // Free memory, including recording buffers, and reallocate model without recording buffers
+    // **NOTE** time isn't reset by initialize so reset it manually
+    freeMem();
+    allocateMem();
+    iT = 0;
+    t = 0.0f;
+    initialize();
+    initializeSparse();
+
+    // Simulating should fail without advancing time rather than writing to freed buffers
+    EXPECT_THROW(stepTime(), std::runtime_error);
+    EXPECT_EQ(iT, 0);
+
+    // Once buffers are reallocated, simulation should record again
+    allocateRecordingBuffers(25);
+    for(unsigned int t = 0; t < 30; t++) {
+        StepGeNN();
+    }
+    pullRecordingBuffersFromDevice();
+    checkRecording(recordSpkPop, 100, 30);
+}
@@ -0,0 +1,101 @@
+//--------------------------------------------------------------------------
+/*! \file step_time_n/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x) += $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// AlwaysSpike
+//----------------------------------------------------------------------------
+class AlwaysSpike : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(AlwaysSpike, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(AlwaysSpike);
+
+//----------------------------------------------------------------------------
+// EGPNeuron
+//----------------------------------------------------------------------------
+//! Neuron which integrates a scalar extra global parameter and its synaptic input separately
+class EGPNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(EGPNeuron, 0, 2);
+
+    SET_SIM_CODE(
+        "$(x) += $(input);\n"
+        "$(y) += $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}, {"y", "scalar"}});
+    SET_EXTRA_GLOBAL_PARAMS({{"input", "scalar"}});
+};
+
+IMPLEMENT_MODEL(EGPNeuron);
+
+//----------------------------------------------------------------------------
+// EGPWeightUpdate
+//----------------------------------------------------------------------------
+//! Weight update model whose weight is a scalar extra global parameter
+class EGPWeightUpdate : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(EGPWeightUpdate, 0, 0, 0, 0);
+
+    SET_SIM_CODE("$(addToInSyn, $(weight));\n");
+
+    SET_EXTRA_GLOBAL_PARAMS({{"weight", "scalar"}});
+};
+
+IMPLEMENT_MODEL(EGPWeightUpdate);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("step_time_n");
+
+    auto *pre = model.addNeuronPopulation<AlwaysSpike>("Pre", 1, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 1, {}, Neuron::VarValues(0.0));
+
+    // Delayed synapses so stepping must advance the presynaptic spike queue
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::DENSE_GLOBALG, 5, "Pre", "Post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(1.0),
+        {}, {});
+
+    // Neuron and synapse populations with scalar extra global parameters which must be pushed for every timestep
+    model.addNeuronPopulation<EGPNeuron>("EGP", 1, {}, EGPNeuron::VarValues(0.0, 0.0));
+    model.addSynapsePopulation<EGPWeightUpdate, PostsynapticModels::DeltaCurr>(
+        "EGPSyn", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Pre", "EGP",
+        {}, {},
+        {}, {});
+
+    // Record presynaptic spikes so stepping must also advance the recording buffers
+    pre->setSpikeRecordingEnabled(true);
+
+    model.setPrecision(GENN_FLOAT);
+}
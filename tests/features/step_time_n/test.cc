@@ -0,0 +1,115 @@
+//--------------------------------------------------------------------------
+/*! \file step_time_n/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "step_time_n_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    //--------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //--------------------------------------------------------------------------
+    virtual void Init()
+    {
+        allocateRecordingBuffers(10);
+    }
+};
+
+TEST_F(SimTest, StepTimeN)
+{
+    // Record timestep and postsynaptic input every 3 timesteps
+    std::vector<std::pair<unsigned long long, float>> records;
+    stepTimeN(20, 3,
+              [](void *context)
+              {
+                  pullPostStateFromDevice();
+                  static_cast<std::vector<std::pair<unsigned long long, float>>*>(context)->emplace_back(iT, xPost[0]);
+              },
+              &records);
+
+    // Spikes emitted every timestep arrive after the 5 timestep delay and a further timestep
+    // to be processed so should have been integrated once per timestep from the seventh
+    ASSERT_EQ(records.size(), 6);
+    for(size_t i = 0; i < records.size(); i++) {
+        ASSERT_EQ(records[i].first, 3 * (i + 1));
+        ASSERT_FLOAT_EQ(records[i].second, (float)std::max(0, (int)records[i].first - 6));
+    }
+
+    // Continue simulation without callback
+    stepTimeN(5);
+    copyStateFromDevice();
+    ASSERT_EQ(iT, 25);
+    ASSERT_FLOAT_EQ(t, 25.0f * DT);
+    ASSERT_FLOAT_EQ(xPost[0], 19.0f);
+
+    // Presynaptic neuron spikes every timestep so every slot of the wrapped recording buffer should be set
+    pullRecordingBuffersFromDevice();
+    for(unsigned int s = 0; s < 10; s++) {
+        ASSERT_EQ(recordSpkPre[s], 1u);
+    }
+}
+
+TEST_F(SimTest, StepTimeNScalarEGP)
+{
+    // Set scalar extra global parameters before simulating
+    inputEGP = 2.0f;
+    weightEGPSyn = 3.0f;
+
+    // Record neuron state every timestep, changing neuron input after the fifth
+    std::vector<std::pair<float, float>> records;
+    stepTimeN(10, 1,
+              [](void *context)
+              {
+                  pullEGPStateFromDevice();
+                  auto *records = static_cast<std::vector<std::pair<float, float>>*>(context);
+                  records->emplace_back(xEGP[0], yEGP[0]);
+                  if(records->size() == 5) {
+                      inputEGP = 4.0f;
+                  }
+              },
+              &records);
+
+    // Input should have been integrated every timestep and synaptic input, from spikes emitted
+    // every timestep, should have been integrated every timestep after the first
+    ASSERT_EQ(records.size(), 10);
+    for(size_t i = 0; i < records.size(); i++) {
+        const float timestep = (float)(i + 1);
+        ASSERT_FLOAT_EQ(records[i].first, (i < 5) ? (2.0f * timestep) : (10.0f + (4.0f * (timestep - 5.0f))));
+        ASSERT_FLOAT_EQ(records[i].second, 3.0f * (timestep - 1.0f));
+    }
+}
+
+TEST_F(SimTest, StepTimeNRecordingNotAllocated)
+{
+    // Reallocate model without recording buffers
+    freeMem();
+    allocateMem();
+    initialize();
+    initializeSparse();
+
+    // Simulating multiple timesteps should fail without advancing time
+    const unsigned long long startTimestep = iT;
+    EXPECT_THROW(stepTimeN(5), std::runtime_error);
+    EXPECT_EQ(iT, startTimestep);
+}
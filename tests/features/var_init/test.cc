@@ -73,7 +73,10 @@ double getProb(scalar *data, unsigned int size, F cdf)
 
 TEST_F(SimTest, Vars)
 {
-    const double p = 0.02;
+    // 20 distributions are tested so, at a per-test significance of 0.02, a third of seeds would fail at least one
+    // test by chance. Instead divide a 0.02 family-wise significance between the tests (Bonferroni correction).
+    // **NOTE** the large-sample neuron_rng_ziggurat tests are much more sensitive to sampling errors
+    const double p = 0.02 / 20.0;
 
     // Pull vars back to host
     pullPopStateFromDevice();
@@ -0,0 +1,346 @@
+#include "networkServer.h"
+
+// Standard C++ includes
+#include <algorithm>
+#include <stdexcept>
+
+// Standard C includes
+#include <cstring>
+
+// POSIX includes
+#include <fcntl.h>
+#include <sys/mman.h>
+
+using namespace SpineMLSimulator;
+
+//----------------------------------------------------------------------------
+// NetworkServer
+//----------------------------------------------------------------------------
+NetworkServer::NetworkServer(const std::vector<std::vector<double>> &sendData, bool batchedSupported)
+:   m_SendData(sendData), m_BatchedSupported(batchedSupported), m_Socket(-1), m_Mode(NetworkClient::Mode::Source),
+    m_Size(0), m_Batched(false), m_BatchTimesteps(1), m_SharedRing(nullptr), m_SharedRingBytes(0), m_NumMessages(0)
+{
+    // Create socket and listen on ephemeral loopback port
+    m_ListenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if(m_ListenSocket < 0) {
+        throw std::runtime_error("Unable to create socket");
+    }
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(sockaddr_in));
+    address.sin_family = AF_INET;
+    address.sin_port = 0;
+    address.sin_addr.s_addr = inet_addr("127.0.0.1");
+    socklen_t addressLength = sizeof(address);
+    if(bind(m_ListenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0
+        || listen(m_ListenSocket, 1) < 0
+        || getsockname(m_ListenSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) < 0)
+    {
+        close(m_ListenSocket);
+        throw std::runtime_error("Unable to listen on socket");
+    }
+    m_Port = ntohs(address.sin_port);
+
+    // Serve client in background
+    m_Thread = std::thread(&NetworkServer::serve, this);
+}
+//----------------------------------------------------------------------------
+NetworkServer::~NetworkServer()
+{
+    join();
+
+    if(m_SharedRing != nullptr) {
+        munmap(m_SharedRing, m_SharedRingBytes);
+    }
+    close(m_ListenSocket);
+}
+//----------------------------------------------------------------------------
+void NetworkServer::join()
+{
+    if(m_Thread.joinable()) {
+        m_Thread.join();
+    }
+}
+//----------------------------------------------------------------------------
+void NetworkServer::serve()
+{
+    // Accept single client
+    m_Socket = accept(m_ListenSocket, nullptr, nullptr);
+    if(m_Socket < 0) {
+        return;
+    }
+    const int disableNagle = 1;
+    setsockopt(m_Socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&disableNagle), sizeof(int));
+
+    if(handshake()) {
+        // If client is a source, receive data from it
+        if(m_Mode == NetworkClient::Mode::Source) {
+            if(m_SharedRing != nullptr) {
+                receiveSharedRing();
+            }
+            else if(m_Batched) {
+                receiveBatchedTCP();
+            }
+            else {
+                receiveStandard();
+            }
+        }
+        // Otherwise send data to it
+        else {
+            if(m_SharedRing != nullptr) {
+                sendSharedRing();
+            }
+            else if(m_Batched) {
+                sendBatchedTCP();
+            }
+            else {
+                sendStandard();
+            }
+        }
+    }
+
+    close(m_Socket);
+}
+//----------------------------------------------------------------------------
+bool NetworkServer::handshake()
+{
+    // Read first request, if it's a batched protocol request, acknowledge and read mode
+    char request;
+    if(!receiveAll(&request, sizeof(char))) {
+        return false;
+    }
+    if(request == static_cast<char>(NetworkClient::Extension::Batched)) {
+        if(!m_BatchedSupported) {
+            sendResponse(Response::Abort);
+            return false;
+        }
+
+        m_Batched = true;
+        if(!sendResponse(Response::Hello) || !receiveAll(&request, sizeof(char))) {
+            return false;
+        }
+    }
+    m_Mode = static_cast<NetworkClient::Mode>(request);
+    if(!sendResponse(Response::Hello)) {
+        return false;
+    }
+
+    // Read data type and size
+    NetworkClient::DataType dataType;
+    if(!receiveAll(&dataType, sizeof(NetworkClient::DataType)) || !sendResponse(Response::Received)
+        || !receiveAll(&m_Size, sizeof(unsigned int)) || !sendResponse(Response::Received))
+    {
+        return false;
+    }
+
+    // Read connection name
+    int connectionNameLength;
+    if(!receiveAll(&connectionNameLength, sizeof(int))) {
+        return false;
+    }
+    m_ConnectionName.resize(connectionNameLength);
+    if(!receiveAll(&m_ConnectionName[0], connectionNameLength) || !sendResponse(Response::Received)) {
+        return false;
+    }
+
+    // If batched protocol is in use
+    if(m_Batched) {
+        // Read batch size
+        if(!receiveAll(&m_BatchTimesteps, sizeof(unsigned int)) || !sendResponse(Response::Received)) {
+            return false;
+        }
+
+        // Read shared ring name
+        int ringNameLength;
+        if(!receiveAll(&ringNameLength, sizeof(int))) {
+            return false;
+        }
+        std::string ringName(ringNameLength, '\0');
+        if(!receiveAll(&ringName[0], ringNameLength)) {
+            return false;
+        }
+
+        // If one is specified, map shared ring
+        if(!ringName.empty()) {
+            const int file = shm_open(ringName.c_str(), O_RDWR, 0600);
+            if(file == -1) {
+                sendResponse(Response::Abort);
+                return false;
+            }
+            m_SharedRingBytes = sizeof(NetworkClient::SharedRingHeader)
+                + (NetworkClient::getSharedRingSlotBytes(m_Size, m_BatchTimesteps) * NetworkClient::numBatchesInFlight);
+            void *ring = mmap(nullptr, m_SharedRingBytes, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+            close(file);
+            if(ring == MAP_FAILED) {
+                sendResponse(Response::Abort);
+                return false;
+            }
+            m_SharedRing = reinterpret_cast<NetworkClient::SharedRingHeader*>(ring);
+        }
+        if(!sendResponse(Response::Received)) {
+            return false;
+        }
+    }
+    return true;
+}
+//----------------------------------------------------------------------------
+void NetworkServer::receiveStandard()
+{
+    // Receive timesteps and acknowledge each one until client disconnects
+    std::vector<double> timestep(m_Size);
+    while(receiveAll(timestep.data(), sizeof(double) * m_Size)) {
+        m_ReceivedData.push_back(timestep);
+        m_NumMessages++;
+        if(!sendResponse(Response::Received)) {
+            return;
+        }
+    }
+}
+//----------------------------------------------------------------------------
+void NetworkServer::receiveBatchedTCP()
+{
+    // Receive batches and acknowledge each one until client disconnects
+    uint32_t numTimesteps;
+    while(receiveAll(&numTimesteps, sizeof(uint32_t))) {
+        std::vector<double> batch((size_t)m_Size * numTimesteps);
+        if(!receiveAll(batch.data(), sizeof(double) * batch.size())) {
+            return;
+        }
+        for(uint32_t t = 0; t < numTimesteps; t++) {
+            m_ReceivedData.emplace_back(&batch[t * m_Size], &batch[(t + 1) * m_Size]);
+        }
+        m_NumMessages++;
+        if(!sendResponse(Response::Received)) {
+            return;
+        }
+    }
+}
+//----------------------------------------------------------------------------
+void NetworkServer::receiveSharedRing()
+{
+    while(true) {
+        // Wait for a filled slot, stopping once client has finished and ring is empty
+        const uint32_t tail = m_SharedRing->tail.load(std::memory_order_relaxed);
+        while(m_SharedRing->head.load(std::memory_order_acquire) == tail) {
+            if(m_SharedRing->state.load(std::memory_order_acquire) != NetworkClient::RingState::Running) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+
+        // Copy timesteps out of slot and free it
+        const char *slot = NetworkClient::getSharedRingSlot(m_SharedRing, tail);
+        uint64_t numTimesteps;
+        std::memcpy(&numTimesteps, slot, sizeof(uint64_t));
+        const double *batch = reinterpret_cast<const double*>(slot + sizeof(uint64_t));
+        for(uint64_t t = 0; t < numTimesteps; t++) {
+            m_ReceivedData.emplace_back(&batch[t * m_Size], &batch[(t + 1) * m_Size]);
+        }
+        m_NumMessages++;
+        m_SharedRing->tail.store(tail + 1, std::memory_order_release);
+    }
+}
+//----------------------------------------------------------------------------
+void NetworkServer::sendStandard()
+{
+    // Send timesteps, waiting for each to be acknowledged
+    for(const auto &timestep : m_SendData) {
+        Response response;
+        if(!sendAll(timestep.data(), sizeof(double) * m_Size) || !receiveAll(&response, sizeof(Response))) {
+            return;
+        }
+        m_NumMessages++;
+    }
+}
+//----------------------------------------------------------------------------
+void NetworkServer::sendBatchedTCP()
+{
+    // Send batches, only waiting for acknowledgements when the maximum number are in flight
+    unsigned int numUnacknowledged = 0;
+    for(size_t start = 0; start < m_SendData.size(); start += m_BatchTimesteps) {
+        if(numUnacknowledged == NetworkClient::numBatchesInFlight) {
+            Response response;
+            if(!receiveAll(&response, sizeof(Response))) {
+                return;
+            }
+            numUnacknowledged--;
+        }
+
+        const uint32_t numTimesteps = (uint32_t)std::min<size_t>(m_BatchTimesteps, m_SendData.size() - start);
+        if(!sendAll(&numTimesteps, sizeof(uint32_t))) {
+            return;
+        }
+        for(uint32_t t = 0; t < numTimesteps; t++) {
+            if(!sendAll(m_SendData[start + t].data(), sizeof(double) * m_Size)) {
+                return;
+            }
+        }
+        m_NumMessages++;
+        numUnacknowledged++;
+    }
+
+    // Wait for remaining acknowledgements
+    for(; numUnacknowledged > 0; numUnacknowledged--) {
+        Response response;
+        if(!receiveAll(&response, sizeof(Response))) {
+            return;
+        }
+    }
+}
+//----------------------------------------------------------------------------
+void NetworkServer::sendSharedRing()
+{
+    for(size_t start = 0; start < m_SendData.size(); start += m_BatchTimesteps) {
+        // Wait for a free slot, stopping if client has finished
+        const uint32_t head = m_SharedRing->head.load(std::memory_order_relaxed);
+        while((head - m_SharedRing->tail.load(std::memory_order_acquire)) >= NetworkClient::numBatchesInFlight) {
+            if(m_SharedRing->state.load(std::memory_order_acquire) != NetworkClient::RingState::Running) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+
+        // Copy timesteps into slot and pass it to client
+        char *slot = NetworkClient::getSharedRingSlot(m_SharedRing, head);
+        const uint64_t numTimesteps = std::min<size_t>(m_BatchTimesteps, m_SendData.size() - start);
+        std::memcpy(slot, &numTimesteps, sizeof(uint64_t));
+        for(uint64_t t = 0; t < numTimesteps; t++) {
+            std::memcpy(slot + sizeof(uint64_t) + (sizeof(double) * m_Size * t), m_SendData[start + t].data(), sizeof(double) * m_Size);
+        }
+        m_NumMessages++;
+        m_SharedRing->head.store(head + 1, std::memory_order_release);
+    }
+
+    // **NOTE** client can empty ring after we disconnect
+}
+//----------------------------------------------------------------------------
+bool NetworkServer::sendAll(const void *data, size_t size)
+{
+    const char *bytes = reinterpret_cast<const char*>(data);
+    for(size_t totalSentBytes = 0; totalSentBytes < size;) {
+        const ssize_t sentBytes = ::send(m_Socket, bytes + totalSentBytes, size - totalSentBytes, MSG_NOSIGNAL);
+        if(sentBytes < 1) {
+            return false;
+        }
+        totalSentBytes += sentBytes;
+    }
+    return true;
+}
+//----------------------------------------------------------------------------
+bool NetworkServer::receiveAll(void *data, size_t size)
+{
+    char *bytes = reinterpret_cast<char*>(data);
+    for(size_t totalReceivedBytes = 0; totalReceivedBytes < size;) {
+        const ssize_t receivedBytes = ::recv(m_Socket, bytes + totalReceivedBytes, size - totalReceivedBytes, MSG_WAITALL);
+        if(receivedBytes < 1) {
+            return false;
+        }
+        totalReceivedBytes += receivedBytes;
+    }
+    return true;
+}
+//----------------------------------------------------------------------------
+bool NetworkServer::sendResponse(Response response)
+{
+    return sendAll(&response, sizeof(Response));
+}
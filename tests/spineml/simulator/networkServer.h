@@ -0,0 +1,91 @@
+#pragma once
+
+// Standard C++ includes
+#include <string>
+#include <thread>
+#include <vector>
+
+// SpineML simulator includes
+#include "networkClient.h"
+
+//----------------------------------------------------------------------------
+// NetworkServer
+//----------------------------------------------------------------------------
+//! Local stand-in for an external SpineML network peer
+/*! Listens on an ephemeral loopback port and serves a single client on a background
+    thread using either the standard or the batched protocol. Target clients are
+    sent sendData and the data sent by source clients is recorded. */
+class NetworkServer
+{
+public:
+    NetworkServer(const std::vector<std::vector<double>> &sendData = {}, bool batchedSupported = true);
+    ~NetworkServer();
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    unsigned int getPort() const{ return m_Port; }
+
+    //! Wait for client to disconnect
+    void join();
+
+    // **NOTE** only valid after join
+    const std::vector<std::vector<double>> &getReceivedData() const{ return m_ReceivedData; }
+    const std::string &getConnectionName() const{ return m_ConnectionName; }
+    unsigned int getBatchTimesteps() const{ return m_BatchTimesteps; }
+    unsigned int getNumMessages() const{ return m_NumMessages; }
+    bool isSharedMemoryUsed() const{ return m_SharedRing != nullptr; }
+
+private:
+    //------------------------------------------------------------------------
+    // Enumerations
+    //------------------------------------------------------------------------
+    //! Responses defined by the external network protocol
+    enum class Response : char
+    {
+        Hello = 41,
+        Received = 42,
+        Abort = 43,
+        Finished = 44,
+    };
+
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    void serve();
+    bool handshake();
+    void receiveStandard();
+    void receiveBatchedTCP();
+    void receiveSharedRing();
+    void sendStandard();
+    void sendBatchedTCP();
+    void sendSharedRing();
+
+    bool sendAll(const void *data, size_t size);
+    bool receiveAll(void *data, size_t size);
+    bool sendResponse(Response response);
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    const std::vector<std::vector<double>> m_SendData;
+    const bool m_BatchedSupported;
+
+    int m_ListenSocket;
+    int m_Socket;
+    unsigned int m_Port;
+
+    // State negotiated with client
+    SpineMLSimulator::NetworkClient::Mode m_Mode;
+    unsigned int m_Size;
+    std::string m_ConnectionName;
+    bool m_Batched;
+    unsigned int m_BatchTimesteps;
+    SpineMLSimulator::NetworkClient::SharedRingHeader *m_SharedRing;
+    size_t m_SharedRingBytes;
+
+    std::vector<std::vector<double>> m_ReceivedData;
+    unsigned int m_NumMessages;
+
+    std::thread m_Thread;
+};
@@ -0,0 +1,58 @@
+// Standard C++ includes
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+// Standard C includes
+#include <cstdio>
+#include <cstring>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// SpineML simulator includes
+#include "asyncWriter.h"
+
+using namespace SpineMLSimulator;
+
+//------------------------------------------------------------------------
+// AsyncWriter tests
+//------------------------------------------------------------------------
+TEST(AsyncWriterTest, Backpressure) {
+    const char *filename = "testAsyncWriter.bin";
+    {
+        // Create writer with only two buffers whose write function is slower than producer
+        AsyncWriter writer(filename, std::ios::binary, sizeof(unsigned int) * 4, 2,
+                           [](std::ofstream &file, const char *snapshot, size_t size)
+                           {
+                               std::this_thread::sleep_for(std::chrono::microseconds(100));
+                               file.write(snapshot, size);
+                           });
+
+        // Write snapshots of varying size
+        for(unsigned int i = 0; i < 100; i++) {
+            const unsigned int snapshot[4] = {i, i + 1, i + 2, i + 3};
+            const size_t size = sizeof(unsigned int) * (1 + (i % 4));
+            std::memcpy(writer.acquireBuffer(), snapshot, size);
+            writer.commitBuffer(size);
+        }
+    }
+
+    // Read file back
+    std::ifstream file(filename, std::ios::binary);
+    std::vector<char> bytes{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    file.close();
+    std::remove(filename);
+
+    // Check all snapshots were written in order
+    std::vector<unsigned int> correct;
+    for(unsigned int i = 0; i < 100; i++) {
+        for(unsigned int j = 0; j < (1 + (i % 4)); j++) {
+            correct.push_back(i + j);
+        }
+    }
+    ASSERT_EQ(bytes.size(), correct.size() * sizeof(unsigned int));
+    ASSERT_EQ(std::memcmp(bytes.data(), correct.data(), bytes.size()), 0);
+}
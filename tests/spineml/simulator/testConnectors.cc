@@ -1,3 +1,15 @@
+// Standard C++ includes
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <vector>
+
+// Standard C includes
+#include <cstdint>
+#include <cstdio>
+
 // Filesystem includes
 #include "path.h"
 
@@ -692,3 +704,111 @@ TEST(ConnectionListTest, BinaryFileSparse) {
     // Check number of connections matches XML
     EXPECT_EQ(remapIndices.size(), 294);
 }
+//------------------------------------------------------------------------
+TEST(ConnectionListTest, BinaryFileTruncated) {
+    // XML fragment specifying connector with more connections than are in file
+    const char *connectorXML =
+        "<LL:Synapse>\n"
+        "   <ConnectionList>\n"
+        "       <BinaryFile file_name=\"connection1.bin\" num_connections=\"295\" explicit_delay_flag=\"0\" packed_data=\"\"/>\n"
+        "   </ConnectionList>\n"
+        "</LL:Synapse>\n";
+
+    // Load XML and get root LL:Synapse element
+    pugi::xml_document connectorDocument;
+    connectorDocument.load_string(connectorXML);
+    auto synapse = connectorDocument.child("LL:Synapse");
+
+    // Parse XML and check creating sparse connector fails
+    filesystem::path basePath;
+    std::vector<unsigned int> remapIndices;
+    const unsigned int maxRowLength = 42;
+    unsigned int *rowLength = new unsigned int[42];
+    unsigned int *ind = new unsigned int[42 * maxRowLength];
+    try
+    {
+        Connectors::create(synapse, 1.0, 42, 42,
+                           &rowLength, &ind, nullptr, &maxRowLength,
+                           basePath, remapIndices);
+        FAIL();
+    }
+    catch(const std::runtime_error &)
+    {
+    }
+
+    delete [] ind;
+    delete [] rowLength;
+}
+//------------------------------------------------------------------------
+TEST(ConnectionListTest, BinaryFileShuffleSparseDelay) {
+    // Build fixed number of random, unique connections from each presynaptic neuron
+    const unsigned int numPre = 1000;
+    const unsigned int numPost = 1000;
+    const unsigned int maxRowLength = 200;
+    std::mt19937 rng(1234);
+    std::vector<unsigned int> rowPost(numPost);
+    std::iota(rowPost.begin(), rowPost.end(), 0);
+    std::vector<std::tuple<uint32_t, uint32_t, float>> connections;
+    for(unsigned int i = 0; i < numPre; i++) {
+        std::shuffle(rowPost.begin(), rowPost.end(), rng);
+        for(unsigned int j = 0; j < maxRowLength; j++) {
+            connections.emplace_back(i, rowPost[j], (float)(i % 10));
+        }
+    }
+
+    // Shuffle connections and write to binary file with explicit delays
+    std::shuffle(connections.begin(), connections.end(), rng);
+    {
+        std::ofstream file("testConnectorsShuffle.bin", std::ios::binary);
+        for(const auto &c : connections) {
+            file.write(reinterpret_cast<const char*>(&std::get<0>(c)), sizeof(uint32_t));
+            file.write(reinterpret_cast<const char*>(&std::get<1>(c)), sizeof(uint32_t));
+            file.write(reinterpret_cast<const char*>(&std::get<2>(c)), sizeof(float));
+        }
+    }
+
+    // XML fragment specifying connector
+    const std::string connectorXML =
+        "<LL:Synapse>\n"
+        "   <ConnectionList>\n"
+        "       <BinaryFile file_name=\"testConnectorsShuffle.bin\" num_connections=\"" + std::to_string(connections.size()) + "\" explicit_delay_flag=\"1\" packed_data=\"\"/>\n"
+        "   </ConnectionList>\n"
+        "</LL:Synapse>\n";
+
+    // Load XML and get root LL:Synapse element
+    pugi::xml_document connectorDocument;
+    connectorDocument.load_string(connectorXML.c_str());
+    auto synapse = connectorDocument.child("LL:Synapse");
+
+    // Parse XML and create sparse connector
+    filesystem::path basePath;
+    std::vector<unsigned int> remapIndices;
+    unsigned int *rowLength = new unsigned int[numPre];
+    unsigned int *ind = new unsigned int[numPre * maxRowLength];
+    uint8_t *delay = new uint8_t[numPre * maxRowLength];
+    Connectors::create(synapse, 1.0, numPre, numPost,
+                       &rowLength, &ind, &delay, &maxRowLength,
+                       basePath, remapIndices);
+    std::remove("testConnectorsShuffle.bin");
+
+    // Check rows are full, sorted and have correct delays
+    for(unsigned int i = 0; i < numPre; i++) {
+        ASSERT_EQ(rowLength[i], maxRowLength);
+        ASSERT_TRUE(std::is_sorted(&ind[i * maxRowLength], &ind[(i + 1) * maxRowLength]));
+        for(unsigned int j = 0; j < maxRowLength; j++) {
+            ASSERT_EQ(delay[(i * maxRowLength) + j], i % 10);
+        }
+    }
+
+    // Check each connection is remapped to its location in the ragged structure
+    ASSERT_EQ(remapIndices.size(), connections.size());
+    for(size_t c = 0; c < connections.size(); c++) {
+        const unsigned int remapIndex = remapIndices[c];
+        ASSERT_EQ(remapIndex / maxRowLength, std::get<0>(connections[c]));
+        ASSERT_EQ(ind[remapIndex], std::get<1>(connections[c]));
+    }
+
+    delete [] delay;
+    delete [] ind;
+    delete [] rowLength;
+}
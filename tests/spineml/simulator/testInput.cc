@@ -0,0 +1,162 @@
+// Standard C++ includes
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// pugixml includes
+#include "pugixml/pugixml.hpp"
+
+// SpineML simulator includes
+#include "input.h"
+#include "inputValue.h"
+
+using namespace SpineMLSimulator;
+
+//------------------------------------------------------------------------
+// Anonymous namespace
+//------------------------------------------------------------------------
+namespace
+{
+// Host spike buffers inputs inject spikes into
+unsigned int hostSpikeCount[1];
+std::vector<unsigned int> hostSpikes;
+
+// Spikes 'uploaded' by each timestep
+std::vector<std::vector<unsigned int>> uploadedSpikes;
+
+void pushCurrentSpikes()
+{
+    uploadedSpikes.emplace_back(hostSpikes.begin(), hostSpikes.begin() + hostSpikeCount[0]);
+}
+
+template<typename I>
+std::unique_ptr<Input::Base> createSpikeInput(double dt, unsigned int popSize, const pugi::xml_node &node)
+{
+    // Reset spike buffers
+    hostSpikeCount[0] = 0;
+    hostSpikes.assign(popSize, 0);
+    uploadedSpikes.clear();
+
+    // Create input value and spike input
+    std::map<std::string, InputValue::External*> externalInputs;
+    auto inputValue = InputValue::create(dt, popSize, node, externalInputs);
+    return std::unique_ptr<Input::Base>(new I(dt, node, std::move(inputValue), popSize, nullptr,
+                                              hostSpikeCount, hostSpikes.data(), &pushCurrentSpikes));
+}
+}   // Anonymous namespace
+
+//------------------------------------------------------------------------
+// RegularSpikeRate tests
+//------------------------------------------------------------------------
+TEST(RegularSpikeRateTest, Constant) {
+    // XML fragment specifying input with 100Hz rate
+    const char *inputXML = "<ConstantInput value=\"100.0\"/>\n";
+
+    pugi::xml_document inputDocument;
+    inputDocument.load_string(inputXML);
+    auto input = createSpikeInput<Input::RegularSpikeRate>(1.0, 10, inputDocument.child("ConstantInput"));
+
+    // Apply input for 100 timesteps
+    for(unsigned long long t = 0; t < 100; t++) {
+        input->apply(1.0, t);
+    }
+
+    // Check all neurons spike every 10 timesteps
+    ASSERT_EQ(uploadedSpikes.size(), 100);
+    for(unsigned int t = 0; t < 100; t++) {
+        if(t != 0 && (t % 10) == 0) {
+            ASSERT_EQ(uploadedSpikes[t].size(), 10);
+        }
+        else {
+            ASSERT_TRUE(uploadedSpikes[t].empty());
+        }
+    }
+}
+//------------------------------------------------------------------------
+TEST(RegularSpikeRateTest, TimeVarying) {
+    // XML fragment specifying input with 100Hz rate for 50ms and then 50Hz for 50ms before turning off
+    const char *inputXML =
+        "<TimeVaryingInput target_indices=\"1,3\">\n"
+        "   <TimePointValue time=\"0\" value=\"100.0\"/>\n"
+        "   <TimePointValue time=\"50\" value=\"50.0\"/>\n"
+        "   <TimePointValue time=\"100\" value=\"0.0\"/>\n"
+        "</TimeVaryingInput>\n";
+
+    pugi::xml_document inputDocument;
+    inputDocument.load_string(inputXML);
+    auto input = createSpikeInput<Input::RegularSpikeRate>(1.0, 4, inputDocument.child("TimeVaryingInput"));
+
+    // Apply input for 200 timesteps
+    for(unsigned long long t = 0; t < 200; t++) {
+        input->apply(1.0, t);
+    }
+
+    // Check targetted neurons spike at the expected times and no others do
+    ASSERT_EQ(uploadedSpikes.size(), 200);
+    for(unsigned int t = 0; t < 200; t++) {
+        const bool spike = (t < 50) ? (t != 0 && (t % 10) == 0) : ((t < 100) && (t == 70 || t == 90));
+        if(spike) {
+            ASSERT_EQ(uploadedSpikes[t].size(), 2);
+            ASSERT_TRUE((uploadedSpikes[t][0] == 1 && uploadedSpikes[t][1] == 3)
+                        || (uploadedSpikes[t][0] == 3 && uploadedSpikes[t][1] == 1));
+        }
+        else {
+            ASSERT_TRUE(uploadedSpikes[t].empty());
+        }
+    }
+}
+//------------------------------------------------------------------------
+TEST(RegularSpikeRateTest, LongInterval) {
+    // XML fragment specifying input with 0.1Hz rate i.e. further in the future than a single rotation of timing wheel
+    const char *inputXML = "<ConstantInput value=\"0.1\"/>\n";
+
+    pugi::xml_document inputDocument;
+    inputDocument.load_string(inputXML);
+    auto input = createSpikeInput<Input::RegularSpikeRate>(1.0, 1, inputDocument.child("ConstantInput"));
+
+    // Apply input for 25s
+    for(unsigned long long t = 0; t < 25000; t++) {
+        input->apply(1.0, t);
+    }
+
+    // Check neuron spikes every 10s
+    for(unsigned int t = 0; t < 25000; t++) {
+        ASSERT_EQ(uploadedSpikes[t].size(), (t == 10000 || t == 20000) ? 1 : 0);
+    }
+}
+
+//------------------------------------------------------------------------
+// PoissonSpikeRate tests
+//------------------------------------------------------------------------
+TEST(PoissonSpikeRateTest, Benchmark) {
+    // XML fragment specifying seeded input with 10Hz rate
+    const char *inputXML = "<ConstantInput value=\"10.0\" rate_seed=\"1234\"/>\n";
+
+    pugi::xml_document inputDocument;
+    inputDocument.load_string(inputXML);
+
+    // Create 100k spike sources
+    const unsigned int popSize = 100000;
+    const double dt = 0.1;
+    auto input = createSpikeInput<Input::PoissonSpikeRate>(dt, popSize, inputDocument.child("ConstantInput"));
+
+    // Apply input for 1s, timing how long it takes
+    const unsigned long long numTimesteps = 10000;
+    const auto start = std::chrono::high_resolution_clock::now();
+    size_t numSpikes = 0;
+    for(unsigned long long t = 0; t < numTimesteps; t++) {
+        input->apply(dt, t);
+        numSpikes += uploadedSpikes.back().size();
+        uploadedSpikes.clear();
+    }
+    const std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start;
+    std::cout << popSize << " Poisson spike sources simulated for " << numTimesteps << " timesteps in " << duration.count() << "s" << std::endl;
+
+    // Check mean rate is approximately correct
+    const double meanRate = (double)numSpikes / (double)popSize / (numTimesteps * dt / 1000.0);
+    EXPECT_NEAR(meanRate, 10.0, 0.1);
+}
@@ -0,0 +1,121 @@
+// Standard C++ includes
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Standard C includes
+#include <cstdint>
+#include <cstdio>
+
+// Filesystem includes
+#include "path.h"
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// pugixml includes
+#include "pugixml/pugixml.hpp"
+
+// SpineML simulator includes
+#include "modelProperty.h"
+
+using namespace SpineMLSimulator;
+
+//------------------------------------------------------------------------
+// Anonymous namespace
+//------------------------------------------------------------------------
+namespace
+{
+// Host state variable model properties are written to
+scalar *hostVar;
+unsigned int numPushes;
+
+void pushVarToDevice(bool)
+{
+    numPushes++;
+}
+
+// Stand-in for looking up symbols in generated code library
+void *getLibrarySymbol(const char *name, bool)
+{
+    if(std::string(name) == "var") {
+        return &hostVar;
+    }
+    else if(std::string(name) == "pushvarToDevice") {
+        return reinterpret_cast<void*>(&pushVarToDevice);
+    }
+    else {
+        return nullptr;
+    }
+}
+
+void writeValueListFile(const char *filename, const std::vector<std::pair<uint32_t, double>> &elements)
+{
+    std::ofstream file(filename, std::ios::binary);
+    for(const auto &e : elements) {
+        file.write(reinterpret_cast<const char*>(&e.first), sizeof(uint32_t));
+        file.write(reinterpret_cast<const char*>(&e.second), sizeof(double));
+    }
+}
+}   // Anonymous namespace
+
+//------------------------------------------------------------------------
+// ValueList tests
+//------------------------------------------------------------------------
+TEST(ValueListTest, BinaryFileRemap) {
+    // Write unordered values for 4 connections
+    writeValueListFile("testModelProperty.bin", {{2, 3.0}, {0, 1.0}, {3, 4.0}, {1, 2.0}});
+
+    // XML fragment specifying value list
+    const char *valueListXML =
+        "<ValueList>\n"
+        "   <BinaryFile file_name=\"testModelProperty.bin\" num_elements=\"4\"/>\n"
+        "</ValueList>\n";
+
+    pugi::xml_document valueListDocument;
+    valueListDocument.load_string(valueListXML);
+
+    // Create value list, remapping connections into padded 2x3 ragged matrix
+    std::vector<scalar> var(6, -1.0f);
+    hostVar = var.data();
+    numPushes = 0;
+    const std::vector<unsigned int> remapIndices{0, 4, 1, 3};
+    filesystem::path basePath;
+    ModelProperty::ValueList valueList(valueListDocument.child("ValueList"), basePath, &remapIndices,
+                                       StateVar<scalar>("var", getLibrarySymbol), 6);
+    std::remove("testModelProperty.bin");
+
+    // Check values are scattered into their remapped locations, padding is zeroed and values are pushed
+    const std::vector<scalar> correct{1.0f, 3.0f, 0.0f, 4.0f, 2.0f, 0.0f};
+    EXPECT_EQ(var, correct);
+    EXPECT_EQ(numPushes, 1);
+}
+//------------------------------------------------------------------------
+TEST(ValueListTest, BinaryFileTruncated) {
+    // Write fewer values than specified in XML
+    writeValueListFile("testModelProperty.bin", {{0, 1.0}, {1, 2.0}});
+
+    // XML fragment specifying value list
+    const char *valueListXML =
+        "<ValueList>\n"
+        "   <BinaryFile file_name=\"testModelProperty.bin\" num_elements=\"3\"/>\n"
+        "</ValueList>\n";
+
+    pugi::xml_document valueListDocument;
+    valueListDocument.load_string(valueListXML);
+
+    // Check creating value list fails
+    std::vector<scalar> var(3);
+    hostVar = var.data();
+    filesystem::path basePath;
+    try
+    {
+        ModelProperty::ValueList valueList(valueListDocument.child("ValueList"), basePath, nullptr,
+                                           StateVar<scalar>("var", getLibrarySymbol), 3);
+        FAIL();
+    }
+    catch(const std::runtime_error &)
+    {
+    }
+    std::remove("testModelProperty.bin");
+}
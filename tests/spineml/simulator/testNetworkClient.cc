@@ -0,0 +1,167 @@
+// Standard C++ includes
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// SpineML simulator includes
+#include "networkClient.h"
+
+// Test includes
+#include "networkServer.h"
+
+using namespace SpineMLSimulator;
+
+//------------------------------------------------------------------------
+// Anonymous namespace
+//------------------------------------------------------------------------
+namespace
+{
+std::vector<std::vector<double>> createData(unsigned int numTimesteps, unsigned int size)
+{
+    std::vector<std::vector<double>> data(numTimesteps, std::vector<double>(size));
+    for(unsigned int t = 0; t < numTimesteps; t++) {
+        for(unsigned int i = 0; i < size; i++) {
+            data[t][i] = (double)((t * size) + i);
+        }
+    }
+    return data;
+}
+
+void testSource(unsigned int batchTimesteps, bool sharedMemory, unsigned int numMessages)
+{
+    const auto data = createData(10, 3);
+
+    // Send data from source client to server
+    NetworkServer server;
+    {
+        NetworkClient client("127.0.0.1", server.getPort(), 3, NetworkClient::DataType::Analogue,
+                             NetworkClient::Mode::Source, "source", batchTimesteps, sharedMemory);
+        for(const auto &timestep : data) {
+            ASSERT_TRUE(client.send(timestep));
+        }
+    }
+    server.join();
+
+    // Check all data arrived in the expected number of messages
+    EXPECT_EQ(server.getConnectionName(), "source");
+    EXPECT_EQ(server.getBatchTimesteps(), batchTimesteps);
+    EXPECT_EQ(server.isSharedMemoryUsed(), sharedMemory);
+    EXPECT_EQ(server.getReceivedData(), data);
+    EXPECT_EQ(server.getNumMessages(), numMessages);
+}
+
+void testTarget(unsigned int batchTimesteps, bool sharedMemory, unsigned int numMessages)
+{
+    const auto data = createData(10, 3);
+
+    // Receive data from server with target client
+    NetworkServer server(data);
+    {
+        NetworkClient client("127.0.0.1", server.getPort(), 3, NetworkClient::DataType::Analogue,
+                             NetworkClient::Mode::Target, "target", batchTimesteps, sharedMemory);
+        std::vector<double> timestep(3);
+        for(const auto &correct : data) {
+            ASSERT_TRUE(client.receive(timestep));
+            EXPECT_EQ(timestep, correct);
+        }
+    }
+    server.join();
+
+    // Check data was sent in the expected number of messages
+    EXPECT_EQ(server.isSharedMemoryUsed(), sharedMemory);
+    EXPECT_EQ(server.getNumMessages(), numMessages);
+}
+
+void testTargetDisconnect(unsigned int batchTimesteps, bool sharedMemory)
+{
+    const auto data = createData(2, 3);
+
+    // Receive data from server which disconnects after sending it
+    NetworkServer server(data);
+    NetworkClient client("127.0.0.1", server.getPort(), 3, NetworkClient::DataType::Analogue,
+                         NetworkClient::Mode::Target, "target", batchTimesteps, sharedMemory);
+    std::vector<double> timestep(3);
+    for(const auto &correct : data) {
+        ASSERT_TRUE(client.receive(timestep));
+        EXPECT_EQ(timestep, correct);
+    }
+    server.join();
+
+    // Check receiving further data fails rather than waiting forever
+    EXPECT_FALSE(client.receive(timestep));
+}
+
+double timeSource(unsigned int numTimesteps, unsigned int batchTimesteps, bool sharedMemory)
+{
+    const std::vector<double> timestep(100, 1.0);
+
+    NetworkServer server;
+    const auto start = std::chrono::high_resolution_clock::now();
+    {
+        NetworkClient client("127.0.0.1", server.getPort(), 100, NetworkClient::DataType::Analogue,
+                             NetworkClient::Mode::Source, "benchmark", batchTimesteps, sharedMemory);
+        for(unsigned int t = 0; t < numTimesteps; t++) {
+            EXPECT_TRUE(client.send(timestep));
+        }
+    }
+    server.join();
+    const std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start;
+
+    EXPECT_EQ(server.getReceivedData().size(), numTimesteps);
+    return duration.count();
+}
+}   // Anonymous namespace
+
+//------------------------------------------------------------------------
+// NetworkClient tests
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, SourceStandard) {
+    testSource(1, false, 10);
+}
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, SourceBatched) {
+    // **NOTE** final partially-filled batch is flushed when client is destroyed
+    testSource(4, false, 3);
+}
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, SourceSharedMemory) {
+    testSource(4, true, 3);
+}
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, TargetStandard) {
+    testTarget(1, false, 10);
+}
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, TargetBatched) {
+    testTarget(4, false, 3);
+}
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, TargetSharedMemory) {
+    testTarget(1, true, 10);
+}
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, TargetBatchedDisconnect) {
+    testTargetDisconnect(4, false);
+}
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, TargetSharedMemoryDisconnect) {
+    testTargetDisconnect(1, true);
+}
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, BatchedUnsupported) {
+    // Check connection fails if server doesn't support batched protocol
+    NetworkServer server({}, false);
+    NetworkClient client;
+    EXPECT_FALSE(client.connect("127.0.0.1", server.getPort(), 3, NetworkClient::DataType::Analogue,
+                                NetworkClient::Mode::Source, "source", 4, false));
+}
+//------------------------------------------------------------------------
+TEST(NetworkClientTest, Benchmark) {
+    const unsigned int numTimesteps = 10000;
+    std::cout << numTimesteps << " timesteps sent with standard protocol in " << timeSource(numTimesteps, 1, false) << "s, ";
+    std::cout << "batches of 10 in " << timeSource(numTimesteps, 10, false) << "s and ";
+    std::cout << "batches of 10 through shared memory in " << timeSource(numTimesteps, 10, true) << "s" << std::endl;
+}
@@ -0,0 +1,43 @@
+// Google test includes
+#include "gtest/gtest.h"
+
+// GeNN code generator includes
+#include "code_generator/backendCPU.h"
+
+using namespace CodeGenerator;
+
+//--------------------------------------------------------------------------
+// Tests
+//--------------------------------------------------------------------------
+TEST(BackendCPU, HostAllocationAlignment)
+{
+    // Without huge pages, all arrays are 64-byte aligned
+    EXPECT_EQ(BackendCPU::getHostAllocationAlignment(0, false), 64);
+    EXPECT_EQ(BackendCPU::getHostAllocationAlignment(1, false), 64);
+    EXPECT_EQ(BackendCPU::getHostAllocationAlignment(2 * 1024 * 1024, false), 64);
+    EXPECT_EQ(BackendCPU::getHostAllocationAlignment(64 * 1024 * 1024, false), 64);
+
+    // With huge pages, only arrays spanning at least one huge page are aligned to huge page boundaries
+    EXPECT_EQ(BackendCPU::getHostAllocationAlignment(1, true), 64);
+    EXPECT_EQ(BackendCPU::getHostAllocationAlignment((2 * 1024 * 1024) - 1, true), 64);
+    EXPECT_EQ(BackendCPU::getHostAllocationAlignment(2 * 1024 * 1024, true), 2 * 1024 * 1024);
+    EXPECT_EQ(BackendCPU::getHostAllocationAlignment(64 * 1024 * 1024, true), 2 * 1024 * 1024);
+}
+
+TEST(BackendCPU, HostAllocationSize)
+{
+    // Sizes are rounded up to a non-zero multiple of the alignment
+    EXPECT_EQ(BackendCPU::getHostAllocationSize(0, false), 64);
+    EXPECT_EQ(BackendCPU::getHostAllocationSize(1, false), 64);
+    EXPECT_EQ(BackendCPU::getHostAllocationSize(63, false), 64);
+    EXPECT_EQ(BackendCPU::getHostAllocationSize(64, false), 64);
+    EXPECT_EQ(BackendCPU::getHostAllocationSize(65, false), 128);
+    EXPECT_EQ(BackendCPU::getHostAllocationSize(1000, false), 1024);
+    EXPECT_EQ(BackendCPU::getHostAllocationSize((2 * 1024 * 1024) + 1, false), (2 * 1024 * 1024) + 64);
+
+    // With huge pages, small arrays are padded as before but large ones are padded to a multiple of the huge page size
+    EXPECT_EQ(BackendCPU::getHostAllocationSize(1000, true), 1024);
+    EXPECT_EQ(BackendCPU::getHostAllocationSize((2 * 1024 * 1024) - 1, true), 2 * 1024 * 1024);
+    EXPECT_EQ(BackendCPU::getHostAllocationSize(2 * 1024 * 1024, true), 2 * 1024 * 1024);
+    EXPECT_EQ(BackendCPU::getHostAllocationSize((2 * 1024 * 1024) + 1, true), 4 * 1024 * 1024);
+}
@@ -1,5 +1,9 @@
 // C++ standard includes
+#include <chrono>
+#include <iostream>
 #include <limits>
+#include <regex>
+#include <sstream>
 #include <tuple>
 
 // C standard includes
@@ -105,3 +109,100 @@ INSTANTIATE_TEST_CASE_P(DoubleValues,
                                           std::numeric_limits<double>::max(),
                                           1.0,
                                           -1.0),);
+
+//--------------------------------------------------------------------------
+// Benchmarks
+//--------------------------------------------------------------------------
+namespace
+{
+template<typename F>
+double timeMs(F f)
+{
+    const auto start = std::chrono::high_resolution_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+void reportSpeedup(const std::string &name, double legacyMs, double newMs)
+{
+    std::cout << "[ BENCHMARK] " << name << ": legacy " << legacyMs << "ms, single-pass " << newMs << "ms ("
+              << (legacyMs / newMs) << "x speedup)" << std::endl;
+}
+}
+
+// Compare single pass substitution against previous approach of searching code once for each substitution
+TEST(CodeGenUtilsBenchmark, Substitutions)
+{
+    const unsigned int numVars = 1000;
+    const unsigned int numFuncs = 50;
+
+    // Add variable and function substitutions
+    Substitutions parentSubs;
+    for(unsigned int f = 0; f < numFuncs; f++) {
+        parentSubs.addFuncSubstitution("func" + std::to_string(f), 2, "fn" + std::to_string(f) + "($(0), $(1))");
+    }
+    Substitutions subs(&parentSubs);
+    for(unsigned int v = 0; v < numVars; v++) {
+        subs.addVarSubstitution("var" + std::to_string(v), "group.var" + std::to_string(v) + "[$(id)]");
+    }
+    subs.addVarSubstitution("id", "i");
+
+    // Build code referencing all variables and functions
+    std::ostringstream codeStream;
+    for(unsigned int v = 0; v < numVars; v++) {
+        codeStream << "$(var" << v << ") += $(func" << (v % numFuncs) << ", $(var" << ((v + 1) % numVars) << "), 2 * DT);" << std::endl;
+    }
+    const std::string code = codeStream.str();
+
+    // Substitute using previous approach
+    std::string legacyCode = code;
+    const double legacyMs = timeMs(
+        [&legacyCode, numFuncs, numVars]()
+        {
+            for(unsigned int f = 0; f < numFuncs; f++) {
+                functionSubstitute(legacyCode, "func" + std::to_string(f), 2, "fn" + std::to_string(f) + "($(0), $(1))");
+            }
+            for(unsigned int v = 0; v < numVars; v++) {
+                substitute(legacyCode, "$(var" + std::to_string(v) + ")", "group.var" + std::to_string(v) + "[$(id)]");
+            }
+            substitute(legacyCode, "$(id)", "i");
+        });
+
+    std::string newCode = code;
+    const double newMs = timeMs([&newCode, &subs](){ subs.apply(newCode); });
+
+    ASSERT_EQ(legacyCode, newCode);
+    reportSpeedup("Substitutions", legacyMs, newMs);
+}
+
+// Compare single pass maths function precision rewriting against previous approach of one std::regex per function
+TEST(CodeGenUtilsBenchmark, MathFunctionFtype)
+{
+    const std::vector<std::string> funcs{"cos", "sin", "tan", "exp", "log", "pow", "sqrt", "fabs", "fmin", "fmax"};
+
+    // Build code calling all functions, some in ways which shouldn't be substituted
+    // **NOTE** only integer literals are used so ensureFtype only rewrites functions
+    std::ostringstream codeStream;
+    for(unsigned int i = 0; i < 1000; i++) {
+        const std::string &f = funcs[i % funcs.size()];
+        codeStream << "x" << i << " = " << f << "(y) + " << f << " (z) * my" << f << "(w) + " << f << "f(x) - " << f << "_x;" << std::endl;
+    }
+    const std::string code = codeStream.str();
+
+    // Rewrite to single precision using a regex per function as before
+    std::string legacyCode = code;
+    const double legacyMs = timeMs(
+        [&legacyCode, &funcs]()
+        {
+            for(const auto &f : funcs) {
+                const std::regex regex("(^|[^0-9a-zA-Z_])" + f + "(?=\\s*\\()");
+                legacyCode = std::regex_replace(legacyCode, regex, "$1" + f + "f");
+            }
+        });
+
+    std::string newCode;
+    const double newMs = timeMs([&newCode, &code](){ newCode = ensureFtype(code, "float"); });
+
+    ASSERT_EQ(legacyCode, newCode);
+    reportSpeedup("Maths function precision", legacyMs, newMs);
+}
@@ -0,0 +1,69 @@
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// GeNN includes
+#include "linearDynamics.h"
+
+//--------------------------------------------------------------------------
+// Tests
+//--------------------------------------------------------------------------
+TEST(LinearDynamics, PropagatorsDecay)
+{
+    // Exponential decay with time constant of 10 should match analytic solution
+    const auto propagators = Models::LinearDynamics::calcPropagators({-0.1}, 1, 2.0);
+    ASSERT_DOUBLE_EQ(propagators.first[0], std::exp(-0.2));
+    ASSERT_DOUBLE_EQ(propagators.second[0], 10.0 * (1.0 - std::exp(-0.2)));
+}
+
+TEST(LinearDynamics, PropagatorsIntegrator)
+{
+    // Singular system matrix of pure integrator should integrate input over timestep
+    const auto propagators = Models::LinearDynamics::calcPropagators({0.0}, 1, 0.5);
+    ASSERT_DOUBLE_EQ(propagators.first[0], 1.0);
+    ASSERT_DOUBLE_EQ(propagators.second[0], 0.5);
+}
+
+TEST(LinearDynamics, PropagatorsOscillator)
+{
+    // Harmonic oscillator should rotate state, even with timestep much larger than period
+    const auto propagators = Models::LinearDynamics::calcPropagators({0.0, 1.0, -1.0, 0.0}, 2, 20.0);
+    ASSERT_NEAR(propagators.first[0], std::cos(20.0), 1E-9);
+    ASSERT_NEAR(propagators.first[1], std::sin(20.0), 1E-9);
+    ASSERT_NEAR(propagators.first[2], -std::sin(20.0), 1E-9);
+    ASSERT_NEAR(propagators.first[3], std::cos(20.0), 1E-9);
+}
+
+TEST(LinearDynamics, DerivedParams)
+{
+    const Models::LinearDynamics dynamics({"V", "A"},
+                                          [](const std::vector<double> &pars){ return std::vector<double>{-1.0 / pars[0], -1.0 / pars[0], 0.0, -1.0 / pars[1]}; },
+                                          {"$(Isyn)", ""});
+
+    // Propagators should only be provided for non-zero inputs
+    const auto derivedParams = dynamics.getDerivedParams();
+    ASSERT_EQ(derivedParams.size(), 6);
+    ASSERT_EQ(derivedParams[0].name, "linP0_0");
+    ASSERT_EQ(derivedParams[3].name, "linP1_1");
+    ASSERT_EQ(derivedParams[4].name, "linQ0_0");
+    ASSERT_EQ(derivedParams[5].name, "linQ1_0");
+
+    // Uncoupled variable should simply decay
+    ASSERT_DOUBLE_EQ(derivedParams[3].func({20.0, 100.0}, 1.0), std::exp(-0.01));
+    ASSERT_DOUBLE_EQ(derivedParams[2].func({20.0, 100.0}, 1.0), 0.0);
+    ASSERT_DOUBLE_EQ(derivedParams[5].func({20.0, 100.0}, 1.0), 0.0);
+
+    // Update code should only reference propagators which exist
+    const std::string code = dynamics.getUpdateCode();
+    ASSERT_NE(code.find("$(linQ1_0) * linIn0"), std::string::npos);
+    ASSERT_EQ(code.find("linQ0_1"), std::string::npos);
+    ASSERT_EQ(code.find("linIn1"), std::string::npos);
+}
+
+TEST(LinearDynamics, MismatchedInputs)
+{
+    ASSERT_THROW(Models::LinearDynamics({"V", "A"}, [](const std::vector<double>&){ return std::vector<double>(4, 0.0); }, {"$(Isyn)"}),
+                 std::runtime_error);
+}
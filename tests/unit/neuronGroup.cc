@@ -347,3 +347,45 @@ TEST(NeuronGroup, InitCompareDifferentVars)
     ASSERT_TRUE(ng0Internal->canBeMerged(*ng1));
     ASSERT_FALSE(ng0Internal->canBeMerged(*ng2));
 }
+
+TEST(NeuronGroup, LatestSpikeTimestep)
+{
+    ModelSpecInternal model;
+
+    // Add neuron groups to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    auto *ng1 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramVals, varVals);
+    auto *ng2 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons2", 10, paramVals, varVals);
+    auto *ng3 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons3", 10, paramVals, varVals);
+
+    WeightUpdateModelPre::VarValues testVarVals(0.0);
+    WeightUpdateModelPre::PreVarValues testPreVarVals(0.0);
+
+    // Connect neuron group 1 to neuron group 0 with delayed pre weight update model
+    auto *sg0 = model.addSynapsePopulation<WeightUpdateModelPre, PostsynapticModels::DeltaCurr>("SG0", SynapseMatrixType::SPARSE_GLOBALG, 5,
+                                                                                                "Neurons1", "Neurons0",
+                                                                                                {}, testVarVals, testPreVarVals, {},
+                                                                                                {}, {});
+
+    // Connect neuron group 2 to neuron group 0 with undelayed pre weight update model
+    auto *sg1 = model.addSynapsePopulation<WeightUpdateModelPre, PostsynapticModels::DeltaCurr>("SG1", SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY,
+                                                                                                "Neurons2", "Neurons0",
+                                                                                                {}, testVarVals, testPreVarVals, {},
+                                                                                                {}, {});
+
+    // Connect neuron group 3 to neuron group 0 with delayed static pulse
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("SG2", SynapseMatrixType::SPARSE_INDIVIDUALG, 5,
+                                                                                               "Neurons3", "Neurons0",
+                                                                                               {}, WeightUpdateModels::StaticPulse::VarValues(0.1),
+                                                                                               {}, {});
+    model.finalize();
+
+    // Only delayed presynaptic variables require latest values to be stored separately
+    ASSERT_TRUE(static_cast<SynapseGroupInternal *>(sg0)->isWUPreVarLatestRequired());
+    ASSERT_FALSE(static_cast<SynapseGroupInternal *>(sg1)->isWUPreVarLatestRequired());
+    ASSERT_TRUE(static_cast<NeuronGroupInternal *>(ng1)->isLatestSpikeTimestepRequired());
+    ASSERT_FALSE(static_cast<NeuronGroupInternal *>(ng2)->isLatestSpikeTimestepRequired());
+    ASSERT_FALSE(static_cast<NeuronGroupInternal *>(ng3)->isLatestSpikeTimestepRequired());
+}
@@ -321,3 +321,183 @@ TEST(SynapseGroup, InitCompareWUDifferentPostVars)
     ASSERT_TRUE(sg0Internal->canWUPreInitBeMerged(*sg1));
     ASSERT_TRUE(sg0Internal->canWUPreInitBeMerged(*sg2));
 }
+
+TEST(SynapseGroup, CSRMaxNumSynapses)
+{
+    ModelSpecInternal model;
+
+    // Add two neuron groups to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 1000, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 1000, paramVals, varVals);
+
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProbParams(0.1);
+    WeightUpdateModels::StaticPulse::VarValues staticPulseVarVals(0.1);
+    auto *sparse = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Sparse", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+                                                                                                              "Neurons0", "Neurons1",
+                                                                                                              {}, staticPulseVarVals,
+                                                                                                              {}, {},
+                                                                                                              initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+    auto *csrFixedProb = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("CSRFixedProb", SynapseMatrixType::CSR_INDIVIDUALG, NO_DELAY,
+                                                                                                                    "Neurons0", "Neurons1",
+                                                                                                                    {}, staticPulseVarVals,
+                                                                                                                    {}, {},
+                                                                                                                    initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+    auto *csrUninit = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("CSRUninit", SynapseMatrixType::CSR_INDIVIDUALG, NO_DELAY,
+                                                                                                                 "Neurons0", "Neurons1",
+                                                                                                                 {}, staticPulseVarVals,
+                                                                                                                 {}, {});
+
+    // Max number of synapses can only be set on CSR synapse groups without a snippet which calculates it
+    ASSERT_THROW(sparse->setMaxNumSynapses(1000), std::runtime_error);
+    ASSERT_THROW(csrFixedProb->setMaxNumSynapses(1000), std::runtime_error);
+
+    // Total synapses in fixed probability CSR group should be much closer to the expected 100000 than padding every row to max row length
+    ASSERT_GT(csrFixedProb->getMaxNumSynapses(), 100000);
+    ASSERT_LT(csrFixedProb->getMaxNumSynapses(), 102000);
+    ASSERT_LT(csrFixedProb->getMaxNumSynapses(), 1000 * sparse->getMaxConnections());
+
+    // Uninitialised CSR group should fall back to max connections until max number of synapses is set
+    csrUninit->setMaxConnections(10);
+    ASSERT_EQ(csrUninit->getMaxNumSynapses(), 10000);
+    csrUninit->setMaxNumSynapses(5000);
+    ASSERT_EQ(csrUninit->getMaxNumSynapses(), 5000);
+}
+
+TEST(SynapseGroup, ExternalConnectivityFile)
+{
+    ModelSpecInternal model;
+
+    // Add two neuron groups to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 1000, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 1000, paramVals, varVals);
+
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProbParams(0.1);
+    WeightUpdateModels::StaticPulse::VarValues staticPulseVarVals(0.1);
+    WeightUpdateModels::StaticPulse::VarValues staticPulseUninitVarVals(uninitialisedVar());
+    auto *sparseFixedProb = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("SparseFixedProb", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+                                                                                                                       "Neurons0", "Neurons1",
+                                                                                                                       {}, staticPulseUninitVarVals,
+                                                                                                                       {}, {},
+                                                                                                                       initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+    auto *sparseInitVars = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("SparseInitVars", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+                                                                                                                      "Neurons0", "Neurons1",
+                                                                                                                      {}, staticPulseVarVals,
+                                                                                                                      {}, {});
+    auto *dense = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                                             "Neurons0", "Neurons1",
+                                                                                                             {}, staticPulseUninitVarVals,
+                                                                                                             {}, {});
+    auto *sparseUninit = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("SparseUninit", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+                                                                                                                    "Neurons0", "Neurons1",
+                                                                                                                    {}, staticPulseUninitVarVals,
+                                                                                                                    {}, {});
+
+    // External connectivity can only be used on sparse synapse groups with neither connectivity nor variable initialisation
+    ASSERT_THROW(sparseFixedProb->setExternalConnectivityFile("connectivity.bin"), std::runtime_error);
+    ASSERT_THROW(sparseInitVars->setExternalConnectivityFile("connectivity.bin"), std::runtime_error);
+    ASSERT_THROW(dense->setExternalConnectivityFile("connectivity.bin"), std::runtime_error);
+    ASSERT_FALSE(sparseUninit->isExternalConnectivity());
+
+    sparseUninit->setExternalConnectivityFile("connectivity.bin");
+    ASSERT_TRUE(sparseUninit->isExternalConnectivity());
+    ASSERT_EQ(sparseUninit->getExternalConnectivityFile(), "connectivity.bin");
+}
+
+TEST(SynapseGroup, CompressedSparseInd)
+{
+    ModelSpecInternal model;
+
+    // Add two neuron groups to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramVals, varVals);
+
+    WeightUpdateModels::StaticPulse::VarValues staticPulseVarVals(0.1);
+    auto *sparse0 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Sparse0", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+                                                                                                               "Neurons0", "Neurons1",
+                                                                                                               {}, staticPulseVarVals,
+                                                                                                               {}, {});
+    auto *sparse1 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Sparse1", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+                                                                                                               "Neurons0", "Neurons1",
+                                                                                                               {}, staticPulseVarVals,
+                                                                                                               {}, {});
+    auto *csr = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("CSR", SynapseMatrixType::CSR_INDIVIDUALG, NO_DELAY,
+                                                                                                           "Neurons0", "Neurons1",
+                                                                                                           {}, staticPulseVarVals,
+                                                                                                           {}, {});
+    auto *dense = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                                             "Neurons0", "Neurons1",
+                                                                                                             {}, staticPulseVarVals,
+                                                                                                             {}, {});
+
+    // Compressed indices can only be used on synapse groups with sparse or CSR connectivity
+    ASSERT_THROW(dense->setCompressedSparseIndEnabled(true), std::runtime_error);
+    ASSERT_FALSE(sparse0->isCompressedSparseIndEnabled());
+    sparse0->setCompressedSparseIndEnabled(true);
+    csr->setCompressedSparseIndEnabled(true);
+    ASSERT_TRUE(sparse0->isCompressedSparseIndEnabled());
+    ASSERT_TRUE(csr->isCompressedSparseIndEnabled());
+
+    // Finalize model
+    model.finalize();
+
+    // Groups with compressed and uncompressed indices require different code so cannot be merged
+    SynapseGroupInternal *sparse1Internal = static_cast<SynapseGroupInternal*>(sparse1);
+    ASSERT_FALSE(sparse1Internal->canWUBeMerged(*sparse0));
+}
+
+TEST(SynapseGroup, WUVarStorage)
+{
+    ModelSpecInternal model;
+
+    // Add two neuron groups to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramVals, varVals);
+
+    WeightUpdateModels::StaticPulse::VarValues staticPulseVarVals(0.1);
+    auto *dense0 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Dense0", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                                              "Neurons0", "Neurons1",
+                                                                                                              {}, staticPulseVarVals,
+                                                                                                              {}, {});
+    auto *dense1 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Dense1", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                                              "Neurons0", "Neurons1",
+                                                                                                              {}, staticPulseVarVals,
+                                                                                                              {}, {});
+    auto *dense2 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Dense2", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                                              "Neurons0", "Neurons1",
+                                                                                                              {}, staticPulseVarVals,
+                                                                                                              {}, {});
+    auto *global = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Global", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY,
+                                                                                                              "Neurons0", "Neurons1",
+                                                                                                              {}, staticPulseVarVals,
+                                                                                                              {}, {});
+
+    // Reduced-precision storage can only be used on individual weights and quantised integers require a positive scale
+    ASSERT_THROW(global->setWUVarStorage("g", VarStorage::HALF), std::runtime_error);
+    ASSERT_THROW(dense0->setWUVarStorage("g", VarStorage::INT8, 0.0), std::runtime_error);
+    ASSERT_EQ(dense0->getWUVarStorage(0), VarStorage::NATIVE);
+    dense0->setWUVarStorage("g", VarStorage::INT8, 0.01);
+    dense1->setWUVarStorage("g", VarStorage::INT8, 0.02);
+    dense2->setWUVarStorage("g", VarStorage::INT8, 0.01);
+    ASSERT_EQ(dense0->getWUVarStorage(0), VarStorage::INT8);
+    ASSERT_EQ(dense0->getWUVarStorageScale(0), 0.01);
+
+    // Finalize model
+    model.finalize();
+
+    // Groups can only be merged if their variables are stored in the same format with the same scale
+    SynapseGroupInternal *dense0Internal = static_cast<SynapseGroupInternal*>(dense0);
+    SynapseGroupInternal *dense1Internal = static_cast<SynapseGroupInternal*>(dense1);
+    SynapseGroupInternal *dense2Internal = static_cast<SynapseGroupInternal*>(dense2);
+    ASSERT_FALSE(dense0Internal->canWUBeMerged(*dense1Internal));
+    ASSERT_FALSE(dense0Internal->canWUInitBeMerged(*dense1Internal));
+    ASSERT_TRUE(dense0Internal->canWUBeMerged(*dense2Internal));
+    ASSERT_TRUE(dense0Internal->canWUInitBeMerged(*dense2Internal));
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+// Standard C includes
+#include <cstdint>
+
+// Test includes
+#include "simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimulationTestRNGStreams
+//----------------------------------------------------------------------------
+//! Base class for tests of models with a population 'Pop' of 1001 neurons, each of which initialises y and
+//! samples x every timestep from uniform distributions using the counter-based RNG in definitionsInternal.h
+class SimulationTestRNGStreams : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    //! Stream id of merged group's RNG, combining stream domain, merged group and group within merged group
+    static uint64_t getStreamID(uint64_t domain, uint64_t mergedGroup, uint64_t group)
+    {
+        return (domain << 48) | (mergedGroup << 32) | group;
+    }
+
+    //! Check random numbers match those generated sequentially from each neuron's id and the timestep
+    /*! Each neuron's random numbers are drawn from its own counter-based stream
+        so this should be the case however work is divided between threads */
+    void CheckMatchesSequential()
+    {
+        // **NOTE** each variable initialised, starting with spikes, takes the next sub-stream so y uses the third
+        const uint64_t initKey = gennRNGKey(rngSeed, getStreamID(3, 0, 0));
+        for(unsigned int i = 0; i < 1001; i++) {
+            Philox4x32 rng(initKey, i, 2);
+            ASSERT_EQ(yPop[i], gennUniform(rng));
+        }
+
+        const uint64_t simKey = gennRNGKey(rngSeed, getStreamID(2, 0, 0));
+        while(iT < 100) {
+            StepGeNN();
+
+            for(unsigned int i = 0; i < 1001; i++) {
+                Philox4x32 rng(simKey, i, iT - 1);
+                ASSERT_EQ(xPop[i], gennUniform(rng));
+            }
+        }
+    }
+};
@@ -25,7 +25,7 @@ public:
     //----------------------------------------------------------------------------
     // Public API
     //----------------------------------------------------------------------------
-    bool Simulate()
+    double Simulate()
     {
         // Create vector of samples
         std::vector<double> samples;
@@ -30,7 +30,8 @@ class SharedLibraryModel
 public:
     SharedLibraryModel()
     :   m_Library(nullptr), m_AllocateMem(nullptr), m_FreeMem(nullptr),
-        m_Initialize(nullptr), m_InitializeSparse(nullptr), m_StepTime(nullptr)
+        m_Initialize(nullptr), m_InitializeSparse(nullptr), m_StepTime(nullptr),
+        m_AllocateRecordingBuffers(nullptr), m_PullRecordingBuffersFromDevice(nullptr)
     {
     }
 
@@ -81,6 +82,10 @@ public:
 
             m_StepTime = (VoidFunction)getSymbol("stepTime");
 
+            // Recording functions are only generated if any populations record spikes
+            m_AllocateRecordingBuffers = (EGPFunction)getSymbol("allocateRecordingBuffers", true);
+            m_PullRecordingBuffersFromDevice = (VoidFunction)getSymbol("pullRecordingBuffersFromDevice", true);
+
             m_T = (scalar*)getSymbol("t");
             m_Timestep = (unsigned long long*)getSymbol("iT");
             return true;
@@ -302,6 +307,22 @@ public:
         m_StepTime();
     }
 
+    void allocateRecordingBuffers(unsigned int timesteps)
+    {
+        if(m_AllocateRecordingBuffers == nullptr) {
+            throw std::runtime_error("Model does not have any populations with spike recording enabled");
+        }
+        m_AllocateRecordingBuffers(timesteps);
+    }
+
+    void pullRecordingBuffersFromDevice()
+    {
+        if(m_PullRecordingBuffersFromDevice == nullptr) {
+            throw std::runtime_error("Model does not have any populations with spike recording enabled");
+        }
+        m_PullRecordingBuffersFromDevice();
+    }
+
     scalar getTime() const
     {
         return *m_T;
@@ -423,6 +444,8 @@ private:
     VoidFunction m_Initialize;
     VoidFunction m_InitializeSparse;
     VoidFunction m_StepTime;
+    EGPFunction m_AllocateRecordingBuffers;
+    VoidFunction m_PullRecordingBuffersFromDevice;
 
     std::unordered_map<std::string, PushPullFunc> m_PopulationVars;
     std::unordered_map<std::string, EGPFunc> m_PopulationEPGs;
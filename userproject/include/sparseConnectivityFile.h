@@ -0,0 +1,173 @@
+#pragma once
+
+// Standard C++ includes
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Standard C includes
+#include <cstdint>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+// SparseConnectivityFile
+//----------------------------------------------------------------------------
+//! Class to build sparse connectivity and per-synapse variables in GeNN's ragged
+//! layout and write them to a file which synapse groups can memory-map using
+//! SynapseGroup::setExternalConnectivityFile
+/*! **NOTE** these files use the same layout as the state files written by saveState:
+    a 64 byte header, a directory of named entries and then their data aligned to 64 bytes */
+class SparseConnectivityFile
+{
+public:
+    //! Create empty connectivity from numPre presynaptic neurons with space for maxRowLength synapses in each row.
+    /*! indBytes should match the size of the index type GeNN uses for the synapse group i.e. 1 or 2 if narrow sparse indices are enabled */
+    SparseConnectivityFile(unsigned int numPre, unsigned int maxRowLength, size_t indBytes = sizeof(uint32_t))
+    :   m_NumPre(numPre), m_MaxRowLength(maxRowLength), m_IndBytes(indBytes), m_RowLength(numPre, 0),
+        m_Ind((size_t)numPre * maxRowLength * indBytes, 0)
+    {
+        if(indBytes != sizeof(uint8_t) && indBytes != sizeof(uint16_t) && indBytes != sizeof(uint32_t)) {
+            throw std::runtime_error("Sparse indices must be 1, 2 or 4 bytes");
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Add per-synapse variable with elements of type T, returning its index
+    template<typename T>
+    size_t addVar(const std::string &name)
+    {
+        m_Vars.emplace_back(name, sizeof(T), std::vector<uint8_t>((size_t)m_NumPre * m_MaxRowLength * sizeof(T), 0));
+        return m_Vars.size() - 1;
+    }
+
+    //! Add synapse between presynaptic neuron pre and postsynaptic neuron post, returning its index
+    size_t addSynapse(unsigned int pre, unsigned int post)
+    {
+        if(pre >= m_NumPre) {
+            throw std::runtime_error("Presynaptic neuron " + std::to_string(pre) + " out of range");
+        }
+        if(m_RowLength[pre] == m_MaxRowLength) {
+            throw std::runtime_error("Row " + std::to_string(pre) + " has more than " + std::to_string(m_MaxRowLength) + " synapses");
+        }
+        if(m_IndBytes < sizeof(uint32_t) && post >= (1u << (8 * m_IndBytes))) {
+            throw std::runtime_error("Postsynaptic neuron " + std::to_string(post) + " cannot be represented with " + std::to_string(m_IndBytes) + " byte indices");
+        }
+
+        // Write index in native byte order and increment row length
+        const size_t synapse = ((size_t)pre * m_MaxRowLength) + m_RowLength[pre]++;
+        if(m_IndBytes == sizeof(uint8_t)) {
+            const uint8_t ind = (uint8_t)post;
+            memcpy(&m_Ind[synapse], &ind, sizeof(uint8_t));
+        }
+        else if(m_IndBytes == sizeof(uint16_t)) {
+            const uint16_t ind = (uint16_t)post;
+            memcpy(&m_Ind[synapse * sizeof(uint16_t)], &ind, sizeof(uint16_t));
+        }
+        else {
+            const uint32_t ind = post;
+            memcpy(&m_Ind[synapse * sizeof(uint32_t)], &ind, sizeof(uint32_t));
+        }
+        return synapse;
+    }
+
+    //! Set value of variable var for synapse
+    template<typename T>
+    void setVarValue(size_t var, size_t synapse, T value)
+    {
+        auto &v = m_Vars.at(var);
+        if(std::get<1>(v) != sizeof(T)) {
+            throw std::runtime_error("Variable '" + std::get<0>(v) + "' has a different type");
+        }
+        memcpy(&std::get<2>(v)[synapse * sizeof(T)], &value, sizeof(T));
+    }
+
+    //! Write connectivity and variables to file
+    void write(const std::string &filename) const
+    {
+        // Build list of entries
+        std::vector<std::tuple<std::string, const uint8_t*, uint64_t>> entries;
+        entries.emplace_back("rowLength", reinterpret_cast<const uint8_t*>(m_RowLength.data()), m_RowLength.size() * sizeof(uint32_t));
+        entries.emplace_back("ind", m_Ind.data(), m_Ind.size());
+        for(const auto &v : m_Vars) {
+            entries.emplace_back(std::get<0>(v), std::get<2>(v).data(), std::get<2>(v).size());
+        }
+
+        // Build names and directory
+        std::string names;
+        std::vector<uint64_t> directory;
+        for(const auto &e : entries) {
+            directory.push_back(names.size());
+            directory.push_back(std::get<0>(e).size());
+            directory.push_back(0);
+            directory.push_back(std::get<2>(e));
+            names += std::get<0>(e);
+        }
+
+        // Lay out data
+        const uint64_t namesOffset = 64 + (directory.size() * sizeof(uint64_t));
+        uint64_t offset = align(namesOffset + names.size());
+        for(size_t i = 0; i < entries.size(); i++) {
+            directory[(i * 4) + 2] = offset;
+            offset = align(offset + std::get<2>(entries[i]));
+        }
+
+        // Build header
+        uint8_t header[64] = {};
+        const uint32_t version = 1;
+        const uint32_t numEntries = (uint32_t)entries.size();
+        const uint64_t namesSize = names.size();
+        memcpy(&header[0], "GENNSTAT", 8);
+        memcpy(&header[8], &version, sizeof(uint32_t));
+        memcpy(&header[12], &numEntries, sizeof(uint32_t));
+        memcpy(&header[16], &namesOffset, sizeof(uint64_t));
+        memcpy(&header[24], &namesSize, sizeof(uint64_t));
+
+        std::ofstream os(filename, std::ios::binary);
+        if(!os.good()) {
+            throw std::runtime_error("Unable to open '" + filename + "' for writing");
+        }
+        os.write(reinterpret_cast<const char*>(header), sizeof(header));
+        os.write(reinterpret_cast<const char*>(directory.data()), directory.size() * sizeof(uint64_t));
+        os.write(names.data(), names.size());
+        uint64_t position = namesOffset + names.size();
+        const char padding[64] = {};
+        for(size_t i = 0; i < entries.size(); i++) {
+            os.write(padding, directory[(i * 4) + 2] - position);
+            os.write(reinterpret_cast<const char*>(std::get<1>(entries[i])), std::get<2>(entries[i]));
+            position = directory[(i * 4) + 2] + std::get<2>(entries[i]);
+        }
+        if(!os.good()) {
+            throw std::runtime_error("Unable to write '" + filename + "'");
+        }
+    }
+
+    unsigned int getNumPre() const{ return m_NumPre; }
+    unsigned int getMaxRowLength() const{ return m_MaxRowLength; }
+    unsigned int getRowLength(unsigned int pre) const{ return m_RowLength.at(pre); }
+
+private:
+    //------------------------------------------------------------------------
+    // Private static methods
+    //------------------------------------------------------------------------
+    static uint64_t align(uint64_t offset)
+    {
+        return ((offset + 63) / 64) * 64;
+    }
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    const unsigned int m_NumPre;
+    const unsigned int m_MaxRowLength;
+    const size_t m_IndBytes;
+
+    std::vector<uint32_t> m_RowLength;
+    std::vector<uint8_t> m_Ind;
+
+    //! Name, size of each element and data of each per-synapse variable
+    std::vector<std::tuple<std::string, size_t, std::vector<uint8_t>>> m_Vars;
+};
@@ -5,9 +5,13 @@
 #include <fstream>
 #include <iterator>
 #include <list>
+#include <string>
 #include <tuple>
 #include <vector>
 
+// Standard C includes
+#include <cstdint>
+
 //----------------------------------------------------------------------------
 // SpikeWriterText
 //----------------------------------------------------------------------------
@@ -154,3 +158,89 @@ private:
     GetCurrentSpikeCountFunc m_GetCurrentSpikeCount;
     unsigned int m_Sum;
 };
+
+//----------------------------------------------------------------------------
+// SpikeWriterBinary
+//----------------------------------------------------------------------------
+//! Class to write spike recording buffers, downloaded using pullRecordingBuffersFromDevice, to a compact binary file
+/*! The file begins with a header containing the magic string "GSPK", a 32-bit format version, the
+    32-bit population size and the double-precision timestep. This is followed by one block per call
+    to writeRecording containing the double-precision time of the first recorded timestep, the 32-bit
+    number of timesteps and the raw recording words, in which bit (i % 32) of word (i / 32) in each
+    timestep's ((popSize + 31) / 32) words is set if neuron i spiked. */
+class SpikeWriterBinary
+{
+public:
+    SpikeWriterBinary(const std::string &filename, unsigned int popSize, double dt)
+    :   m_Stream(filename, std::ios::binary), m_PopSize(popSize)
+    {
+        const uint32_t version = 1;
+        const uint32_t size = popSize;
+        m_Stream.write("GSPK", 4);
+        m_Stream.write(reinterpret_cast<const char*>(&version), sizeof(uint32_t));
+        m_Stream.write(reinterpret_cast<const char*>(&size), sizeof(uint32_t));
+        m_Stream.write(reinterpret_cast<const char*>(&dt), sizeof(double));
+    }
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    //! Append numTimesteps timesteps of recorded spikes, starting at startTime, to file
+    void writeRecording(const uint32_t *spkRecord, unsigned int numTimesteps, double startTime)
+    {
+        const uint32_t timesteps = numTimesteps;
+        const size_t numWords = ((m_PopSize + 31) / 32) * (size_t)numTimesteps;
+        m_Stream.write(reinterpret_cast<const char*>(&startTime), sizeof(double));
+        m_Stream.write(reinterpret_cast<const char*>(&timesteps), sizeof(uint32_t));
+        m_Stream.write(reinterpret_cast<const char*>(spkRecord), numWords * sizeof(uint32_t));
+    }
+
+private:
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::ofstream m_Stream;
+    const unsigned int m_PopSize;
+};
+
+//----------------------------------------------------------------------------
+// Free functions
+//----------------------------------------------------------------------------
+//! Write spike recording buffer, downloaded using pullRecordingBuffersFromDevice, to text file in the same format as SpikeWriterText
+inline void writeTextSpikeRecording(const std::string &filename, const uint32_t *spkRecord,
+                                    unsigned int popSize, unsigned int numTimesteps, double dt = 1.0,
+                                    const std::string &delimiter = " ", bool header = false, double startTime = 0.0)
+{
+    std::ofstream stream(filename);
+    stream.precision(16);
+
+    if(header) {
+        stream << "Time [ms], Neuron ID" << std::endl;
+    }
+
+    // Loop through timesteps
+    const unsigned int numWords = (popSize + 31) / 32;
+    for(unsigned int t = 0; t < numTimesteps; t++) {
+        const double time = startTime + (t * dt);
+
+        // Loop through words representing timestep
+        for(unsigned int w = 0; w < numWords; w++) {
+            // Get word and loop through set bits
+            uint32_t spikeWord = spkRecord[(t * numWords) + w];
+            unsigned int neuronID = w * 32;
+            while(spikeWord != 0) {
+                // Skip to next set bit
+                while((spikeWord & 1) == 0) {
+                    spikeWord >>= 1;
+                    neuronID++;
+                }
+
+                stream << time << delimiter << neuronID << std::endl;
+
+                // Clear bit and advance
+                spikeWord >>= 1;
+                neuronID++;
+            }
+        }
+    }
+}
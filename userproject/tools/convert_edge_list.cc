@@ -0,0 +1,128 @@
+//--------------------------------------------------------------------------
+/*! \file userproject/tools/convert_edge_list.cc
+
+\brief This tool converts a text edge list into a sparse connectivity file
+which synapse groups can memory-map using SynapseGroup::setExternalConnectivityFile.
+
+Each line of the edge list contains the index of the presynaptic neuron, the index
+of the postsynaptic neuron and then a value for each per-synapse variable, separated by whitespace.
+Lines starting with # are ignored. The maximum row length is written to standard output so the
+synapse group's maximum number of connections can be set to match using SynapseGroup::setMaxConnections.
+*/
+//--------------------------------------------------------------------------
+
+// Standard C++ includes
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Standard C includes
+#include <cstdlib>
+
+// GeNN userproject includes
+#include "sparseConnectivityFile.h"
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    if (argc < 5)
+    {
+        cerr << "usage: convert_edge_list ";
+        cerr << "<edge list> <# presynaptic neurons> <index bytes (1, 2 or 4)> <outfile> ";
+        cerr << "[<variable name>:<float|double> ...]";
+        cerr << endl;
+        return EXIT_FAILURE;
+    }
+
+    const unsigned int numPre = atoi(argv[2]);
+    const size_t indBytes = atoi(argv[3]);
+
+    // Parse variable names and types
+    vector<pair<string, bool>> vars;
+    for(int i = 5; i < argc; i++) {
+        const string var(argv[i]);
+        const size_t colon = var.find(':');
+        const string type = (colon == string::npos) ? "" : var.substr(colon + 1);
+        if(type != "float" && type != "double") {
+            cerr << "Variable '" << var << "' should be of the form <name>:<float|double>" << endl;
+            return EXIT_FAILURE;
+        }
+        vars.emplace_back(var.substr(0, colon), type == "double");
+    }
+
+    try {
+        // First pass - count synapses in each row to determine maximum row length
+        vector<unsigned int> rowLength(numPre, 0);
+        {
+            ifstream is(argv[1]);
+            if(!is.good()) {
+                cerr << "Unable to open '" << argv[1] << "'" << endl;
+                return EXIT_FAILURE;
+            }
+            string line;
+            while(getline(is, line)) {
+                unsigned int pre;
+                if(line.empty() || line[0] == '#' || !(istringstream(line) >> pre)) {
+                    continue;
+                }
+                if(pre >= numPre) {
+                    cerr << "Presynaptic neuron " << pre << " out of range" << endl;
+                    return EXIT_FAILURE;
+                }
+                rowLength[pre]++;
+            }
+        }
+        const unsigned int maxRowLength = *max_element(rowLength.cbegin(), rowLength.cend());
+
+        // Second pass - add synapses and variable values
+        SparseConnectivityFile connectivity(numPre, maxRowLength, indBytes);
+        vector<size_t> varIndices;
+        for(const auto &v : vars) {
+            varIndices.push_back(v.second ? connectivity.addVar<double>(v.first) : connectivity.addVar<float>(v.first));
+        }
+        {
+            ifstream is(argv[1]);
+            string line;
+            while(getline(is, line)) {
+                istringstream lineStream(line);
+                unsigned int pre;
+                unsigned int post;
+                if(line.empty() || line[0] == '#' || !(lineStream >> pre)) {
+                    continue;
+                }
+                if(!(lineStream >> post)) {
+                    cerr << "Line '" << line << "' has no postsynaptic neuron" << endl;
+                    return EXIT_FAILURE;
+                }
+
+                const size_t synapse = connectivity.addSynapse(pre, post);
+                for(size_t i = 0; i < vars.size(); i++) {
+                    double value;
+                    if(!(lineStream >> value)) {
+                        cerr << "Line '" << line << "' has no value for '" << vars[i].first << "'" << endl;
+                        return EXIT_FAILURE;
+                    }
+                    if(vars[i].second) {
+                        connectivity.setVarValue<double>(varIndices[i], synapse, value);
+                    }
+                    else {
+                        connectivity.setVarValue<float>(varIndices[i], synapse, (float)value);
+                    }
+                }
+            }
+        }
+
+        connectivity.write(argv[4]);
+        cout << maxRowLength << endl;
+    }
+    catch(const std::exception &ex) {
+        cerr << ex.what() << endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}